@@ -68,3 +68,4 @@
 
 %ignore coda_cursor_print_path;
 %ignore coda_expression_print;
+%ignore coda_expression_profile_print;
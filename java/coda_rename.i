@@ -33,14 +33,32 @@
 %rename(done) coda_done;
 %rename(set_option_bypass_special_types) coda_set_option_bypass_special_types;
 %rename(get_option_bypass_special_types) coda_get_option_bypass_special_types;
+%rename(set_option_cdf_cache_size) coda_set_option_cdf_cache_size;
+%rename(get_option_cdf_cache_size) coda_get_option_cdf_cache_size;
+%rename(set_option_hdf5_chunk_cache) coda_set_option_hdf5_chunk_cache;
+%rename(get_option_hdf5_chunk_cache) coda_get_option_hdf5_chunk_cache;
+%rename(set_option_hdf5_metadata_cache_size) coda_set_option_hdf5_metadata_cache_size;
+%rename(get_option_hdf5_metadata_cache_size) coda_get_option_hdf5_metadata_cache_size;
+%rename(set_option_hdf5_page_buffer_size) coda_set_option_hdf5_page_buffer_size;
+%rename(get_option_hdf5_page_buffer_size) coda_get_option_hdf5_page_buffer_size;
 %rename(set_option_perform_boundary_checks) coda_set_option_perform_boundary_checks;
 %rename(get_option_perform_boundary_checks) coda_get_option_perform_boundary_checks;
 %rename(set_option_perform_conversions) coda_set_option_perform_conversions;
 %rename(get_option_perform_conversions) coda_get_option_perform_conversions;
+%rename(set_option_profile_expressions) coda_set_option_profile_expressions;
+%rename(get_option_profile_expressions) coda_get_option_profile_expressions;
 %rename(set_option_use_fast_size_expressions) coda_set_option_use_fast_size_expressions;
 %rename(get_option_use_fast_size_expressions) coda_get_option_use_fast_size_expressions;
+%rename(set_option_use_grib_index) coda_set_option_use_grib_index;
+%rename(get_option_use_grib_index) coda_get_option_use_grib_index;
+%rename(set_option_use_hdf4_lazy_loading) coda_set_option_use_hdf4_lazy_loading;
+%rename(get_option_use_hdf4_lazy_loading) coda_get_option_use_hdf4_lazy_loading;
+%rename(set_option_use_hdf5_lazy_loading) coda_set_option_use_hdf5_lazy_loading;
+%rename(get_option_use_hdf5_lazy_loading) coda_get_option_use_hdf5_lazy_loading;
 %rename(set_option_use_mmap) coda_set_option_use_mmap;
 %rename(get_option_use_mmap) coda_get_option_use_mmap;
+%rename(set_option_use_xml_lazy_loading) coda_set_option_use_xml_lazy_loading;
+%rename(get_option_use_xml_lazy_loading) coda_get_option_use_xml_lazy_loading;
 %rename(set_definition_path) coda_set_definition_path;
 %rename(set_definition_path_conditional) coda_set_definition_path_conditional;
 %rename(NaN) coda_NaN;
@@ -61,6 +79,23 @@
 %rename(time_double_to_string_utc) coda_time_double_to_string_utc;
 %rename(time_string_to_double) coda_time_string_to_double;
 %rename(time_string_to_double_utc) coda_time_string_to_double_utc;
+%rename(time_format_compile) coda_time_format_compile;
+%rename(time_format_delete) coda_time_format_delete;
+%rename(time_format_get_string_length) coda_time_format_get_string_length;
+%rename(time_format_parts_to_string) coda_time_format_parts_to_string;
+%rename(time_format_string_to_parts) coda_time_format_string_to_parts;
+%rename(time_format_double_to_string) coda_time_format_double_to_string;
+%rename(time_format_double_to_string_utc) coda_time_format_double_to_string_utc;
+%rename(time_format_string_to_double) coda_time_format_string_to_double;
+%rename(time_format_string_to_double_utc) coda_time_format_string_to_double_utc;
+%rename(time_format_double_to_string_array) coda_time_format_double_to_string_array;
+%rename(time_format_string_to_double_array) coda_time_format_string_to_double_array;
+%rename(time_format_double_to_string_utc_array) coda_time_format_double_to_string_utc_array;
+%rename(time_format_string_to_double_utc_array) coda_time_format_string_to_double_utc_array;
+%rename(time_double_to_parts_array) coda_time_double_to_parts_array;
+%rename(time_double_to_parts_utc_array) coda_time_double_to_parts_utc_array;
+%rename(time_tai_to_utc_array) coda_time_tai_to_utc_array;
+%rename(time_utc_to_tai_array) coda_time_utc_to_tai_array;
 %rename(datetime_to_double) coda_datetime_to_double;
 %rename(utcdatetime_to_double) coda_utcdatetime_to_double;
 %rename(double_to_datetime) coda_double_to_datetime;
@@ -114,6 +149,14 @@
 %rename(type_get_special_base_type) coda_type_get_special_base_type;
 %rename(cursor_set_product) coda_cursor_set_product;
 %rename(cursor_goto) coda_cursor_goto;
+%rename(cursor_goto_path) coda_cursor_goto_path;
+%rename(path_compile) coda_path_compile;
+%rename(path_delete) coda_path_delete;
+%rename(xml_stream_open) coda_xml_stream_open;
+%rename(xml_stream_next) coda_xml_stream_next;
+%rename(xml_stream_close) coda_xml_stream_close;
+%rename(sp3_read_satellite_series) coda_sp3_read_satellite_series;
+%rename(rinex_read_satellite_series) coda_rinex_read_satellite_series;
 %rename(cursor_goto_first_record_field) coda_cursor_goto_first_record_field;
 %rename(cursor_goto_next_record_field) coda_cursor_goto_next_record_field;
 %rename(cursor_goto_record_field_by_index) coda_cursor_goto_record_field_by_index;
@@ -201,3 +244,6 @@
 %rename(expression_eval_string) coda_expression_eval_string;
 %rename(expression_eval_node) coda_expression_eval_node;
 
+%rename(expression_profile_reset) coda_expression_profile_reset;
+%rename(expression_profile_print) coda_expression_profile_print;
+
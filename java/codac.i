@@ -125,6 +125,45 @@ typedef long long int	uint64_t;
  */
 %ignore coda_match_filefilter;
 
+/*
+  Compiled time formats need a Java class for the opaque
+  coda_time_format handle and wrappers that allocate the output
+  strings based on coda_time_format_get_string_length().
+ */
+%ignore coda_time_format_compile;
+%ignore coda_time_format_delete;
+%ignore coda_time_format_get_string_length;
+%ignore coda_time_format_parts_to_string;
+%ignore coda_time_format_string_to_parts;
+%ignore coda_time_format_double_to_string;
+%ignore coda_time_format_double_to_string_utc;
+%ignore coda_time_format_string_to_double;
+%ignore coda_time_format_string_to_double_utc;
+%ignore coda_time_format_double_to_string_array;
+%ignore coda_time_format_string_to_double_array;
+%ignore coda_time_format_double_to_string_utc_array;
+%ignore coda_time_format_string_to_double_utc_array;
+
+/*
+  Compiled paths need a Java class for the opaque coda_path handle.
+ */
+%ignore coda_path_compile;
+%ignore coda_path_delete;
+%ignore coda_cursor_goto_path;
+
+/*
+  XML streams need a Java class for the opaque coda_xml_stream handle.
+ */
+%ignore coda_xml_stream_open;
+%ignore coda_xml_stream_next;
+%ignore coda_xml_stream_close;
+
+/*
+  Reading multiple netCDF record variables at once needs arrays of
+  names and of typed destination buffers.
+ */
+%ignore coda_netcdf_read_record_variables;
+
 
 /*
 ----------------------------------------------------------------------------------------
@@ -316,6 +355,7 @@ const char *coda_type_get_native_type_name(coda_native_type native_type);
 const char *coda_type_get_special_type_name(coda_special_type special_type);
 const char *coda_expression_get_type_name(coda_expression_type type);
 void coda_expression_delete(coda_expression *expr);
+void coda_expression_profile_reset(void);
 %ignore coda_done;
 %ignore coda_NaN;
 %ignore coda_PlusInf;
@@ -326,6 +366,7 @@ void coda_expression_delete(coda_expression *expr);
 %ignore coda_type_get_special_type_name;
 %ignore coda_expression_get_type_name;
 %ignore coda_expression_delete;
+%ignore coda_expression_profile_reset;
 
                  
 /*
@@ -333,10 +374,18 @@ void coda_expression_delete(coda_expression *expr);
   instead of, or in addition to, being an error flag.
 */
 int coda_get_option_bypass_special_types(void);
+long coda_get_option_cdf_cache_size(void);
+long coda_get_option_hdf5_metadata_cache_size(void);
+long coda_get_option_hdf5_page_buffer_size(void);
 int coda_get_option_perform_boundary_checks(void);
 int coda_get_option_perform_conversions(void);
+int coda_get_option_profile_expressions(void);
 int coda_get_option_use_fast_size_expressions(void);
+int coda_get_option_use_grib_index(void);
+int coda_get_option_use_hdf4_lazy_loading(void);
+int coda_get_option_use_hdf5_lazy_loading(void);
 int coda_get_option_use_mmap(void);
+int coda_get_option_use_xml_lazy_loading(void);
 int coda_isNaN(const double x);
 int coda_isInf(const double x);
 int coda_isPlusInf(const double x);
@@ -344,10 +393,18 @@ int coda_isMinInf(const double x);
 int coda_expression_is_constant(const coda_expression *expr);
 int coda_expression_is_equal(const coda_expression *expr1, const coda_expression *expr2);
 %ignore coda_get_option_bypass_special_types;
+%ignore coda_get_option_cdf_cache_size;
+%ignore coda_get_option_hdf5_metadata_cache_size;
+%ignore coda_get_option_hdf5_page_buffer_size;
 %ignore coda_get_option_perform_boundary_checks;
 %ignore coda_get_option_perform_conversions;
+%ignore coda_get_option_profile_expressions;
 %ignore coda_get_option_use_fast_size_expressions;
+%ignore coda_get_option_use_grib_index;
+%ignore coda_get_option_use_hdf4_lazy_loading;
+%ignore coda_get_option_use_hdf5_lazy_loading;
 %ignore coda_get_option_use_mmap;
+%ignore coda_get_option_use_xml_lazy_loading;
 %ignore coda_isNaN;
 %ignore coda_isInf;
 %ignore coda_isPlusInf;
@@ -450,6 +507,33 @@ int coda_expression_is_equal(const coda_expression *expr1, const coda_expression
          int *value};
 
 
+/*
+  Typemaps for the array arguments of the array time conversion
+  functions:
+
+  coda_time_double_to_parts_array()::const double *datetime, int *year, int *month, int *day,
+                                     int *hour, int *minute, int *second, int *musec
+  coda_time_double_to_parts_utc_array()::const double *datetime, int *year, int *month, int *day,
+                                         int *hour, int *minute, int *second, int *musec
+  coda_time_tai_to_utc_array()::const double *tai, double *utc
+  coda_time_utc_to_tai_array()::const double *utc, double *tai
+
+  The double_to_parts functions are mentioned explicitly and
+  ignored afterwards, so that the int[] typemap is only applied to
+  them and the scalar OUTPUT typemap can be restored for the other
+  time functions.
+*/
+%apply double[] { const double *datetime, const double *tai, double *tai, const double *utc, double *utc };
+%apply int[] { int *year, int *month, int *day, int *hour, int *minute, int *second, int *musec };
+int coda_time_double_to_parts_array(long num_elements, const double *datetime, int *year, int *month, int *day,
+                                    int *hour, int *minute, int *second, int *musec);
+%ignore coda_time_double_to_parts_array;
+int coda_time_double_to_parts_utc_array(long num_elements, const double *datetime, int *year, int *month, int *day,
+                                        int *hour, int *minute, int *second, int *musec);
+%ignore coda_time_double_to_parts_utc_array;
+%apply int *OUTPUT { int *year, int *month, int *day, int *hour, int *minute, int *second, int *musec };
+
+
 /*
   Typemap for scalar output arguments of type 'long':
 
@@ -462,11 +546,14 @@ int coda_expression_is_equal(const coda_expression *expr1, const coda_expression
   coda_cursor_get_record_field_index_from_name()::long *index
   coda_cursor_get_available_union_field_index()::long *index
   coda_cursor_get_num_elements()::long *num_elements
+  coda_get_option_hdf5_chunk_cache()::long *size, long *num_slots
 */
 %apply long *OUTPUT { long *length,
          long *num_fields,
          long *index,
-         long *num_elements };
+         long *num_elements,
+         long *size,
+         long *num_slots };
 
 
 /*
@@ -512,9 +599,10 @@ int coda_expression_is_equal(const coda_expression *expr1, const coda_expression
   coda_time_string_to_double()::double *datetime
   coda_time_string_to_double_utc()::double *datetime
   coda_utcstring_to_time()::double *datetime
+  coda_get_option_hdf5_chunk_cache()::double *preemption
 */
 %apply double *OUTPUT { double *dst_re, double *dst_im,
-         double *datetime, double *value };
+         double *datetime, double *value, double *preemption };
 
 
 %apply double *OUTPUT { double *dst };
@@ -48,7 +48,7 @@ static int get_relative_field_bit_offset_by_index(const coda_cursor *cursor, lon
     long index;
     long i;
 
-    record = (coda_type_record *)cursor->stack[cursor->n - 1].type;
+    record = (coda_type_record *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
     field = record->field[field_index];
 
     if (field->bit_offset >= 0)
@@ -156,7 +156,7 @@ static int get_next_relative_field_bit_offset(const coda_cursor *cursor, int64_t
     int64_t bit_size;
     int field_index;
 
-    record = (coda_type_record *)cursor->stack[cursor->n - 2].type;
+    record = (coda_type_record *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 2].type);
     field_index = cursor->stack[cursor->n - 1].index + 1;
     assert(field_index < record->num_fields);
     field = record->field[field_index];
@@ -37,7 +37,10 @@
 #include "coda-read-partial-array.h"
 #include "coda-transpose-array.h"
 #include "coda-ascbin.h"
-#include "ipow.h"
+#include "coda-ascii-pow10.h"
+#ifdef WORDS_BIGENDIAN
+#include "coda-swap8.h"
+#endif
 
 #include <sys/types.h>
 #include <assert.h>
@@ -78,6 +81,9 @@
 
 #define MAX_ASCII_NUMBER_LENGTH 64
 
+/* number of bytes that are read at once when parsing an array of fixed width ascii numbers from file */
+#define ASCII_ARRAY_BLOCK_SIZE 65536
+
 #include "coda-mem-internal.h"
 
 static int get_bit_size_boundary(const coda_cursor *cursor, int64_t *bit_size_boundary, int64_t read_bit_size)
@@ -263,11 +269,116 @@ static int parse_float_mapping(const char *buffer, long buffer_length, coda_asci
     return 0;
 }
 
+/* Read eight bytes as a little-endian 64-bit value (for SWAR processing of digits) */
+static uint64_t read_eight_bytes(const char *buffer)
+{
+    uint64_t value;
+
+    memcpy(&value, buffer, 8);
+#ifdef WORDS_BIGENDIAN
+    swap8(&value);
+#endif
+
+    return value;
+}
+
+static int count_trailing_zeros(uint64_t value)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll(value);
+#else
+    int count = 0;
+
+    while (!(value & 1))
+    {
+        value >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/* Returns the number of ASCII digits (0..8) at the start of the eight bytes of the (little-endian) value */
+static int count_leading_digits(uint64_t value)
+{
+    uint64_t mask;
+
+    /* the high bit of each byte in mask is set for all bytes that are not a digit (a carry out of a byte can only
+     * occur for a non-digit byte, so this can not result in false positives for the bytes before the first non-digit)
+     */
+    value ^= 0x3030303030303030ULL;
+    mask = ((value + 0x7676767676767676ULL) | value) & 0x8080808080808080ULL;
+
+    return mask == 0 ? 8 : count_trailing_zeros(mask) >> 3;
+}
+
+/* Converts the first num_digits (1..8) ASCII digits of the (little-endian) value to an integer using only three
+ * multiplications for all digits together
+ */
+static uint32_t parse_leading_digits(uint64_t value, int num_digits)
+{
+    if (num_digits < 8)
+    {
+        /* move the digits to the end and prefix them with '0' characters */
+        value = (value << (8 * (8 - num_digits))) | (0x3030303030303030ULL >> (8 * num_digits));
+    }
+    value -= 0x3030303030303030ULL;
+    value = (value * 10) + (value >> 8);
+    value = (((value & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+             (((value >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+
+    return (uint32_t)value;
+}
+
+static const uint64_t integer_pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+/* Parses a sequence of decimal digits into an unsigned integer.
+ * Returns the number of digits that were parsed or -1 if the value would be larger than max_value.
+ */
+static long parse_integer_digits(const char *buffer, long length, uint64_t max_value, uint64_t *dst)
+{
+    uint64_t value = 0;
+    long num_digits = 0;
+
+    /* process up to eight digits at a time as long as this can not overflow (value * 10^8 + 99999999 < 10^18) */
+    while (length - num_digits >= 8 && value < 10000000000ULL)
+    {
+        uint64_t chunk = read_eight_bytes(&buffer[num_digits]);
+        int count = count_leading_digits(chunk);
+
+        if (count == 0)
+        {
+            break;
+        }
+        value = value * integer_pow10[count] + parse_leading_digits(chunk, count);
+        num_digits += count;
+        if (count < 8)
+        {
+            break;
+        }
+    }
+    while (num_digits < length && buffer[num_digits] >= '0' && buffer[num_digits] <= '9')
+    {
+        uint64_t digit = buffer[num_digits] - '0';
+
+        if (value > (max_value - digit) / 10)
+        {
+            return -1;
+        }
+        value = 10 * value + digit;
+        num_digits++;
+    }
+
+    *dst = value;
+
+    return num_digits;
+}
+
 long coda_ascii_parse_int64(const char *buffer, long buffer_length, int64_t *dst, int ignore_trailing_bytes)
 {
     long length;
-    int integer_length;
-    int64_t value;
+    long integer_length;
+    uint64_t value;
     int negative = 0;
 
     length = buffer_length;
@@ -285,32 +396,19 @@ long coda_ascii_parse_int64(const char *buffer, long buffer_length, int64_t *dst
         length--;
     }
 
-    value = 0;
-    integer_length = 0;
-    while (length > 0)
+    integer_length = parse_integer_digits(buffer, length, MAXINT64, &value);
+    if (integer_length < 0)
     {
-        int64_t digit;
-
-        if (*buffer < '0' || *buffer > '9')
-        {
-            break;
-        }
-        digit = *buffer - '0';
-        if (value > (MAXINT64 - digit) / 10)
-        {
-            coda_set_error(CODA_ERROR_INVALID_FORMAT, "value too large for ascii integer");
-            return -1;
-        }
-        value = 10 * value + digit;
-        integer_length++;
-        buffer++;
-        length--;
+        coda_set_error(CODA_ERROR_INVALID_FORMAT, "value too large for ascii integer");
+        return -1;
     }
     if (integer_length == 0)
     {
         coda_set_error(CODA_ERROR_INVALID_FORMAT, "invalid format for ascii integer (no digits)");
         return -1;
     }
+    buffer += integer_length;
+    length -= integer_length;
     if (!ignore_trailing_bytes && length != 0)
     {
         while (length > 0 && (*buffer == ' ' || *buffer == '\t'))
@@ -325,12 +423,7 @@ long coda_ascii_parse_int64(const char *buffer, long buffer_length, int64_t *dst
         }
     }
 
-    if (negative)
-    {
-        value = -value;
-    }
-
-    *dst = value;
+    *dst = negative ? -(int64_t)value : (int64_t)value;
 
     return buffer_length - length;
 }
@@ -338,7 +431,7 @@ long coda_ascii_parse_int64(const char *buffer, long buffer_length, int64_t *dst
 long coda_ascii_parse_uint64(const char *buffer, long buffer_length, uint64_t *dst, int ignore_trailing_bytes)
 {
     long length;
-    int integer_length;
+    long integer_length;
     uint64_t value;
 
     length = buffer_length;
@@ -355,32 +448,19 @@ long coda_ascii_parse_uint64(const char *buffer, long buffer_length, uint64_t *d
         length--;
     }
 
-    value = 0;
-    integer_length = 0;
-    while (length > 0)
+    integer_length = parse_integer_digits(buffer, length, MAXUINT64, &value);
+    if (integer_length < 0)
     {
-        int64_t digit;
-
-        if (*buffer < '0' || *buffer > '9')
-        {
-            break;
-        }
-        digit = *buffer - '0';
-        if (value > (MAXUINT64 - digit) / 10)
-        {
-            coda_set_error(CODA_ERROR_INVALID_FORMAT, "value too large for ascii integer");
-            return -1;
-        }
-        value = 10 * value + digit;
-        integer_length++;
-        buffer++;
-        length--;
+        coda_set_error(CODA_ERROR_INVALID_FORMAT, "value too large for ascii integer");
+        return -1;
     }
     if (integer_length == 0)
     {
         coda_set_error(CODA_ERROR_INVALID_FORMAT, "invalid format for ascii integer (no digits)");
         return -1;
     }
+    buffer += integer_length;
+    length -= integer_length;
     if (!ignore_trailing_bytes && length != 0)
     {
         while (length > 0 && (*buffer == ' ' || *buffer == '\t'))
@@ -400,12 +480,164 @@ long coda_ascii_parse_uint64(const char *buffer, long buffer_length, uint64_t *d
     return buffer_length - length;
 }
 
+static uint64_t multiply_64x64(uint64_t a, uint64_t b, uint64_t *high)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 result = (unsigned __int128)a * b;
+
+    *high = (uint64_t)(result >> 64);
+    return (uint64_t)result;
+#else
+    uint64_t a_lo = a & 0xFFFFFFFF;
+    uint64_t a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFF;
+    uint64_t b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + a_lo * b_hi;
+
+    *high = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+    return (cross << 32) | (lo_lo & 0xFFFFFFFF);
+#endif
+}
+
+static int count_leading_zeros(uint64_t value)
+{
+#ifdef __GNUC__
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+
+    while (!(value & 0x8000000000000000ULL))
+    {
+        value <<= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/* Computes the correctly rounded double closest to mantissa * 10^exponent using the Eisel-Lemire algorithm.
+ * The mantissa should be non-zero and the exponent should be within the range of pow10_table.
+ * Returns -1 if the result could not be determined (halfway cases and subnormal/overflowing results); the caller
+ * should then fall back to a slow (but exact) conversion.
+ */
+static int eisel_lemire(uint64_t mantissa, int exponent, double *dst)
+{
+    const uint64_t *pow10 = pow10_table[exponent - POW10_TABLE_MIN_EXPONENT];
+    uint64_t x_hi, x_lo;
+    uint64_t result_mantissa;
+    uint64_t result_bits;
+    int64_t result_exponent;
+    int leading_zeros;
+    int msb;
+
+    leading_zeros = count_leading_zeros(mantissa);
+    mantissa <<= leading_zeros;
+    /* 217706 / 2^16 approximates log2(10) */
+    result_exponent = ((217706 * exponent) >> 16) + 64 + 1023 - leading_zeros;
+
+    x_lo = multiply_64x64(mantissa, pow10[0], &x_hi);
+    if ((x_hi & 0x1FF) == 0x1FF && x_lo + mantissa < mantissa)
+    {
+        /* the truncated 64-bit power of ten is not precise enough; use the full 128-bit value */
+        uint64_t y_hi, y_lo;
+        uint64_t merged_hi, merged_lo;
+
+        y_lo = multiply_64x64(mantissa, pow10[1], &y_hi);
+        merged_hi = x_hi;
+        merged_lo = x_lo + y_hi;
+        if (merged_lo < x_lo)
+        {
+            merged_hi++;
+        }
+        if ((merged_hi & 0x1FF) == 0x1FF && merged_lo + 1 == 0 && y_lo + mantissa < mantissa)
+        {
+            return -1;
+        }
+        x_hi = merged_hi;
+        x_lo = merged_lo;
+    }
+
+    /* shift to 54 bits */
+    msb = (int)(x_hi >> 63);
+    result_mantissa = x_hi >> (msb + 9);
+    result_exponent -= 1 ^ msb;
+
+    if (x_lo == 0 && (x_hi & 0x1FF) == 0 && (result_mantissa & 3) == 1)
+    {
+        /* we can not determine how to round a value that is exactly halfway between two doubles */
+        return -1;
+    }
+
+    /* round to 53 bits */
+    result_mantissa += result_mantissa & 1;
+    result_mantissa >>= 1;
+    if (result_mantissa >> 53)
+    {
+        result_mantissa >>= 1;
+        result_exponent++;
+    }
+    if (result_exponent <= 0 || result_exponent >= 0x7FF)
+    {
+        return -1;
+    }
+
+    result_bits = ((uint64_t)result_exponent << 52) | (result_mantissa & 0x000FFFFFFFFFFFFFULL);
+    memcpy(dst, &result_bits, sizeof(double));
+
+    return 0;
+}
+
+/* Slow path for the conversion of a decimal floating point value: the digits (with the decimal point removed) and the
+ * decimal exponent that applies to these digits are passed to strtod() (which is correctly rounded for all inputs).
+ * We don't pass the decimal point itself since strtod() is locale dependent for the decimal point character.
+ */
+static int parse_double_slow(const char *integer_digits, long num_integer_digits, const char *fraction_digits,
+                             long num_fraction_digits, long exponent, double *dst)
+{
+    char static_buffer[MAX_ASCII_NUMBER_LENGTH + 32];
+    char *str = static_buffer;
+    long length = num_integer_digits + num_fraction_digits;
+
+    if (length > MAX_ASCII_NUMBER_LENGTH)
+    {
+        str = malloc(length + 32);
+        if (str == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)(length + 32), __FILE__, __LINE__);
+            return -1;
+        }
+    }
+    memcpy(str, integer_digits, num_integer_digits);
+    memcpy(&str[num_integer_digits], fraction_digits, num_fraction_digits);
+    sprintf(&str[length], "e%ld", exponent);
+
+    *dst = strtod(str, NULL);
+
+    if (str != static_buffer)
+    {
+        free(str);
+    }
+
+    return 0;
+}
+
 long coda_ascii_parse_double(const char *buffer, long buffer_length, double *dst, int ignore_trailing_bytes)
 {
+    static const double exact_pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char *integer_digits;
+    const char *fraction_digits = NULL;
+    long num_integer_digits;
+    long num_fraction_digits = 0;
     long length;
-    int value_length;
-    int exponent_length;
     int has_sign;
+    uint64_t mantissa;
+    int num_significant_digits;
     double value;
     long exponent;
     int negative = 0;
@@ -459,66 +691,107 @@ long coda_ascii_parse_double(const char *buffer, long buffer_length, double *dst
         }
     }
 
-    value = 0;
-    exponent = 0;
-    value_length = 0;
-    /* read mantissa part before the digit */
-    while (length > 0)
+    /* up to 19 significant digits are accumulated in mantissa (which always fits in 64 bits); further digits are
+     * only counted (num_significant_digits stops counting at 20) */
+    mantissa = 0;
+    num_significant_digits = 0;
+    /* read mantissa part before the digit (leading zeros are not significant) */
+    integer_digits = buffer;
+    while (length > 0 && *buffer == '0')
     {
-        if (*buffer < '0' || *buffer > '9')
-        {
-            break;
-        }
-        value = 10 * value + (*buffer - '0');
-        value_length++;
         buffer++;
         length--;
     }
-    /* read digit and mantissa part after the digit */
-    if (length > 0)
+    while (length > 0 && *buffer >= '0' && *buffer <= '9')
     {
-        if (*buffer == '.')
+        if (length >= 8 && num_significant_digits <= 11)
+        {
+            uint64_t chunk = read_eight_bytes(buffer);
+            int count = count_leading_digits(chunk);
+
+            mantissa = mantissa * integer_pow10[count] + parse_leading_digits(chunk, count);
+            num_significant_digits += count;
+            buffer += count;
+            length -= count;
+        }
+        else
         {
+            if (num_significant_digits < 19)
+            {
+                mantissa = 10 * mantissa + (*buffer - '0');
+            }
+            if (num_significant_digits < 20)
+            {
+                num_significant_digits++;
+            }
             buffer++;
             length--;
-            while (length > 0)
+        }
+    }
+    num_integer_digits = (long)(buffer - integer_digits);
+    /* read digit and mantissa part after the digit */
+    if (length > 0 && *buffer == '.')
+    {
+        buffer++;
+        length--;
+        fraction_digits = buffer;
+        if (num_significant_digits == 0)
+        {
+            while (length > 0 && *buffer == '0')
+            {
+                buffer++;
+                length--;
+            }
+        }
+        while (length > 0 && *buffer >= '0' && *buffer <= '9')
+        {
+            if (length >= 8 && num_significant_digits <= 11)
+            {
+                uint64_t chunk = read_eight_bytes(buffer);
+                int count = count_leading_digits(chunk);
+
+                mantissa = mantissa * integer_pow10[count] + parse_leading_digits(chunk, count);
+                num_significant_digits += count;
+                buffer += count;
+                length -= count;
+            }
+            else
             {
-                if (*buffer < '0' || *buffer > '9')
+                if (num_significant_digits < 19)
                 {
-                    break;
+                    mantissa = 10 * mantissa + (*buffer - '0');
+                }
+                if (num_significant_digits < 20)
+                {
+                    num_significant_digits++;
                 }
-                value = 10 * value + (*buffer - '0');
-                exponent--;
-                value_length++;
                 buffer++;
                 length--;
             }
         }
+        num_fraction_digits = (long)(buffer - fraction_digits);
     }
-    if (value_length == 0)
+    if (num_integer_digits + num_fraction_digits == 0)
     {
         coda_set_error(CODA_ERROR_INVALID_FORMAT, "invalid format for ascii floating point value (no digits)");
         return -1;
     }
 
-    if (negative)
-    {
-        value = -value;
-    }
     /* read exponent part */
+    exponent = 0;
     if (length > 0 && (*buffer == 'd' || *buffer == 'D' || *buffer == 'e' || *buffer == 'E'))
     {
         long exponent_value;
-        int exponent_overflow = 0;
+        int exponent_length;
+        int exponent_negative = 0;
 
         buffer++;
         length--;
-        negative = 0;
         if (length > 0)
         {
             if (*buffer == '+' || *buffer == '-')
             {
-                negative = (*buffer == '-');
+                exponent_negative = (*buffer == '-');
                 buffer++;
                 length--;
             }
@@ -531,16 +804,12 @@ long coda_ascii_parse_double(const char *buffer, long buffer_length, double *dst
             {
                 break;
             }
-            if (!exponent_overflow)
+            /* beyond this value we will get 'inf' or zero anyway, so stop parsing to prevent integer overflow */
+            if (exponent_value < 100000000)
             {
                 exponent_value = 10 * exponent_value + (*buffer - '0');
-                exponent_length++;
-                if (exponent_value > 1024)
-                {
-                    /* we will now get 'inf' anyway, so stop parsing to prevent integer overflow in exponent */
-                    exponent_overflow = 1;
-                }
             }
+            exponent_length++;
             buffer++;
             length--;
         }
@@ -550,11 +819,7 @@ long coda_ascii_parse_double(const char *buffer, long buffer_length, double *dst
                            "invalid format for ascii floating point value (empty exponent value)");
             return -1;
         }
-        if (negative)
-        {
-            exponent_value = -exponent_value;
-        }
-        exponent += exponent_value;
+        exponent = exponent_negative ? -exponent_value : exponent_value;
     }
 
     if (!ignore_trailing_bytes && length != 0)
@@ -571,12 +836,57 @@ long coda_ascii_parse_double(const char *buffer, long buffer_length, double *dst
         }
     }
 
-    if (exponent != 0)
+    if (num_significant_digits > 19)
     {
-        value *= ipow(10, exponent);
+        /* the mantissa does not fit in 64 bits */
+        if (parse_double_slow(integer_digits, num_integer_digits, fraction_digits, num_fraction_digits,
+                              exponent - num_fraction_digits, &value) != 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        /* the value is mantissa * 10^exponent */
+        exponent -= num_fraction_digits;
+        if (mantissa == 0)
+        {
+            value = 0;
+        }
+        else if (mantissa <= 9007199254740992ULL && exponent >= -22 && exponent <= 22)
+        {
+            /* both the mantissa and the power of ten are exact doubles, so a single multiplication or division
+             * gives the correctly rounded result (Clinger's fast path) */
+            value = (double)mantissa;
+            if (exponent < 0)
+            {
+                value /= exact_pow10[-exponent];
+            }
+            else
+            {
+                value *= exact_pow10[exponent];
+            }
+        }
+        else if (exponent < POW10_TABLE_MIN_EXPONENT)
+        {
+            /* value is smaller than half of the smallest subnormal number */
+            value = 0;
+        }
+        else if (exponent > POW10_TABLE_MAX_EXPONENT)
+        {
+            value = coda_PlusInf();
+        }
+        else if (eisel_lemire(mantissa, (int)exponent, &value) != 0)
+        {
+            if (parse_double_slow(integer_digits, num_integer_digits, fraction_digits, num_fraction_digits, exponent,
+                                  &value) != 0)
+            {
+                return -1;
+            }
+        }
     }
 
-    *dst = value;
+    *dst = negative ? -value : value;
 
     return buffer_length - length;
 }
@@ -897,7 +1207,7 @@ int coda_ascii_cursor_get_bit_size(const coda_cursor *cursor, int64_t *bit_size)
             if (cursor->product->format == coda_format_ascii)
             {
                 int64_t byte_offset;
-                long *asciiline_end_offset;
+                int64_t *asciiline_end_offset;
                 long bottom_index;
                 long top_index;
 
@@ -1186,6 +1496,88 @@ int coda_ascii_cursor_read_uint64(const coda_cursor *cursor, uint64_t *dst)
     return 0;
 }
 
+/* Stores an integer value as the given native type (with range check) */
+static int store_int64_value(int64_t value, coda_native_type read_type, void *dst)
+{
+    switch (read_type)
+    {
+        case coda_native_type_int8:
+            if (value > MAXINT8 || value < -MAXINT8 - 1)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT,
+                               "product error detected (value for ascii integer too large for int8)");
+                return -1;
+            }
+            *(int8_t *)dst = (int8_t)value;
+            break;
+        case coda_native_type_int16:
+            if (value > MAXINT16 || value < -MAXINT16 - 1)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT,
+                               "product error detected (value for ascii integer too large for int16)");
+                return -1;
+            }
+            *(int16_t *)dst = (int16_t)value;
+            break;
+        case coda_native_type_int32:
+            if (value > MAXINT32 || value < -MAXINT32 - 1)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT,
+                               "product error detected (value for ascii integer too large for int32)");
+                return -1;
+            }
+            *(int32_t *)dst = (int32_t)value;
+            break;
+        default:
+            assert(read_type == coda_native_type_int64);
+            *(int64_t *)dst = value;
+            break;
+    }
+
+    return 0;
+}
+
+/* Stores an unsigned integer value as the given native type (with range check) */
+static int store_uint64_value(uint64_t value, coda_native_type read_type, void *dst)
+{
+    switch (read_type)
+    {
+        case coda_native_type_uint8:
+            if (value > MAXUINT8)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT,
+                               "product error detected (value for ascii integer too large for uint8)");
+                return -1;
+            }
+            *(uint8_t *)dst = (uint8_t)value;
+            break;
+        case coda_native_type_uint16:
+            if (value > MAXUINT16)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT,
+                               "product error detected (value for ascii integer too large for uint16)");
+                return -1;
+            }
+            *(uint16_t *)dst = (uint16_t)value;
+            break;
+        case coda_native_type_uint32:
+            if (value > MAXUINT32)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT,
+                               "product error detected (value for ascii integer too large for uint32)");
+                return -1;
+            }
+            *(uint32_t *)dst = (uint32_t)value;
+            break;
+        default:
+            assert(read_type == coda_native_type_uint64);
+            *(uint64_t *)dst = value;
+            break;
+    }
+
+    return 0;
+}
+
 int coda_ascii_cursor_read_int8(const coda_cursor *cursor, int8_t *dst)
 {
     int64_t value;
@@ -1194,14 +1586,8 @@ int coda_ascii_cursor_read_int8(const coda_cursor *cursor, int8_t *dst)
     {
         return -1;
     }
-    if (value > MAXINT8 || value < -MAXINT8 - 1)
-    {
-        coda_set_error(CODA_ERROR_PRODUCT, "product error detected (value for ascii integer too large for int8)");
-        return -1;
-    }
-    *dst = (int8_t)value;
 
-    return 0;
+    return store_int64_value(value, coda_native_type_int8, dst);
 }
 
 int coda_ascii_cursor_read_uint8(const coda_cursor *cursor, uint8_t *dst)
@@ -1212,14 +1598,8 @@ int coda_ascii_cursor_read_uint8(const coda_cursor *cursor, uint8_t *dst)
     {
         return -1;
     }
-    if (value > MAXUINT8)
-    {
-        coda_set_error(CODA_ERROR_PRODUCT, "product error detected (value for ascii integer too large for uint8)");
-        return -1;
-    }
-    *dst = (uint8_t)value;
 
-    return 0;
+    return store_uint64_value(value, coda_native_type_uint8, dst);
 }
 
 int coda_ascii_cursor_read_int16(const coda_cursor *cursor, int16_t *dst)
@@ -1230,14 +1610,8 @@ int coda_ascii_cursor_read_int16(const coda_cursor *cursor, int16_t *dst)
     {
         return -1;
     }
-    if (value > MAXINT16 || value < -MAXINT16 - 1)
-    {
-        coda_set_error(CODA_ERROR_PRODUCT, "product error detected (value for ascii integer too large for int16)");
-        return -1;
-    }
-    *dst = (int16_t)value;
 
-    return 0;
+    return store_int64_value(value, coda_native_type_int16, dst);
 }
 
 int coda_ascii_cursor_read_uint16(const coda_cursor *cursor, uint16_t *dst)
@@ -1248,14 +1622,8 @@ int coda_ascii_cursor_read_uint16(const coda_cursor *cursor, uint16_t *dst)
     {
         return -1;
     }
-    if (value > MAXUINT16)
-    {
-        coda_set_error(CODA_ERROR_PRODUCT, "product error detected (value for ascii integer too large for uint16)");
-        return -1;
-    }
-    *dst = (uint16_t)value;
 
-    return 0;
+    return store_uint64_value(value, coda_native_type_uint16, dst);
 }
 
 int coda_ascii_cursor_read_int32(const coda_cursor *cursor, int32_t *dst)
@@ -1266,14 +1634,8 @@ int coda_ascii_cursor_read_int32(const coda_cursor *cursor, int32_t *dst)
     {
         return -1;
     }
-    if (value > MAXINT32 || value < -MAXINT32 - 1)
-    {
-        coda_set_error(CODA_ERROR_PRODUCT, "product error detected (value for ascii integer too large for int32)");
-        return -1;
-    }
-    *dst = (int32_t)value;
 
-    return 0;
+    return store_int64_value(value, coda_native_type_int32, dst);
 }
 
 int coda_ascii_cursor_read_uint32(const coda_cursor *cursor, uint32_t *dst)
@@ -1284,14 +1646,8 @@ int coda_ascii_cursor_read_uint32(const coda_cursor *cursor, uint32_t *dst)
     {
         return -1;
     }
-    if (value > MAXUINT32)
-    {
-        coda_set_error(CODA_ERROR_PRODUCT, "product error detected (value for ascii integer too large for uint32)");
-        return -1;
-    }
-    *dst = (uint32_t)value;
 
-    return 0;
+    return store_uint64_value(value, coda_native_type_uint32, dst);
 }
 
 int coda_ascii_cursor_read_double(const coda_cursor *cursor, double *dst)
@@ -1472,13 +1828,213 @@ int coda_ascii_cursor_read_bytes(const coda_cursor *cursor, uint8_t *dst, int64_
     return read_bytes(cursor->product, (cursor->stack[cursor->n - 1].bit_offset >> 3) + offset, length, dst);
 }
 
+/* Parses a single fixed width ascii number field and stores it as the given native type */
+static int parse_fixed_width_number(const char *field, long width, coda_native_type read_type, uint8_t *dst)
+{
+    switch (read_type)
+    {
+        case coda_native_type_int8:
+        case coda_native_type_int16:
+        case coda_native_type_int32:
+        case coda_native_type_int64:
+            {
+                int64_t value;
+
+                if (coda_ascii_parse_int64(field, width, &value, 0) < 0)
+                {
+                    return -1;
+                }
+                return store_int64_value(value, read_type, dst);
+            }
+        case coda_native_type_uint8:
+        case coda_native_type_uint16:
+        case coda_native_type_uint32:
+        case coda_native_type_uint64:
+            {
+                uint64_t value;
+
+                if (coda_ascii_parse_uint64(field, width, &value, 0) < 0)
+                {
+                    return -1;
+                }
+                return store_uint64_value(value, read_type, dst);
+            }
+        case coda_native_type_float:
+            {
+                double value;
+
+                if (coda_ascii_parse_double(field, width, &value, 0) < 0)
+                {
+                    return -1;
+                }
+                *(float *)dst = (float)value;
+            }
+            return 0;
+        case coda_native_type_double:
+            if (coda_ascii_parse_double(field, width, (double *)dst, 0) < 0)
+            {
+                return -1;
+            }
+            return 0;
+        default:
+            break;
+    }
+
+    assert(0);
+    exit(1);
+}
+
+/* Reads the array elements [offset, offset + length) if the elements are ascii numbers with a fixed width and without
+ * mappings. Such elements are stored contiguously, so instead of positioning a cursor on each element and reading it
+ * separately, the byte range of the elements is read at once (or accessed directly in memory) and sliced into fields
+ * that are parsed in a single loop.
+ * Returns 1 if the elements were read, 0 if the array does not qualify (the caller should read the elements one by
+ * one), and -1 on error.
+ */
+static int read_fixed_width_number_array(const coda_cursor *cursor, coda_native_type read_type, long offset,
+                                         long length, uint8_t *dst, int basic_type_size)
+{
+    coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
+    coda_type_number *base_type = (coda_type_number *)type->base_type;
+    coda_cursor element_cursor;
+    int64_t bit_size_boundary;
+    int64_t byte_offset;
+    const char *data;
+    char *buffer = NULL;
+    long block_length;
+    long width;
+    long i;
+
+    if ((base_type->type_class != coda_integer_class && base_type->type_class != coda_real_class) ||
+        base_type->bit_size <= 0 || (base_type->bit_size & 0x7) != 0 ||
+        (base_type->bit_size >> 3) > MAX_ASCII_NUMBER_LENGTH || base_type->mappings != NULL || length <= 0)
+    {
+        return 0;
+    }
+
+    element_cursor = *cursor;
+    if (coda_cursor_goto_array_element_by_index(&element_cursor, offset) != 0)
+    {
+        return -1;
+    }
+    if (element_cursor.stack[element_cursor.n - 1].bit_offset & 0x7)
+    {
+        return 0;
+    }
+    width = (long)(base_type->bit_size >> 3);
+    if (get_bit_size_boundary(&element_cursor, &bit_size_boundary, length * base_type->bit_size) != 0)
+    {
+        return -1;
+    }
+    byte_offset = element_cursor.stack[element_cursor.n - 1].bit_offset >> 3;
+
+    if (cursor->product->mem_ptr != NULL)
+    {
+        /* character data can be parsed directly from memory */
+        data = (const char *)cursor->product->mem_ptr + byte_offset;
+        block_length = length;
+    }
+    else
+    {
+        block_length = ASCII_ARRAY_BLOCK_SIZE / width;
+        if (block_length > length)
+        {
+            block_length = length;
+        }
+        buffer = malloc(block_length * width);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)(block_length * width), __FILE__, __LINE__);
+            return -1;
+        }
+        data = buffer;
+    }
+
+    for (i = 0; i < length; i += block_length)
+    {
+        long num_fields = (length - i < block_length ? length - i : block_length);
+        long j;
+
+        if (buffer != NULL)
+        {
+            if (read_bytes_in_bounds(cursor->product, byte_offset + i * width, num_fields * width, buffer) != 0)
+            {
+                free(buffer);
+                return -1;
+            }
+        }
+        else
+        {
+            data = (const char *)cursor->product->mem_ptr + byte_offset + i * width;
+        }
+        for (j = 0; j < num_fields; j++)
+        {
+            if (parse_fixed_width_number(&data[j * width], width, read_type, &dst[(i + j) * basic_type_size]) != 0)
+            {
+                if (buffer != NULL)
+                {
+                    free(buffer);
+                }
+                return -1;
+            }
+        }
+    }
+
+    if (buffer != NULL)
+    {
+        free(buffer);
+    }
+
+    return 1;
+}
+
+static int read_number_array(const coda_cursor *cursor, read_function read_basic_type_function,
+                             coda_native_type read_type, uint8_t *dst, int basic_type_size)
+{
+    long num_elements;
+
+    if (coda_cursor_get_num_elements(cursor, &num_elements) != 0)
+    {
+        return -1;
+    }
+    switch (read_fixed_width_number_array(cursor, read_type, 0, num_elements, dst, basic_type_size))
+    {
+        case 0:
+            break;
+        case 1:
+            return 0;
+        default:
+            return -1;
+    }
+
+    return read_array(cursor, read_basic_type_function, dst, basic_type_size, coda_array_ordering_c);
+}
+
+static int read_number_partial_array(const coda_cursor *cursor, read_function read_basic_type_function,
+                                     coda_native_type read_type, long offset, long length, uint8_t *dst,
+                                     int basic_type_size)
+{
+    switch (read_fixed_width_number_array(cursor, read_type, offset, length, dst, basic_type_size))
+    {
+        case 0:
+            break;
+        case 1:
+            return 0;
+        default:
+            return -1;
+    }
+
+    return read_partial_array(cursor, read_basic_type_function, offset, length, dst, basic_type_size);
+}
+
 int coda_ascii_cursor_read_int8_array(const coda_cursor *cursor, int8_t *dst, coda_array_ordering array_ordering)
 {
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_int8, (uint8_t *)dst, sizeof(int8_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_int8, coda_native_type_int8,
+                          (uint8_t *)dst, sizeof(int8_t)) != 0)
     {
         return -1;
     }
@@ -1497,8 +2053,8 @@ int coda_ascii_cursor_read_uint8_array(const coda_cursor *cursor, uint8_t *dst,
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_uint8, (uint8_t *)dst, sizeof(uint8_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_uint8, coda_native_type_uint8,
+                          (uint8_t *)dst, sizeof(uint8_t)) != 0)
     {
         return -1;
     }
@@ -1517,8 +2073,8 @@ int coda_ascii_cursor_read_int16_array(const coda_cursor *cursor, int16_t *dst,
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_int16, (uint8_t *)dst, sizeof(int16_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_int16, coda_native_type_int16,
+                          (uint8_t *)dst, sizeof(int16_t)) != 0)
     {
         return -1;
     }
@@ -1537,8 +2093,8 @@ int coda_ascii_cursor_read_uint16_array(const coda_cursor *cursor, uint16_t *dst
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_uint16, (uint8_t *)dst, sizeof(uint16_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_uint16, coda_native_type_uint16,
+                          (uint8_t *)dst, sizeof(uint16_t)) != 0)
     {
         return -1;
     }
@@ -1557,8 +2113,8 @@ int coda_ascii_cursor_read_int32_array(const coda_cursor *cursor, int32_t *dst,
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_int32, (uint8_t *)dst, sizeof(int32_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_int32, coda_native_type_int32,
+                          (uint8_t *)dst, sizeof(int32_t)) != 0)
     {
         return -1;
     }
@@ -1577,8 +2133,8 @@ int coda_ascii_cursor_read_uint32_array(const coda_cursor *cursor, uint32_t *dst
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_uint32, (uint8_t *)dst, sizeof(uint32_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_uint32, coda_native_type_uint32,
+                          (uint8_t *)dst, sizeof(uint32_t)) != 0)
     {
         return -1;
     }
@@ -1597,8 +2153,8 @@ int coda_ascii_cursor_read_int64_array(const coda_cursor *cursor, int64_t *dst,
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_int64, (uint8_t *)dst, sizeof(int64_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_int64, coda_native_type_int64,
+                          (uint8_t *)dst, sizeof(int64_t)) != 0)
     {
         return -1;
     }
@@ -1617,8 +2173,8 @@ int coda_ascii_cursor_read_uint64_array(const coda_cursor *cursor, uint64_t *dst
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_uint64, (uint8_t *)dst, sizeof(uint64_t),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_uint64, coda_native_type_uint64,
+                          (uint8_t *)dst, sizeof(uint64_t)) != 0)
     {
         return -1;
     }
@@ -1637,8 +2193,8 @@ int coda_ascii_cursor_read_float_array(const coda_cursor *cursor, float *dst, co
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_float, (uint8_t *)dst, sizeof(float),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_float, coda_native_type_float,
+                          (uint8_t *)dst, sizeof(float)) != 0)
     {
         return -1;
     }
@@ -1657,8 +2213,8 @@ int coda_ascii_cursor_read_double_array(const coda_cursor *cursor, double *dst,
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    if (read_array(cursor, (read_function)&coda_ascii_cursor_read_double, (uint8_t *)dst, sizeof(double),
-                   coda_array_ordering_c) != 0)
+    if (read_number_array(cursor, (read_function)&coda_ascii_cursor_read_double, coda_native_type_double,
+                          (uint8_t *)dst, sizeof(double)) != 0)
     {
         return -1;
     }
@@ -1697,8 +2253,8 @@ int coda_ascii_cursor_read_int8_partial_array(const coda_cursor *cursor, long of
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int8, offset, length, (uint8_t *)dst,
-                              sizeof(int8_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int8,
+                                     coda_native_type_int8, offset, length, (uint8_t *)dst, sizeof(int8_t));
 }
 
 int coda_ascii_cursor_read_uint8_partial_array(const coda_cursor *cursor, long offset, long length, uint8_t *dst)
@@ -1706,8 +2262,8 @@ int coda_ascii_cursor_read_uint8_partial_array(const coda_cursor *cursor, long o
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint8, offset, length, (uint8_t *)dst,
-                              sizeof(uint8_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint8,
+                                     coda_native_type_uint8, offset, length, (uint8_t *)dst, sizeof(uint8_t));
 }
 
 int coda_ascii_cursor_read_int16_partial_array(const coda_cursor *cursor, long offset, long length, int16_t *dst)
@@ -1715,8 +2271,8 @@ int coda_ascii_cursor_read_int16_partial_array(const coda_cursor *cursor, long o
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int16, offset, length, (uint8_t *)dst,
-                              sizeof(int16_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int16,
+                                     coda_native_type_int16, offset, length, (uint8_t *)dst, sizeof(int16_t));
 }
 
 int coda_ascii_cursor_read_uint16_partial_array(const coda_cursor *cursor, long offset, long length, uint16_t *dst)
@@ -1724,8 +2280,8 @@ int coda_ascii_cursor_read_uint16_partial_array(const coda_cursor *cursor, long
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint16, offset, length, (uint8_t *)dst,
-                              sizeof(uint16_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint16,
+                                     coda_native_type_uint16, offset, length, (uint8_t *)dst, sizeof(uint16_t));
 }
 
 int coda_ascii_cursor_read_int32_partial_array(const coda_cursor *cursor, long offset, long length, int32_t *dst)
@@ -1733,8 +2289,8 @@ int coda_ascii_cursor_read_int32_partial_array(const coda_cursor *cursor, long o
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int32, offset, length, (uint8_t *)dst,
-                              sizeof(int32_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int32,
+                                     coda_native_type_int32, offset, length, (uint8_t *)dst, sizeof(int32_t));
 }
 
 int coda_ascii_cursor_read_uint32_partial_array(const coda_cursor *cursor, long offset, long length, uint32_t *dst)
@@ -1742,8 +2298,8 @@ int coda_ascii_cursor_read_uint32_partial_array(const coda_cursor *cursor, long
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint32, offset, length, (uint8_t *)dst,
-                              sizeof(uint32_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint32,
+                                     coda_native_type_uint32, offset, length, (uint8_t *)dst, sizeof(uint32_t));
 }
 
 int coda_ascii_cursor_read_int64_partial_array(const coda_cursor *cursor, long offset, long length, int64_t *dst)
@@ -1751,8 +2307,8 @@ int coda_ascii_cursor_read_int64_partial_array(const coda_cursor *cursor, long o
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int64, offset, length, (uint8_t *)dst,
-                              sizeof(int64_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_int64,
+                                     coda_native_type_int64, offset, length, (uint8_t *)dst, sizeof(int64_t));
 }
 
 int coda_ascii_cursor_read_uint64_partial_array(const coda_cursor *cursor, long offset, long length, uint64_t *dst)
@@ -1760,8 +2316,8 @@ int coda_ascii_cursor_read_uint64_partial_array(const coda_cursor *cursor, long
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint64, offset, length, (uint8_t *)dst,
-                              sizeof(uint64_t));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_uint64,
+                                     coda_native_type_uint64, offset, length, (uint8_t *)dst, sizeof(uint64_t));
 }
 
 int coda_ascii_cursor_read_float_partial_array(const coda_cursor *cursor, long offset, long length, float *dst)
@@ -1769,8 +2325,8 @@ int coda_ascii_cursor_read_float_partial_array(const coda_cursor *cursor, long o
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_float, offset, length, (uint8_t *)dst,
-                              sizeof(float));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_float,
+                                     coda_native_type_float, offset, length, (uint8_t *)dst, sizeof(float));
 }
 
 int coda_ascii_cursor_read_double_partial_array(const coda_cursor *cursor, long offset, long length, double *dst)
@@ -1778,8 +2334,8 @@ int coda_ascii_cursor_read_double_partial_array(const coda_cursor *cursor, long
     coda_type_array *type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
 
     assert(type->base_type->format == coda_format_ascii);
-    return read_partial_array(cursor, (read_function)&coda_ascii_cursor_read_double, offset, length, (uint8_t *)dst,
-                              sizeof(double));
+    return read_number_partial_array(cursor, (read_function)&coda_ascii_cursor_read_double,
+                                     coda_native_type_double, offset, length, (uint8_t *)dst, sizeof(double));
 }
 
 int coda_ascii_cursor_read_char_partial_array(const coda_cursor *cursor, long offset, long length, char *dst)
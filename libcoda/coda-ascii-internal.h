@@ -66,7 +66,7 @@ struct coda_ascii_product_struct
     /* 'ascii' product specific fields */
     eol_type end_of_line;
     long num_asciilines;
-    long *asciiline_end_offset; /* byte offset of the termination of the line (eol or eof) */
+    int64_t *asciiline_end_offset;      /* byte offset of the termination of the line (eol or eof) */
     eol_type lastline_ending;
     coda_type *asciilines;
 };
@@ -45,6 +45,13 @@
 
 #define ASCII_PARSE_BLOCK_SIZE 4096
 
+/* size of the blocks that are read when building the line index of a product that is not memory mapped */
+#define ASCII_LINE_INDEX_BLOCK_SIZE (1024 * 1024)
+
+/* minimum size and maximum number of the chunks that are scanned in parallel when building the line index */
+#define ASCII_LINE_INDEX_CHUNK_SIZE (16 * 1024 * 1024)
+#define ASCII_LINE_INDEX_MAX_CHUNKS 256
+
 int coda_ascii_reopen_with_definition(coda_product **product, const coda_product_definition *definition)
 {
     coda_ascii_product *product_file;
@@ -172,142 +179,472 @@ static int verify_eol_type(coda_ascii_product *product_file, eol_type end_of_lin
     return 0;
 }
 
-int coda_ascii_init_asciilines(coda_product *product)
+/* the line index of a product is built from chunks of the file that are scanned independently (and in parallel if
+ * OpenMP is available); the chunk results are merged afterwards
+ */
+typedef struct line_index_chunk_struct
 {
-    char buffer[ASCII_PARSE_BLOCK_SIZE + 1];
-    coda_ascii_product *product_file = (coda_ascii_product *)product;
-    long num_asciilines = 0;
-    long *asciiline_end_offset = NULL;
-    int64_t byte_offset = 0;
-    char lastchar = '\0';       /* last character of previous block */
-    eol_type lastline_ending = eol_unknown;
+    long num_lines;
+    long max_lines;
+    int64_t *line_end_offset;
+    eol_type first_eol; /* first end-of-line sequence in the chunk */
+    eol_type other_eol; /* first end-of-line sequence in the chunk that differs from first_eol */
+    eol_type last_eol;  /* last end-of-line sequence in the chunk */
+    int out_of_memory;
+} line_index_chunk;
+
+static void line_index_chunk_init(line_index_chunk *chunk)
+{
+    chunk->num_lines = 0;
+    chunk->max_lines = 0;
+    chunk->line_end_offset = NULL;
+    chunk->first_eol = eol_unknown;
+    chunk->other_eol = eol_unknown;
+    chunk->last_eol = eol_unknown;
+    chunk->out_of_memory = 0;
+}
 
-    assert(product_file->num_asciilines == -1);
+static int line_index_chunk_add(line_index_chunk *chunk, int64_t line_end_offset, eol_type end_of_line)
+{
+    if (chunk->num_lines == chunk->max_lines)
+    {
+        long max_lines = (chunk->max_lines == 0 ? ASCII_PARSE_BLOCK_SIZE : 2 * chunk->max_lines);
+        int64_t *new_offset;
+
+        /* we can't use coda_set_error() here since this function may be called from a worker thread */
+        new_offset = realloc(chunk->line_end_offset, max_lines * sizeof(int64_t));
+        if (new_offset == NULL)
+        {
+            chunk->out_of_memory = 1;
+            return -1;
+        }
+        chunk->line_end_offset = new_offset;
+        chunk->max_lines = max_lines;
+    }
+    chunk->line_end_offset[chunk->num_lines] = line_end_offset;
+    chunk->num_lines++;
+
+    if (chunk->first_eol == eol_unknown)
+    {
+        chunk->first_eol = end_of_line;
+    }
+    else if (end_of_line != chunk->first_eol && chunk->other_eol == eol_unknown)
+    {
+        chunk->other_eol = end_of_line;
+    }
+    chunk->last_eol = end_of_line;
+
+    return 0;
+}
 
-    if (!product_file->use_mmap)
+/* Find all end-of-line sequences in data[0..length), where data starts at file offset base_offset.
+ * A '\r' at the end of data is treated as a CR end-of-line, so data should not end between the '\r' and '\n' of a
+ * CRLF sequence (unless it is the end of the file).
+ */
+static int line_index_chunk_scan(line_index_chunk *chunk, const char *data, long length, int64_t base_offset)
+{
+    const char *end = data + length;
+    const char *next_cr;
+    const char *next_lf;
+
+    /* memchr is much faster than a byte by byte comparison (C libraries use vectorized implementations) */
+    next_cr = memchr(data, '\r', (size_t)length);
+    next_lf = memchr(data, '\n', (size_t)length);
+    while (next_cr != NULL || next_lf != NULL)
     {
-        if (lseek(product_file->fd, 0, SEEK_SET) < 0)
+        const char *next_line;
+        eol_type end_of_line;
+
+        if (next_lf != NULL && (next_cr == NULL || next_lf < next_cr))
+        {
+            next_line = next_lf + 1;
+            end_of_line = eol_lf;
+        }
+        else if (next_cr + 1 < end && next_cr[1] == '\n')
+        {
+            next_line = next_cr + 2;
+            end_of_line = eol_crlf;
+        }
+        else
+        {
+            next_line = next_cr + 1;
+            end_of_line = eol_cr;
+        }
+        if (line_index_chunk_add(chunk, base_offset + (next_line - data), end_of_line) != 0)
         {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not move to start of file (%s)", strerror(errno));
             return -1;
         }
+        if (next_cr != NULL && next_cr < next_line)
+        {
+            next_cr = memchr(next_line, '\r', (size_t)(end - next_line));
+        }
+        if (next_lf != NULL && next_lf < next_line)
+        {
+            next_lf = memchr(next_line, '\n', (size_t)(end - next_line));
+        }
     }
 
-    for (;;)
+    return 0;
+}
+
+static int line_index_scan_file(coda_ascii_product *product_file, line_index_chunk *chunk)
+{
+    char *buffer;
+    int64_t byte_offset = 0;
+
+    buffer = malloc(ASCII_LINE_INDEX_BLOCK_SIZE);
+    if (buffer == NULL)
     {
-        int64_t blocksize = ASCII_PARSE_BLOCK_SIZE;
-        long i;
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)ASCII_LINE_INDEX_BLOCK_SIZE, __FILE__, __LINE__);
+        return -1;
+    }
+
+    while (byte_offset < product_file->file_size)
+    {
+        long blocksize = ASCII_LINE_INDEX_BLOCK_SIZE;
 
         if (byte_offset + blocksize > product_file->file_size)
         {
-            blocksize = product_file->file_size - byte_offset;
+            blocksize = (long)(product_file->file_size - byte_offset);
+        }
+        if (read_bytes((coda_product *)product_file, byte_offset, blocksize, buffer) != 0)
+        {
+            free(buffer);
+            return -1;
         }
-        if (blocksize == 0)
+        if (byte_offset + blocksize < product_file->file_size && buffer[blocksize - 1] == '\r')
         {
-            break;
+            /* the '\r' may be part of a CRLF sequence -> include it in the next block */
+            blocksize--;
         }
-        if (read_bytes((coda_product *)product_file, byte_offset, blocksize, buffer) != 0)
+        if (line_index_chunk_scan(chunk, buffer, blocksize, byte_offset) != 0)
         {
+            free(buffer);
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate line index) (%s:%u)",
+                           __FILE__, __LINE__);
             return -1;
         }
+        byte_offset += blocksize;
+    }
+
+    free(buffer);
+
+    return 0;
+}
+
+int coda_ascii_init_asciilines(coda_product *product)
+{
+    coda_ascii_product *product_file = (coda_ascii_product *)product;
+    line_index_chunk *chunk;
+    long num_chunks = 1;
+    long num_asciilines;
+    int64_t *asciiline_end_offset;
+    eol_type lastline_ending = eol_unknown;
+    long i;
+
+    assert(product_file->num_asciilines == -1);
+
+#ifdef _OPENMP
+    if (product_file->use_mmap)
+    {
+        num_chunks = (long)(product_file->file_size / ASCII_LINE_INDEX_CHUNK_SIZE);
+        if (num_chunks > ASCII_LINE_INDEX_MAX_CHUNKS)
+        {
+            num_chunks = ASCII_LINE_INDEX_MAX_CHUNKS;
+        }
+        if (num_chunks < 1)
+        {
+            num_chunks = 1;
+        }
+    }
+#endif
 
-        if (lastchar == '\r' && buffer[0] != '\n')
+    chunk = malloc(num_chunks * sizeof(line_index_chunk));
+    if (chunk == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_chunks * sizeof(line_index_chunk), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_chunks; i++)
+    {
+        line_index_chunk_init(&chunk[i]);
+    }
+
+    if (product_file->use_mmap)
+    {
+        const char *data = (const char *)product_file->mem_ptr;
+        int64_t *chunk_offset;
+
+        chunk_offset = malloc((num_chunks + 1) * sizeof(int64_t));
+        if (chunk_offset == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (num_chunks + 1) * sizeof(int64_t), __FILE__, __LINE__);
+            free(chunk);
+            return -1;
+        }
+        chunk_offset[0] = 0;
+        for (i = 1; i < num_chunks; i++)
         {
-            if (verify_eol_type(product_file, eol_cr) != 0)
+            chunk_offset[i] = i * (product_file->file_size / num_chunks);
+            /* don't split a CRLF sequence */
+            if (data[chunk_offset[i] - 1] == '\r' && data[chunk_offset[i]] == '\n')
             {
-                free(asciiline_end_offset);
-                return -1;
+                chunk_offset[i]++;
             }
         }
+        chunk_offset[num_chunks] = product_file->file_size;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (num_chunks > 1)
+#endif
+        for (i = 0; i < num_chunks; i++)
+        {
+            line_index_chunk_scan(&chunk[i], &data[chunk_offset[i]], (long)(chunk_offset[i + 1] - chunk_offset[i]),
+                                  chunk_offset[i]);
+        }
+        free(chunk_offset);
+    }
+    else if (line_index_scan_file(product_file, &chunk[0]) != 0)
+    {
+        free(chunk[0].line_end_offset);
+        free(chunk);
+        return -1;
+    }
+
+    /* merge the chunks (in file order, so the end-of-line consistency errors are the same as for a sequential scan) */
+    num_asciilines = 0;
+    for (i = 0; i < num_chunks; i++)
+    {
+        if (chunk[i].out_of_memory)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate line index) (%s:%u)",
+                           __FILE__, __LINE__);
+            break;
+        }
+        if (chunk[i].first_eol != eol_unknown && verify_eol_type(product_file, chunk[i].first_eol) != 0)
+        {
+            break;
+        }
+        if (chunk[i].other_eol != eol_unknown && verify_eol_type(product_file, chunk[i].other_eol) != 0)
+        {
+            break;
+        }
+        if (chunk[i].num_lines > 0)
+        {
+            lastline_ending = chunk[i].last_eol;
+        }
+        num_asciilines += chunk[i].num_lines;
+    }
+    if (i < num_chunks)
+    {
+        for (i = 0; i < num_chunks; i++)
+        {
+            free(chunk[i].line_end_offset);
+        }
+        free(chunk);
+        return -1;
+    }
+
+    /* reserve one extra entry for a last line that is terminated by the end of the file */
+    if (num_chunks == 1 && chunk[0].num_lines < chunk[0].max_lines)
+    {
+        asciiline_end_offset = chunk[0].line_end_offset;
+    }
+    else
+    {
+        int64_t *offset;
 
-        for (i = 0; i < blocksize; i++)
+        asciiline_end_offset = malloc((num_asciilines + 1) * sizeof(int64_t));
+        if (asciiline_end_offset == NULL)
         {
-            if (i == 0 && lastchar == '\r' && buffer[0] == '\n')
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (num_asciilines + 1) * sizeof(int64_t), __FILE__, __LINE__);
+            for (i = 0; i < num_chunks; i++)
             {
-                asciiline_end_offset[num_asciilines - 1]++;
-                lastline_ending = eol_crlf;
-                if (verify_eol_type(product_file, eol_crlf) != 0)
-                {
-                    free(asciiline_end_offset);
-                    return -1;
-                }
+                free(chunk[i].line_end_offset);
             }
-            else if (buffer[i] == '\r' || buffer[i] == '\n' || byte_offset + i == product_file->file_size - 1)
+            free(chunk);
+            return -1;
+        }
+        offset = asciiline_end_offset;
+        for (i = 0; i < num_chunks; i++)
+        {
+            if (chunk[i].num_lines > 0)
             {
-                if (num_asciilines % BLOCK_SIZE == 0)
-                {
-                    long *new_offset;
-
-                    new_offset = realloc(asciiline_end_offset, (num_asciilines + BLOCK_SIZE) * sizeof(long));
-                    if (new_offset == NULL)
-                    {
-                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                                       (num_asciilines + BLOCK_SIZE) * sizeof(long), __FILE__, __LINE__);
-                        if (asciiline_end_offset != NULL)
-                        {
-                            free(asciiline_end_offset);
-                        }
-                        return -1;
-                    }
-                    asciiline_end_offset = new_offset;
-                }
-                asciiline_end_offset[num_asciilines] = (long)byte_offset + i + 1;
-                num_asciilines++;
-                lastline_ending = eol_unknown;
-                if (buffer[i] == '\n')
-                {
-                    lastline_ending = eol_lf;
-                    if (verify_eol_type(product_file, eol_lf) != 0)
-                    {
-                        free(asciiline_end_offset);
-                        return -1;
-                    }
-                }
-                else if (buffer[i] == '\r')
-                {
-                    lastline_ending = eol_cr;
-                    if (i < blocksize - 1)
-                    {
-                        if (buffer[i + 1] == '\n')
-                        {
-                            lastline_ending = eol_crlf;
-                            if (verify_eol_type(product_file, eol_crlf) != 0)
-                            {
-                                free(asciiline_end_offset);
-                                return -1;
-                            }
-                            asciiline_end_offset[num_asciilines - 1]++;
-                            i++;
-                        }
-                        else
-                        {
-                            if (verify_eol_type(product_file, eol_cr) != 0)
-                            {
-                                free(asciiline_end_offset);
-                                return -1;
-                            }
-                        }
-                    }
-                }
+                memcpy(offset, chunk[i].line_end_offset, chunk[i].num_lines * sizeof(int64_t));
+                offset += chunk[i].num_lines;
             }
+            free(chunk[i].line_end_offset);
         }
+    }
+    free(chunk);
 
-        lastchar = buffer[blocksize - 1];
-        byte_offset += blocksize;
+    if (product_file->file_size > 0 &&
+        (num_asciilines == 0 || asciiline_end_offset[num_asciilines - 1] != product_file->file_size))
+    {
+        /* last line is terminated by the end of the file */
+        asciiline_end_offset[num_asciilines] = product_file->file_size;
+        num_asciilines++;
+        lastline_ending = eol_unknown;
+    }
+
+    product_file->num_asciilines = num_asciilines;
+    product_file->asciiline_end_offset = asciiline_end_offset;
+    product_file->lastline_ending = lastline_ending;
+
+    return 0;
+}
+
+#define LINE_SCANNER_BLOCK_SIZE 65536
+
+/* Sequential line reader for the ascii based formats that are fully ingested into memory (RINEX, SP3).
+ * For memory mapped products the returned lines point directly into the mapped file (no copying takes place).
+ * Otherwise the file is read in large blocks into an internal buffer that is grown when a line does not fit.
+ */
+void coda_ascii_line_scanner_init(coda_ascii_line_scanner *scanner, coda_product *raw_product)
+{
+    scanner->raw_product = raw_product;
+    scanner->offset = 0;
+    scanner->next_offset = 0;
+    scanner->buffer = NULL;
+    scanner->buffer_size = 0;
+    scanner->buffer_offset = 0;
+    scanner->buffer_length = 0;
+}
+
+void coda_ascii_line_scanner_done(coda_ascii_line_scanner *scanner)
+{
+    if (scanner->buffer != NULL)
+    {
+        free(scanner->buffer);
+        scanner->buffer = NULL;
     }
+    scanner->buffer_size = 0;
+    scanner->buffer_length = 0;
+}
+
+static int line_scanner_fill_buffer(coda_ascii_line_scanner *scanner)
+{
+    coda_bin_product *raw_product = (coda_bin_product *)scanner->raw_product;
+    int64_t read_offset;
+    long remaining;
+    long length;
+
+    /* keep the (partial) current line and move it to the start of the buffer */
+    remaining = scanner->buffer_length - (long)(scanner->offset - scanner->buffer_offset);
+    if (remaining < 0)
+    {
+        remaining = 0;
+    }
+    if (remaining > 0)
+    {
+        memmove(scanner->buffer, &scanner->buffer[scanner->buffer_length - remaining], remaining);
+    }
+    scanner->buffer_offset = scanner->offset;
+    scanner->buffer_length = remaining;
 
-    if (lastchar == '\r')
+    if (scanner->buffer_length == scanner->buffer_size)
     {
-        if (verify_eol_type(product_file, eol_cr) != 0)
+        long new_size = (scanner->buffer_size == 0 ? LINE_SCANNER_BLOCK_SIZE : 2 * scanner->buffer_size);
+        char *new_buffer;
+
+        new_buffer = realloc(scanner->buffer, new_size);
+        if (new_buffer == NULL)
         {
-            free(asciiline_end_offset);
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %ld bytes) (%s:%u)",
+                           new_size, __FILE__, __LINE__);
             return -1;
         }
+        scanner->buffer = new_buffer;
+        scanner->buffer_size = new_size;
     }
 
-    product_file->num_asciilines = num_asciilines;
-    product_file->asciiline_end_offset = asciiline_end_offset;
-    product_file->lastline_ending = lastline_ending;
+    read_offset = scanner->buffer_offset + scanner->buffer_length;
+    length = scanner->buffer_size - scanner->buffer_length;
+    if (read_offset + length > raw_product->file_size)
+    {
+        length = (long)(raw_product->file_size - read_offset);
+    }
+    if (length > 0)
+    {
+        if (read_bytes(scanner->raw_product, read_offset, length, &scanner->buffer[scanner->buffer_length]) != 0)
+        {
+            return -1;
+        }
+        scanner->buffer_length += length;
+    }
 
     return 0;
 }
+
+/* Returns the length of the next line (excluding the line ending), 0 at the end of the file, or -1 on error.
+ * The returned line is not zero terminated and remains valid until the next call.
+ */
+long coda_ascii_line_scanner_get_line(coda_ascii_line_scanner *scanner, const char **line)
+{
+    coda_bin_product *raw_product = (coda_bin_product *)scanner->raw_product;
+    const char *data;
+    const char *end_of_line;
+    int64_t available;
+    long length;
+
+    scanner->offset = scanner->next_offset;
+    if (scanner->offset >= raw_product->file_size)
+    {
+        *line = "";
+        return 0;
+    }
+
+    if (raw_product->use_mmap)
+    {
+        data = (const char *)&raw_product->mem_ptr[scanner->offset];
+        available = raw_product->file_size - scanner->offset;
+        end_of_line = memchr(data, '\n', (size_t)available);
+    }
+    else
+    {
+        for (;;)
+        {
+            long start = (long)(scanner->offset - scanner->buffer_offset);
+
+            if (start >= 0 && start < scanner->buffer_length)
+            {
+                data = &scanner->buffer[start];
+                available = scanner->buffer_length - start;
+                end_of_line = memchr(data, '\n', (size_t)available);
+                if (end_of_line != NULL || scanner->buffer_offset + scanner->buffer_length >= raw_product->file_size)
+                {
+                    break;
+                }
+            }
+            if (line_scanner_fill_buffer(scanner) != 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    if (end_of_line != NULL)
+    {
+        length = (long)(end_of_line - data);
+        scanner->next_offset = scanner->offset + length + 1;
+    }
+    else
+    {
+        length = (long)available;
+        scanner->next_offset = raw_product->file_size;
+    }
+
+    /* remove 'carriage return' character if available */
+    if (length > 0 && data[length - 1] == '\r')
+    {
+        length--;
+    }
+
+    *line = data;
+
+    return length;
+}
@@ -38,6 +38,21 @@ long coda_ascii_parse_int64(const char *buffer, long buffer_length, int64_t *dst
 long coda_ascii_parse_uint64(const char *buffer, long buffer_length, uint64_t *dst, int ignore_trailing_bytes);
 long coda_ascii_parse_double(const char *buffer, long buffer_length, double *dst, int ignore_trailing_bytes);
 
+typedef struct coda_ascii_line_scanner_struct
+{
+    coda_product *raw_product;  /* raw binary product (memory mapped or using a file descriptor) */
+    int64_t offset;     /* file offset of the start of the current line */
+    int64_t next_offset;        /* file offset of the start of the next line */
+    char *buffer;       /* read buffer (only used if the product is not memory mapped) */
+    long buffer_size;
+    int64_t buffer_offset;      /* file offset of buffer[0] */
+    long buffer_length; /* number of valid bytes in buffer */
+} coda_ascii_line_scanner;
+
+void coda_ascii_line_scanner_init(coda_ascii_line_scanner *scanner, coda_product *raw_product);
+void coda_ascii_line_scanner_done(coda_ascii_line_scanner *scanner);
+long coda_ascii_line_scanner_get_line(coda_ascii_line_scanner *scanner, const char **line);
+
 int coda_ascii_reopen_with_definition(coda_product **product, const coda_product_definition *definition);
 int coda_ascii_close(coda_product *product);
 
@@ -205,11 +205,30 @@ int coda_cdf_cursor_get_array_dim(const coda_cursor *cursor, int *num_dims, long
     return coda_type_get_array_dim(cursor->stack[cursor->n - 1].type->definition, num_dims, dim);
 }
 
+static int read_record_data(const coda_cursor *cursor, coda_cdf_variable *variable, int record_id,
+                            int64_t local_offset, int64_t size, void *dst)
+{
+    coda_cdf_product *product_file = (coda_cdf_product *)cursor->product;
+
+    if (variable->block_id != NULL && variable->block_id[record_id] >= 0)
+    {
+        int8_t *data;
+
+        if (coda_cdf_get_block_data(product_file, variable, variable->block_id[record_id], &data) != 0)
+        {
+            return -1;
+        }
+        memcpy(dst, &data[variable->offset[record_id] + local_offset], (size_t)size);
+        return 0;
+    }
+
+    return read_bytes(product_file->raw_product, variable->offset[record_id] + local_offset, size, dst);
+}
+
 static int read_array(const coda_cursor *cursor, void *dst)
 {
     coda_cdf_variable *variable = (coda_cdf_variable *)cursor->stack[cursor->n - 1].type;
     coda_type_class type_class;
-    long record_size = variable->num_values_per_record * variable->value_size;
     int i;
 
     assert(variable->tag == tag_cdf_variable);
@@ -222,26 +241,10 @@ static int read_array(const coda_cursor *cursor, void *dst)
         type_class = variable->base_type->definition->type_class;
     }
 
-    for (i = 0; i < variable->num_records; i++)
+    if (coda_cdf_read_records((coda_cdf_product *)cursor->product, variable, 0, variable->num_records - 1,
+                              (uint8_t *)dst) != 0)
     {
-        /* TODO: handle sparse records */
-        if (variable->offset[i] < 0)
-        {
-            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "Missing record not supported for CDF variable");
-            return -1;
-        }
-        if (variable->data != NULL)
-        {
-            memcpy(&((uint8_t *)dst)[i * record_size], &variable->data[variable->offset[i]], record_size);
-        }
-        else
-        {
-            if (read_bytes(((coda_cdf_product *)cursor->product)->raw_product, variable->offset[i], record_size,
-                           &((uint8_t *)dst)[i * record_size]) != 0)
-            {
-                return -1;
-            }
-        }
+        return -1;
     }
     if (type_class != coda_text_class)
     {
@@ -304,7 +307,7 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
     }
 
     record_from_id = offset / variable->num_values_per_record;
-    record_to_id = (offset + length) / variable->num_values_per_record;
+    record_to_id = (offset + length - 1) / variable->num_values_per_record;
     target_offset = 0;
 
     for (i = record_from_id; i <= record_to_id; i++)
@@ -329,18 +332,23 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
             local_size -= local_offset;
         }
 
-        if (variable->data != NULL)
+        if (local_size == record_size)
         {
-            memcpy(&((uint8_t *)dst)[target_offset], &variable->data[variable->offset[i] + local_offset],
-                   (size_t)local_size);
-        }
-        else
-        {
-            if (read_bytes(((coda_cdf_product *)cursor->product)->raw_product, variable->offset[i] + local_offset,
-                           local_size, &((uint8_t *)dst)[target_offset]) != 0)
+            /* read this and all subsequent complete records at once */
+            int num_full_records = (int)((offset + length) / variable->num_values_per_record) - i;
+
+            if (coda_cdf_read_records((coda_cdf_product *)cursor->product, variable, i, i + num_full_records - 1,
+                                      &((uint8_t *)dst)[target_offset]) != 0)
             {
                 return -1;
             }
+            target_offset += (int64_t)num_full_records * record_size;
+            i += num_full_records - 1;
+            continue;
+        }
+        if (read_record_data(cursor, variable, i, local_offset, local_size, &((uint8_t *)dst)[target_offset]) != 0)
+        {
+            return -1;
         }
         target_offset += local_size;
     }
@@ -393,7 +401,6 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long size_bound
     int record_id;
     int element_id;
     int value_size;
-    int64_t offset;
 
     if (((coda_cdf_type *)cursor->stack[cursor->n - 1].type)->tag == tag_cdf_basic_type)
     {
@@ -420,23 +427,14 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long size_bound
         coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "Missing record not supported for CDF variable");
         return -1;
     }
-    offset = variable->offset[record_id] + element_id * variable->value_size;
     if (size_boundary >= 0 && size_boundary < value_size)
     {
         value_size = size_boundary;
     }
-    if ((variable->data != NULL) && (value_size > 0))
-    {
-        if (offset > (variable->num_records * variable->num_values_per_record * variable->value_size))
-        {
-            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "Offset too large in accessing data of CDF variable");
-            return -1;
-        }
-        memcpy(dst, &variable->data[offset], value_size);
-    }
-    else
+    if (value_size > 0)
     {
-        if (read_bytes(((coda_cdf_product *)cursor->product)->raw_product, offset, value_size, dst) != 0)
+        if (read_record_data(cursor, variable, record_id, (int64_t)element_id * variable->value_size, value_size,
+                             dst) != 0)
         {
             return -1;
         }
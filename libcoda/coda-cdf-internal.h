@@ -60,6 +60,20 @@ typedef struct coda_cdf_time_struct
     int32_t data_type;
 } coda_cdf_time;
 
+/* a compressed block of records of a variable (stored in a CVVR record) */
+typedef struct coda_cdf_block_struct
+{
+    int32_t first;      /* first record in the block */
+    int32_t last;       /* last record in the block that is part of the variable */
+    int partial_read;   /* whether the block contains more records than are part of the variable */
+    int64_t offset;     /* file offset of the compressed data */
+    int64_t csize;      /* byte size of the compressed data */
+    int64_t size;       /* byte size of the decompressed data */
+    int8_t *data;       /* decompressed data (will be NULL if the block is not decompressed) */
+    struct coda_cdf_block_struct *prev;  /* previous block in the list of decompressed blocks of the product */
+    struct coda_cdf_block_struct *next;  /* next block in the list of decompressed blocks of the product */
+} coda_cdf_block;
+
 typedef struct coda_cdf_variable_struct
 {
     coda_backend backend;
@@ -72,8 +86,10 @@ typedef struct coda_cdf_variable_struct
     int value_size;
     int sparse_rec_method;      /* 0: no sparse records, 1: padded sparse records, 2: previous sparse records */
     int has_compression;
-    int64_t *offset;    /* file offset for each record - will be offset into 'data' if 'data != NULL' */
-    int8_t *data;
+    int64_t *offset;    /* file offset for each record - will be offset into the block data if 'block_id[i] >= 0' */
+    int *block_id;      /* index into 'block' for each record (-1 if the record is not stored in a compressed block) */
+    int num_blocks;
+    coda_cdf_block *block;
 } coda_cdf_variable;
 
 typedef struct coda_cdf_product_struct
@@ -99,6 +115,10 @@ typedef struct coda_cdf_product_struct
     int has_md5_chksum;
     int32_t rnum_dims;
     int32_t rdim_sizes[CODA_MAX_NUM_DIMS];
+    int64_t cache_size; /* maximum size of all decompressed blocks (0 means no limit) */
+    int64_t cache_used; /* current size of all decompressed blocks */
+    coda_cdf_block *cache_head; /* most recently used decompressed block */
+    coda_cdf_block *cache_tail; /* least recently used decompressed block */
 } coda_cdf_product;
 
 coda_dynamic_type *coda_cdf_variable_new(int32_t data_type, int32_t max_rec, int32_t rec_varys, int32_t num_dims,
@@ -109,4 +129,8 @@ coda_dynamic_type *coda_cdf_variable_new(int32_t data_type, int32_t max_rec, int
 int coda_cdf_variable_add_attribute(coda_cdf_variable *type, const char *real_name, coda_dynamic_type *attribute_type,
                                     int update_definition);
 
+int coda_cdf_get_block_data(coda_cdf_product *product_file, coda_cdf_variable *variable, int block_id, int8_t **data);
+int coda_cdf_read_records(coda_cdf_product *product_file, coda_cdf_variable *variable, int first, int last,
+                          uint8_t *dst);
+
 #endif
@@ -65,9 +65,22 @@ void coda_cdf_type_delete(coda_dynamic_type *type)
                 {
                     free(variable->offset);
                 }
-                if (variable->data != NULL)
+                if (variable->block_id != NULL)
                 {
-                    free(variable->data);
+                    free(variable->block_id);
+                }
+                if (variable->block != NULL)
+                {
+                    int i;
+
+                    for (i = 0; i < variable->num_blocks; i++)
+                    {
+                        if (variable->block[i].data != NULL)
+                        {
+                            free(variable->block[i].data);
+                        }
+                    }
+                    free(variable->block);
                 }
             }
             break;
@@ -285,7 +298,9 @@ coda_dynamic_type *coda_cdf_variable_new(int32_t data_type, int32_t max_rec, int
     type->sparse_rec_method = sparse_rec_method;
     type->has_compression = has_compression;
     type->offset = NULL;
-    type->data = NULL;
+    type->block_id = NULL;
+    type->num_blocks = 0;
+    type->block = NULL;
 
     if (!rec_varys)
     {
@@ -398,6 +413,21 @@ coda_dynamic_type *coda_cdf_variable_new(int32_t data_type, int32_t max_rec, int
     {
         type->offset[i] = -1;
     }
+    if (has_compression)
+    {
+        type->block_id = malloc(type->num_records * sizeof(int));
+        if (type->block_id == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           type->num_records * sizeof(int), __FILE__, __LINE__);
+            coda_cdf_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
+        for (i = 0; i < type->num_records; i++)
+        {
+            type->block_id[i] = -1;
+        }
+    }
 
     *variable = type;
 
@@ -50,6 +50,9 @@
 
 #include "zlib.h"
 
+/* maximum amount of compressed data that is read into memory at once when decompressing multiple blocks */
+#define MAX_COMPRESSED_BATCH_SIZE (64 * 1024 * 1024)
+
 static void rtrim(char *str)
 {
     long length;
@@ -649,47 +652,15 @@ static int read_VR(coda_cdf_product *product_file, coda_cdf_variable *variable,
         {
             last = variable->num_records - 1;
         }
-        if (variable->has_compression)
-        {
-            if (variable->data == NULL)
-            {
-                variable->data = malloc(variable->num_records * variable->num_values_per_record * variable->value_size);
-                if (variable->data == NULL)
-                {
-                    coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                                   (long)variable->num_records * variable->num_values_per_record * variable->value_size,
-                                   __FILE__, __LINE__);
-                    return -1;
-                }
-            }
-            if (read_bytes(product_file->raw_product, offset + 12,
-                           (last - first + 1) * variable->num_values_per_record * variable->value_size,
-                           &variable->data[first * variable->num_values_per_record * variable->value_size]) < 0)
-            {
-                return -1;
-            }
-
-            for (i = first; i <= last; i++)
-            {
-                variable->offset[i] = i * variable->num_values_per_record * variable->value_size;
-            }
-        }
-        else
+        for (i = first; i <= last; i++)
         {
-            for (i = first; i <= last; i++)
-            {
-                variable->offset[i] = offset + 12 +
-                    (i - first) * variable->num_values_per_record * variable->value_size;
-            }
+            variable->offset[i] = offset + 12 + (i - first) * variable->num_values_per_record * variable->value_size;
         }
     }
     else if (record_type == 13)
     {
+        coda_cdf_block *block;
         int64_t csize;
-        Bytef *buffer;
-        z_stream zs;
-        int partial_read = 0;
-        int result;
         int i;
 
         if (!variable->has_compression)
@@ -703,18 +674,6 @@ static int read_VR(coda_cdf_product *product_file, coda_cdf_variable *variable,
             return 0;
         }
 
-        if (variable->data == NULL)
-        {
-            variable->data = malloc(variable->num_records * variable->num_values_per_record * variable->value_size);
-            if (variable->data == NULL)
-            {
-                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                               (long)variable->num_records * variable->num_values_per_record * variable->value_size,
-                               __FILE__, __LINE__);
-                return -1;
-            }
-        }
-
         if (read_bytes(product_file->raw_product, offset + 16, 8, &csize) < 0)
         {
             return -1;
@@ -724,92 +683,47 @@ static int read_VR(coda_cdf_product *product_file, coda_cdf_variable *variable,
 #endif
         offset += 24;
 
-        if (csize < 20)
+        if (csize < 20 || offset + csize > product_file->file_size)
         {
             coda_set_error(CODA_ERROR_PRODUCT, "invalid compressed data block for CDF variable");
             return -1;
         }
-        buffer = malloc((size_t)csize);
-        if (buffer == NULL)
-        {
-            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                           (long)csize, __FILE__, __LINE__);
-            return -1;
-        }
-        if (read_bytes(product_file->raw_product, offset, csize, buffer) < 0)
-        {
-            free(buffer);
-            return -1;
-        }
-        zs.next_in = Z_NULL;
-        zs.avail_in = 0;
-        zs.zalloc = Z_NULL;
-        zs.zfree = Z_NULL;
-        zs.opaque = Z_NULL;
-        zs.msg = NULL;
-        /* windowBits is 15 + 16 (adding 16 means that gzip headers are parsed automatically) */
-        if (inflateInit2(&zs, 31) != Z_OK)
+
+        /* we only store the location of the compressed data; decompression happens when the data is first read */
+        if (variable->num_blocks % BLOCK_SIZE == 0)
         {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not intialize zip decompression");
-            if (zs.msg != NULL)
+            coda_cdf_block *new_block;
+
+            new_block = realloc(variable->block, (variable->num_blocks + BLOCK_SIZE) * sizeof(coda_cdf_block));
+            if (new_block == NULL)
             {
-                coda_add_error_message(" (%s)", zs.msg);
+                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                               (variable->num_blocks + BLOCK_SIZE) * sizeof(coda_cdf_block), __FILE__, __LINE__);
+                return -1;
             }
-            free(buffer);
-            return -1;
+            variable->block = new_block;
         }
-        zs.next_in = buffer;
-        zs.avail_in = (int)csize;
+        block = &variable->block[variable->num_blocks];
+        block->first = first;
+        block->last = last;
+        block->partial_read = 0;
+        block->offset = offset;
+        block->csize = csize;
+        block->data = NULL;
+        block->prev = NULL;
+        block->next = NULL;
         if (last >= variable->num_records)
         {
-            last = variable->num_records - 1;
-            partial_read = 1;
-        }
-        zs.next_out = (Bytef *)&variable->data[first * variable->num_values_per_record * variable->value_size];
-        zs.avail_out = (last - first + 1) * variable->num_values_per_record * variable->value_size;
-        result = inflate(&zs, Z_FINISH);
-        assert(result != Z_STREAM_ERROR);
-        if (result < 0 && !(result == Z_BUF_ERROR && partial_read))
-        {
-            switch (result)
-            {
-                case Z_NEED_DICT:
-                case Z_DATA_ERROR:
-                    coda_set_error(CODA_ERROR_FILE_READ, "invalid or incomplete compressed data for CDF variable");
-                    if (zs.msg != NULL)
-                    {
-                        coda_add_error_message(" (%s)", zs.msg);
-                    }
-                    break;
-                case Z_MEM_ERROR:
-                    coda_set_error(CODA_ERROR_OUT_OF_MEMORY, NULL);
-                    break;
-                default:
-                    coda_set_error(CODA_ERROR_FILE_READ, "error during decompression of CDF variable");
-                    if (zs.msg != NULL)
-                    {
-                        coda_add_error_message(" (%s)", zs.msg);
-                    }
-            }
-            inflateEnd(&zs);
-            free(buffer);
-            return -1;
-        }
-        free(buffer);
-
-        if (inflateEnd(&zs) != Z_OK)
-        {
-            coda_set_error(CODA_ERROR_FILE_READ, "zlib error");
-            if (zs.msg != NULL)
-            {
-                coda_add_error_message(" (%s)", zs.msg);
-            }
-            return -1;
+            block->last = variable->num_records - 1;
+            block->partial_read = 1;
         }
-        for (i = first; i <= last; i++)
+        block->size = (int64_t)(block->last - first + 1) * variable->num_values_per_record * variable->value_size;
+        for (i = first; i <= block->last; i++)
         {
-            variable->offset[i] = i * variable->num_values_per_record * variable->value_size;
+            variable->offset[i] = (i - first) * variable->num_values_per_record * variable->value_size;
+            variable->block_id[i] = variable->num_blocks;
         }
+        variable->num_blocks++;
     }
     else
     {
@@ -1483,6 +1397,467 @@ static int read_file(coda_cdf_product *product_file)
     return 0;
 }
 
+static void cache_remove_block(coda_cdf_product *product_file, coda_cdf_block *block)
+{
+    if (block->prev != NULL)
+    {
+        block->prev->next = block->next;
+    }
+    else
+    {
+        product_file->cache_head = block->next;
+    }
+    if (block->next != NULL)
+    {
+        block->next->prev = block->prev;
+    }
+    else
+    {
+        product_file->cache_tail = block->prev;
+    }
+    block->prev = NULL;
+    block->next = NULL;
+}
+
+static void cache_add_block(coda_cdf_product *product_file, coda_cdf_block *block)
+{
+    block->prev = NULL;
+    block->next = product_file->cache_head;
+    if (product_file->cache_head != NULL)
+    {
+        product_file->cache_head->prev = block;
+    }
+    else
+    {
+        product_file->cache_tail = block;
+    }
+    product_file->cache_head = block;
+}
+
+static int init_inflate(z_stream *zs)
+{
+    zs->next_in = Z_NULL;
+    zs->avail_in = 0;
+    zs->zalloc = Z_NULL;
+    zs->zfree = Z_NULL;
+    zs->opaque = Z_NULL;
+    zs->msg = NULL;
+    /* windowBits is 15 + 16 (adding 16 means that gzip headers are parsed automatically) */
+    return inflateInit2(zs, 31);
+}
+
+/* Decompress a block using an already initialized stream.
+ * This function does not set the CODA error state, so it can be called from multiple threads (each using its own
+ * stream). Returns Z_OK on success or the zlib error code otherwise.
+ */
+static int inflate_block_data(z_stream *zs, const coda_cdf_block *block, const uint8_t *src, int8_t *dst)
+{
+    int result;
+
+    result = inflateReset(zs);
+    if (result != Z_OK)
+    {
+        return result;
+    }
+    zs->next_in = (Bytef *)src;
+    zs->avail_in = (uInt)block->csize;
+    zs->next_out = (Bytef *)dst;
+    zs->avail_out = (uInt)block->size;
+    result = inflate(zs, Z_FINISH);
+    assert(result != Z_STREAM_ERROR);
+    if (result < 0 && !(result == Z_BUF_ERROR && block->partial_read))
+    {
+        return result;
+    }
+
+    return Z_OK;
+}
+
+static void set_inflate_error(int result, const char *msg)
+{
+    switch (result)
+    {
+        case Z_NEED_DICT:
+        case Z_DATA_ERROR:
+            coda_set_error(CODA_ERROR_FILE_READ, "invalid or incomplete compressed data for CDF variable");
+            break;
+        case Z_MEM_ERROR:
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, NULL);
+            return;
+        default:
+            coda_set_error(CODA_ERROR_FILE_READ, "error during decompression of CDF variable");
+            break;
+    }
+    if (msg != NULL)
+    {
+        coda_add_error_message(" (%s)", msg);
+    }
+}
+
+/* Retrieve the compressed data of a block.
+ * If the product is memory mapped then a pointer into the mapped memory is returned, otherwise the data is read into
+ * 'buffer' (which should be at least block->csize bytes large).
+ */
+static int get_compressed_data(coda_cdf_product *product_file, const coda_cdf_block *block, uint8_t *buffer,
+                               const uint8_t **src)
+{
+    if (product_file->raw_product->mem_ptr != NULL)
+    {
+        *src = &product_file->raw_product->mem_ptr[block->offset];
+        return 0;
+    }
+    if (read_bytes(product_file->raw_product, block->offset, block->csize, buffer) < 0)
+    {
+        return -1;
+    }
+    *src = buffer;
+
+    return 0;
+}
+
+static int inflate_block(coda_cdf_product *product_file, coda_cdf_block *block, int8_t *data)
+{
+    const uint8_t *src;
+    uint8_t *buffer = NULL;
+    z_stream zs;
+    int result;
+
+    if (product_file->raw_product->mem_ptr == NULL)
+    {
+        buffer = malloc((size_t)block->csize);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)block->csize, __FILE__, __LINE__);
+            return -1;
+        }
+    }
+    if (get_compressed_data(product_file, block, buffer, &src) != 0)
+    {
+        if (buffer != NULL)
+        {
+            free(buffer);
+        }
+        return -1;
+    }
+    if (init_inflate(&zs) != Z_OK)
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "could not intialize zip decompression");
+        if (zs.msg != NULL)
+        {
+            coda_add_error_message(" (%s)", zs.msg);
+        }
+        if (buffer != NULL)
+        {
+            free(buffer);
+        }
+        return -1;
+    }
+    result = inflate_block_data(&zs, block, src, data);
+    if (buffer != NULL)
+    {
+        free(buffer);
+    }
+    if (result != Z_OK)
+    {
+        set_inflate_error(result, zs.msg);
+        inflateEnd(&zs);
+        return -1;
+    }
+    if (inflateEnd(&zs) != Z_OK)
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "zlib error");
+        if (zs.msg != NULL)
+        {
+            coda_add_error_message(" (%s)", zs.msg);
+        }
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Get the decompressed data of a compressed block of records of a variable.
+ * The block is decompressed on first access. If the total size of decompressed blocks exceeds the cache size of the
+ * product, the least recently used blocks are released again.
+ * The returned pointer is only valid until the next call to this function for the same product.
+ */
+int coda_cdf_get_block_data(coda_cdf_product *product_file, coda_cdf_variable *variable, int block_id, int8_t **data)
+{
+    coda_cdf_block *block;
+
+    assert(block_id >= 0 && block_id < variable->num_blocks);
+    block = &variable->block[block_id];
+    if (block->data != NULL)
+    {
+        if (product_file->cache_head != block)
+        {
+            cache_remove_block(product_file, block);
+            cache_add_block(product_file, block);
+        }
+        *data = block->data;
+        return 0;
+    }
+
+    block->data = malloc((size_t)block->size);
+    if (block->data == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)block->size, __FILE__, __LINE__);
+        return -1;
+    }
+    if (inflate_block(product_file, block, block->data) != 0)
+    {
+        free(block->data);
+        block->data = NULL;
+        return -1;
+    }
+    cache_add_block(product_file, block);
+    product_file->cache_used += block->size;
+
+    /* release least recently used blocks (but never the block that we just decompressed) */
+    while (product_file->cache_size > 0 && product_file->cache_used > product_file->cache_size &&
+           product_file->cache_tail != block)
+    {
+        coda_cdf_block *lru_block = product_file->cache_tail;
+
+        cache_remove_block(product_file, lru_block);
+        product_file->cache_used -= lru_block->size;
+        free(lru_block->data);
+        lru_block->data = NULL;
+    }
+
+    *data = block->data;
+    return 0;
+}
+
+/* Decompress a list of blocks directly into the destination buffer (which starts at record 'first').
+ * If CODA is built with OpenMP support, the blocks are decompressed in parallel.
+ */
+static int inflate_blocks(coda_cdf_product *product_file, coda_cdf_variable *variable, int num_blocks,
+                          const int *block_list, int first, uint8_t *dst)
+{
+    int64_t record_size = (int64_t)variable->num_values_per_record * variable->value_size;
+    const uint8_t **src;
+    const char **msg;
+    uint8_t *buffer = NULL;
+    int64_t buffer_offset;
+    int *result;
+    int i;
+
+    src = malloc(num_blocks * sizeof(uint8_t *));
+    if (src == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_blocks * sizeof(uint8_t *), __FILE__, __LINE__);
+        return -1;
+    }
+    msg = malloc(num_blocks * sizeof(char *));
+    if (msg == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_blocks * sizeof(char *), __FILE__, __LINE__);
+        free(src);
+        return -1;
+    }
+    result = malloc(num_blocks * sizeof(int));
+    if (result == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_blocks * sizeof(int), __FILE__, __LINE__);
+        free(msg);
+        free(src);
+        return -1;
+    }
+    if (product_file->raw_product->mem_ptr == NULL)
+    {
+        int64_t buffer_size = 0;
+
+        for (i = 0; i < num_blocks; i++)
+        {
+            buffer_size += variable->block[block_list[i]].csize;
+        }
+        buffer = malloc((size_t)buffer_size);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)buffer_size, __FILE__, __LINE__);
+            free(result);
+            free(msg);
+            free(src);
+            return -1;
+        }
+    }
+
+    /* reading from the file is done sequentially; only the decompression itself is done in parallel */
+    buffer_offset = 0;
+    for (i = 0; i < num_blocks; i++)
+    {
+        coda_cdf_block *block = &variable->block[block_list[i]];
+
+        if (get_compressed_data(product_file, block, buffer == NULL ? NULL : &buffer[buffer_offset], &src[i]) != 0)
+        {
+            if (buffer != NULL)
+            {
+                free(buffer);
+            }
+            free(result);
+            free(msg);
+            free(src);
+            return -1;
+        }
+        buffer_offset += block->csize;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel if (num_blocks > 1)
+#endif
+    {
+        z_stream zs;
+        int init_result;
+        int j;
+
+        /* each thread reuses a single stream for all its blocks */
+        init_result = init_inflate(&zs);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (j = 0; j < num_blocks; j++)
+        {
+            const coda_cdf_block *block = &variable->block[block_list[j]];
+
+            if (init_result != Z_OK)
+            {
+                result[j] = init_result;
+                msg[j] = zs.msg;
+                continue;
+            }
+            result[j] = inflate_block_data(&zs, block, src[j], (int8_t *)&dst[(block->first - first) * record_size]);
+            msg[j] = zs.msg;
+        }
+        if (init_result == Z_OK)
+        {
+            inflateEnd(&zs);
+        }
+    }
+
+    if (buffer != NULL)
+    {
+        free(buffer);
+    }
+    for (i = 0; i < num_blocks; i++)
+    {
+        if (result[i] != Z_OK)
+        {
+            set_inflate_error(result[i], msg[i]);
+            free(result);
+            free(msg);
+            free(src);
+            return -1;
+        }
+    }
+    free(result);
+    free(msg);
+    free(src);
+
+    return 0;
+}
+
+/* Read the data of records 'first' up to and including 'last' of a variable (without endianness conversion).
+ * Compressed blocks that are fully contained in the range and that are not already decompressed are decompressed
+ * directly into 'dst' (without being kept in the cache of decompressed blocks).
+ */
+int coda_cdf_read_records(coda_cdf_product *product_file, coda_cdf_variable *variable, int first, int last,
+                          uint8_t *dst)
+{
+    int64_t record_size = (int64_t)variable->num_values_per_record * variable->value_size;
+    int64_t pending_size = 0;
+    int num_pending = 0;
+    int *pending = NULL;
+    int i;
+
+    if (variable->num_blocks > 0)
+    {
+        pending = malloc(variable->num_blocks * sizeof(int));
+        if (pending == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           variable->num_blocks * sizeof(int), __FILE__, __LINE__);
+            return -1;
+        }
+    }
+
+    i = first;
+    while (i <= last)
+    {
+        uint8_t *record_dst = &dst[(i - first) * record_size];
+
+        /* TODO: handle sparse records */
+        if (variable->offset[i] < 0)
+        {
+            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "Missing record not supported for CDF variable");
+            if (pending != NULL)
+            {
+                free(pending);
+            }
+            return -1;
+        }
+        if (variable->block_id != NULL && variable->block_id[i] >= 0)
+        {
+            coda_cdf_block *block = &variable->block[variable->block_id[i]];
+            int8_t *data;
+
+            if (block->data == NULL && block->first == i && block->last <= last)
+            {
+                if (num_pending > 0 && pending_size + block->csize > MAX_COMPRESSED_BATCH_SIZE)
+                {
+                    if (inflate_blocks(product_file, variable, num_pending, pending, first, dst) != 0)
+                    {
+                        free(pending);
+                        return -1;
+                    }
+                    num_pending = 0;
+                    pending_size = 0;
+                }
+                pending[num_pending] = variable->block_id[i];
+                num_pending++;
+                pending_size += block->csize;
+                i = block->last + 1;
+                continue;
+            }
+            if (coda_cdf_get_block_data(product_file, variable, variable->block_id[i], &data) != 0)
+            {
+                free(pending);
+                return -1;
+            }
+            memcpy(record_dst, &data[variable->offset[i]], (size_t)record_size);
+        }
+        else if (read_bytes(product_file->raw_product, variable->offset[i], record_size, record_dst) != 0)
+        {
+            if (pending != NULL)
+            {
+                free(pending);
+            }
+            return -1;
+        }
+        i++;
+    }
+    if (num_pending > 0)
+    {
+        if (inflate_blocks(product_file, variable, num_pending, pending, first, dst) != 0)
+        {
+            free(pending);
+            return -1;
+        }
+    }
+    if (pending != NULL)
+    {
+        free(pending);
+    }
+
+    return 0;
+}
+
 int coda_cdf_reopen(coda_product **product)
 {
     coda_cdf_product *product_file;
@@ -1508,6 +1883,10 @@ int coda_cdf_reopen(coda_product **product)
     product_file->mem_ptr = NULL;
 
     product_file->raw_product = *product;
+    product_file->cache_size = coda_option_cdf_cache_size;
+    product_file->cache_used = 0;
+    product_file->cache_head = NULL;
+    product_file->cache_tail = NULL;
 
     product_file->filename = strdup((*product)->filename);
     if (product_file->filename == NULL)
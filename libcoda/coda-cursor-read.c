@@ -277,6 +277,164 @@ static int read_double_pair(const coda_cursor *cursor, double *dst)
     return 0;
 }
 
+static int decode_time_string(const coda_time_decoder *decoder, const coda_cursor *cursor, double *dst)
+{
+    char buffer[MAX_ASCII_NUMBER_LENGTH];
+    char *str = buffer;
+    long length;
+    int i;
+
+    if (coda_cursor_get_string_length(cursor, &length) != 0)
+    {
+        return -1;
+    }
+    if (length >= MAX_ASCII_NUMBER_LENGTH)
+    {
+        str = malloc(length + 1);
+        if (str == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %ld bytes) (%s:%u)",
+                           length + 1, __FILE__, __LINE__);
+            return -1;
+        }
+    }
+    if (length > 0)
+    {
+        if (coda_cursor_read_string(cursor, str, length + 1) != 0)
+        {
+            if (str != buffer)
+            {
+                free(str);
+            }
+            return -1;
+        }
+    }
+    str[length] = '\0';
+
+    for (i = 0; i < decoder->num_mappings; i++)
+    {
+        const coda_time_decoder_mapping *mapping = &decoder->mapping[i];
+        long compare_length = length;
+
+        if (mapping->is_length_check)
+        {
+            if (length == mapping->length)
+            {
+                break;
+            }
+            continue;
+        }
+        if (mapping->max_length >= 0 && compare_length > mapping->max_length)
+        {
+            compare_length = mapping->max_length;
+        }
+        if (compare_length == mapping->length && memcmp(str, mapping->str, compare_length) == 0)
+        {
+            break;
+        }
+    }
+    if (i < decoder->num_mappings)
+    {
+        *dst = decoder->mapping[i].value;
+    }
+    else if (length == 0)
+    {
+        coda_set_error(CODA_ERROR_EXPRESSION, "time string is empty");
+        return -1;
+    }
+    else if (coda_time_format_string_to_double(decoder->time_format, str, dst) != 0)
+    {
+        if (str != buffer)
+        {
+            free(str);
+        }
+        return -1;
+    }
+
+    if (str != buffer)
+    {
+        free(str);
+    }
+
+    return 0;
+}
+
+/* the cursor will be modified during decoding but will point to the same item again on success */
+static int decode_time_linear(const coda_time_decoder *decoder, coda_cursor *cursor, double *dst)
+{
+    double result = 0;
+    int perform_conversions;
+    int i;
+
+    /* float() reads values without applying conversions */
+    perform_conversions = coda_get_option_perform_conversions();
+    coda_set_option_perform_conversions(0);
+
+    for (i = 0; i < decoder->num_terms; i++)
+    {
+        const coda_time_decoder_term *term = &decoder->term[i];
+        double value;
+
+        if (term->field_index == -2)
+        {
+            value = term->value;
+        }
+        else
+        {
+            if (term->field_index >= 0)
+            {
+                if (coda_cursor_goto_record_field_by_index(cursor, term->field_index) != 0)
+                {
+                    coda_set_option_perform_conversions(perform_conversions);
+                    return -1;
+                }
+            }
+            if (coda_cursor_read_double(cursor, &value) != 0)
+            {
+                coda_set_option_perform_conversions(perform_conversions);
+                return -1;
+            }
+            if (term->field_index >= 0)
+            {
+                coda_cursor_goto_parent(cursor);
+            }
+            if (term->offset_op == '+')
+            {
+                value = value + term->offset;
+            }
+            else if (term->offset_op == '-')
+            {
+                value = value - term->offset;
+            }
+            if (term->scale_op == '*')
+            {
+                value = value * term->scale;
+            }
+            else if (term->scale_op == '/')
+            {
+                value = value / term->scale;
+            }
+        }
+        if (i == 0)
+        {
+            result = value;
+        }
+        else if (term->op == '+')
+        {
+            result = result + value;
+        }
+        else
+        {
+            result = result - value;
+        }
+    }
+
+    coda_set_option_perform_conversions(perform_conversions);
+    *dst = result;
+
+    return 0;
+}
+
 static int read_time(const coda_cursor *cursor, double *dst)
 {
     coda_cursor expr_cursor = *cursor;
@@ -286,9 +444,79 @@ static int read_time(const coda_cursor *cursor, double *dst)
     {
         return -1;
     }
+    if (type->time_decoder != NULL)
+    {
+        if (type->time_decoder->type == coda_time_decoder_string)
+        {
+            return decode_time_string(type->time_decoder, &expr_cursor, dst);
+        }
+        return decode_time_linear(type->time_decoder, &expr_cursor, dst);
+    }
     return coda_expression_eval_float(type->value_expr, &expr_cursor, dst);
 }
 
+/* read an array of time values for which the time type has a decoder */
+static int read_time_array(const coda_cursor *cursor, const coda_time_decoder *decoder, double *dst,
+                           coda_array_ordering array_ordering)
+{
+    coda_cursor array_cursor;
+    long num_elements;
+    long i;
+
+    if (coda_cursor_get_num_elements(cursor, &num_elements) != 0)
+    {
+        return -1;
+    }
+    if (num_elements == 0)
+    {
+        return 0;
+    }
+
+    array_cursor = *cursor;
+    if (coda_cursor_goto_array_element_by_index(&array_cursor, 0) != 0)
+    {
+        return -1;
+    }
+    for (i = 0; i < num_elements; i++)
+    {
+        coda_dynamic_type *element_type = array_cursor.stack[array_cursor.n - 1].type;
+        int64_t element_bit_offset = array_cursor.stack[array_cursor.n - 1].bit_offset;
+
+        /* decode using the base type and then restore the cursor to point to the special type again */
+        if (coda_cursor_use_base_type_of_special_type(&array_cursor) != 0)
+        {
+            return -1;
+        }
+        if (decoder->type == coda_time_decoder_string)
+        {
+            if (decode_time_string(decoder, &array_cursor, &dst[i]) != 0)
+            {
+                return -1;
+            }
+        }
+        else if (decode_time_linear(decoder, &array_cursor, &dst[i]) != 0)
+        {
+            return -1;
+        }
+        array_cursor.stack[array_cursor.n - 1].type = element_type;
+        array_cursor.stack[array_cursor.n - 1].bit_offset = element_bit_offset;
+        if (i < num_elements - 1)
+        {
+            if (coda_cursor_goto_next_array_element(&array_cursor) != 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    if (array_ordering != coda_array_ordering_c)
+    {
+        return transpose_array(cursor, dst, sizeof(double));
+    }
+
+    return 0;
+}
+
 static int read_vsf_integer(const coda_cursor *cursor, double *dst)
 {
     coda_cursor vsf_cursor;
@@ -1252,6 +1480,13 @@ static int read_double_array(const coda_cursor *cursor, double *dst, coda_array_
     type = (coda_type_array *)coda_get_type_for_dynamic_type(cursor->stack[cursor->n - 1].type);
     if (type->base_type->type_class == coda_special_class)
     {
+        coda_type_special *base_type = (coda_type_special *)type->base_type;
+
+        if (base_type->special_type == coda_special_time && base_type->time_decoder != NULL &&
+            coda_option_bypass_special_types == 0)
+        {
+            return read_time_array(cursor, base_type->time_decoder, dst, array_ordering);
+        }
         /* arrays of special types should be explicitly iterated */
         return read_array(cursor, (read_function)&read_double, (uint8_t *)dst, sizeof(double), array_ordering);
     }
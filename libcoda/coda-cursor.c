@@ -364,6 +364,301 @@ LIBCODA_API int coda_cursor_set_product(coda_cursor *cursor, coda_product *produ
     exit(1);
 }
 
+typedef enum path_step_type_enum
+{
+    path_step_root,
+    path_step_parent,
+    path_step_attributes,
+    path_step_field,
+    path_step_array_element
+} path_step_type;
+
+typedef struct path_step_struct
+{
+    path_step_type type;
+    const char *name;   /* only for path_step_field; points into the path string */
+    int name_length;
+    long index; /* array index for path_step_array_element, resolved field index for path_step_field */
+    const coda_type *record_type;       /* record type for which 'index' of a path_step_field was resolved */
+} path_step;
+
+struct coda_path_struct
+{
+    char *path;
+    int num_steps;
+    path_step *step;
+};
+
+/* parse the path element at path[*start] into a single step and advance *start to the next path element
+ * (*has_step is set to 0 for a '.' element, since this does not result in a move)
+ */
+static int path_parse_step(const char *path, int *start, path_step *step, int *has_step)
+{
+    int end;
+
+    step->name = NULL;
+    step->name_length = 0;
+    step->index = -1;
+    step->record_type = NULL;
+    *has_step = 1;
+
+    if (*start == 0 && path[0] == '/')
+    {
+        step->type = path_step_root;
+        *start = 1;
+        return 0;
+    }
+
+    if (path[*start] == '@')
+    {
+        /* attribute (an attribute name is handled as a field reference that directly follows the '@') */
+        step->type = path_step_attributes;
+        (*start)++;
+        return 0;
+    }
+
+    if (path[*start] == '[')
+    {
+        int result;
+        int n;
+
+        /* array index */
+        (*start)++;
+        end = *start;
+        while (path[end] != '\0' && path[end] != ']')
+        {
+            end++;
+        }
+        if (path[end] == '\0')
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (missing ']')", path);
+            return -1;
+        }
+        if (*start == end)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid array index '' in path");
+            return -1;
+        }
+        result = sscanf(&path[*start], "%ld%n", &step->index, &n);
+        if (result != 1 || n != end - *start)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid array index '%.*s' in path", end - *start,
+                           &path[*start]);
+            return -1;
+        }
+        step->type = path_step_array_element;
+        *start = end + 1;
+        return 0;
+    }
+
+    /* it is Ok to ommit a leading '/' when we start with a field name */
+    if (path[*start] == '/')
+    {
+        (*start)++;
+    }
+    else if (*start > 0 && path[*start - 1] != '/' && path[*start - 1] != '@')
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (missing '/'?)", path);
+        return -1;
+    }
+    end = *start;
+    while (path[end] != '\0' && path[end] != '/' && path[end] != '[' && path[end] != '@')
+    {
+        end++;
+    }
+    if (end == *start + 1 && path[*start] == '.')
+    {
+        /* stay at this position */
+        *has_step = 0;
+    }
+    else if (end == *start + 2 && path[*start] == '.' && path[*start + 1] == '.')
+    {
+        step->type = path_step_parent;
+    }
+    else
+    {
+        step->type = path_step_field;
+        step->name = &path[*start];
+        step->name_length = end - *start;
+    }
+    *start = end;
+
+    return 0;
+}
+
+static int path_add_step(coda_path *path, const path_step *step)
+{
+    if (path->num_steps % BLOCK_SIZE == 0)
+    {
+        path_step *new_step;
+
+        new_step = realloc(path->step, (path->num_steps + BLOCK_SIZE) * sizeof(path_step));
+        if (new_step == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (path->num_steps + BLOCK_SIZE) * sizeof(path_step), __FILE__, __LINE__);
+            return -1;
+        }
+        path->step = new_step;
+    }
+    path->step[path->num_steps] = *step;
+    path->num_steps++;
+
+    return 0;
+}
+
+/** Delete a compiled path.
+ * \param path A path that was created with coda_path_compile().
+ */
+LIBCODA_API void coda_path_delete(coda_path *path)
+{
+    if (path == NULL)
+    {
+        return;
+    }
+    if (path->step != NULL)
+    {
+        free(path->step);
+    }
+    if (path->path != NULL)
+    {
+        free(path->path);
+    }
+    free(path);
+}
+
+/** Compile a path string for use with coda_cursor_goto_path().
+ * The \a path string uses the same syntax as for coda_cursor_goto(). The path is parsed only once, which makes
+ * compiled paths useful when the same path needs to be resolved for many cursors or products.
+ * For each record field reference in the path, the compiled path keeps the field index that was resolved for the
+ * record definition that the path was most recently applied to. For products that share the same product definition
+ * (e.g. many products of the same product type) all subsequent moves will thus only be direct index based moves.
+ * When a path is applied to a different record definition the field index is looked up again by name (and replaces
+ * the cached entry).
+ * A compiled path should be deleted with coda_path_delete() when it is no longer needed.
+ * \param path A string representing a path to a location inside a product.
+ * \param compiled_path Pointer to the variable where the compiled path will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_path_compile(const char *path, coda_path **compiled_path)
+{
+    coda_path *cpath;
+    int start = 0;
+
+    if (path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (compiled_path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "compiled_path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    cpath = malloc(sizeof(coda_path));
+    if (cpath == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       sizeof(coda_path), __FILE__, __LINE__);
+        return -1;
+    }
+    cpath->num_steps = 0;
+    cpath->step = NULL;
+    cpath->path = strdup(path);
+    if (cpath->path == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate string) (%s:%u)", __FILE__,
+                       __LINE__);
+        coda_path_delete(cpath);
+        return -1;
+    }
+
+    while (cpath->path[start] != '\0')
+    {
+        path_step step;
+        int has_step;
+
+        if (path_parse_step(cpath->path, &start, &step, &has_step) != 0)
+        {
+            coda_path_delete(cpath);
+            return -1;
+        }
+        if (has_step)
+        {
+            if (path_add_step(cpath, &step) != 0)
+            {
+                coda_path_delete(cpath);
+                return -1;
+            }
+        }
+    }
+
+    *compiled_path = cpath;
+
+    return 0;
+}
+
+/* resolve the field index for a field step, using the index that was cached for the previous record definition */
+static int path_get_field_index(const coda_cursor *cursor, path_step *step, long *index)
+{
+    coda_type *type;
+
+    if (coda_cursor_get_type(cursor, &type) != 0)
+    {
+        return -1;
+    }
+    if (type == step->record_type && type->type_class == coda_record_class &&
+        step->index < ((coda_type_record *)type)->num_fields)
+    {
+        coda_type_record_field *field = ((coda_type_record *)type)->field[step->index];
+
+        /* verify the name, since a new definition may have been allocated at the address of a deleted one */
+        if (strncmp(field->name, step->name, step->name_length) == 0 && field->name[step->name_length] == '\0')
+        {
+            *index = step->index;
+            return 0;
+        }
+    }
+    if (coda_type_get_record_field_index_from_name_n(type, step->name, step->name_length, index) != 0)
+    {
+        return -1;
+    }
+    step->record_type = type;
+    step->index = *index;
+
+    return 0;
+}
+
+/* move the cursor according to a single step of a path */
+static int path_apply_step(coda_cursor *cursor, path_step *step)
+{
+    long index;
+
+    switch (step->type)
+    {
+        case path_step_root:
+            return coda_cursor_goto_root(cursor);
+        case path_step_parent:
+            return coda_cursor_goto_parent(cursor);
+        case path_step_attributes:
+            return coda_cursor_goto_attributes(cursor);
+        case path_step_field:
+            if (path_get_field_index(cursor, step, &index) != 0)
+            {
+                return -1;
+            }
+            return coda_cursor_goto_record_field_by_index(cursor, index);
+        case path_step_array_element:
+            return coda_cursor_goto_array_element_by_index(cursor, step->index);
+    }
+
+    assert(0);
+    exit(1);
+}
+
 /** Moves the cursor to the location in the product as specified by a path string.
  * The \a path string should contain a path reference similar to a 'node expression'
  * (see \link coda_expression CODA expression language\endlink).
@@ -383,146 +678,55 @@ LIBCODA_API int coda_cursor_set_product(coda_cursor *cursor, coda_product *produ
  */
 LIBCODA_API int coda_cursor_goto(coda_cursor *cursor, const char *path)
 {
-    coda_type *type = NULL;
-    long index;
     int start = 0;
-    int end;
 
-    if (path[start] == '/')
+    /* the path is parsed and applied one step at a time, so no memory needs to be allocated */
+    while (path[start] != '\0')
     {
-        if (coda_cursor_goto_root(cursor) != 0)
+        path_step step;
+        int has_step;
+
+        if (path_parse_step(path, &start, &step, &has_step) != 0)
         {
             return -1;
         }
-        /* skip leading '/' if it is not followed by a record field name */
-        if (path[start + 1] == '\0' || path[start + 1] == '/' || path[start + 1] == '[' || path[start + 1] == '@')
-        {
-            start++;
-        }
-    }
-
-    while (path[start] != '\0')
-    {
-        if (path[start] == '@')
+        if (has_step)
         {
-            /* attribute */
-            if (coda_cursor_goto_attributes(cursor) != 0)
+            if (path_apply_step(cursor, &step) != 0)
             {
                 return -1;
             }
-            start++;
-            end = start;
-            while (path[end] != '\0' && path[end] != '/' && path[end] != '[' && path[end] != '@')
-            {
-                end++;
-            }
-            if (end == start + 1 && path[start] == '.')
-            {
-                /* stay at this position */
-            }
-            else if (end == start + 2 && path[start] == '.' && path[start + 1] == '.')
-            {
-                if (coda_cursor_goto_parent(cursor) != 0)
-                {
-                    return -1;
-                }
-            }
-            else if (end > start)
-            {
-                if (coda_cursor_get_type(cursor, &type) != 0)
-                {
-                    return -1;
-                }
-                if (coda_type_get_record_field_index_from_name_n(type, &path[start], end - start, &index) != 0)
-                {
-                    return -1;
-                }
-                if (coda_cursor_goto_record_field_by_index(cursor, index) != 0)
-                {
-                    return -1;
-                }
-            }
-            start = end;
         }
-        else if (path[start] == '[')
-        {
-            int result;
-            int n;
+    }
 
-            /* array index */
-            start++;
-            end = start;
-            while (path[end] != '\0' && path[end] != ']')
-            {
-                end++;
-            }
-            if (path[end] == '\0')
-            {
-                coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (missing ']')", path);
-                return -1;
-            }
-            if (start == end)
-            {
-                coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid array index '' in path");
-                return -1;
-            }
-            result = sscanf(&path[start], "%ld%n", &index, &n);
-            if (result != 1 || n != end - start)
-            {
-                coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid array index '%.*s' in path", end - start,
-                               &path[start]);
-                return -1;
-            }
-            if (coda_cursor_goto_array_element_by_index(cursor, index) != 0)
-            {
-                return -1;
-            }
-            start = end + 1;
-        }
-        else
+    return 0;
+}
+
+/** Moves the cursor to the location in the product as specified by a compiled path.
+ * This function behaves the same as coda_cursor_goto(), but uses a path that was created with coda_path_compile().
+ * \note The field index cache inside the compiled path gets updated by this function, so a compiled path can not
+ * be used by multiple threads at the same time (each thread should compile its own path).
+ * \param cursor Pointer to a valid CODA cursor.
+ * \param path A compiled path.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_cursor_goto_path(coda_cursor *cursor, coda_path *path)
+{
+    int i;
+
+    if (path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    for (i = 0; i < path->num_steps; i++)
+    {
+        if (path_apply_step(cursor, &path->step[i]) != 0)
         {
-            /* it is Ok to ommit a leading '/' when we start with a field name */
-            if (path[start] == '/')
-            {
-                start++;
-            }
-            else if (start > 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (missing '/'?)", path);
-                return -1;
-            }
-            end = start;
-            while (path[end] != '\0' && path[end] != '/' && path[end] != '[' && path[end] != '@')
-            {
-                end++;
-            }
-            if (end == start + 1 && path[start] == '.')
-            {
-                /* stay at this position */
-            }
-            else if (end == start + 2 && path[start] == '.' && path[start + 1] == '.')
-            {
-                if (coda_cursor_goto_parent(cursor) != 0)
-                {
-                    return -1;
-                }
-            }
-            else
-            {
-                if (coda_cursor_get_type(cursor, &type) != 0)
-                {
-                    return -1;
-                }
-                if (coda_type_get_record_field_index_from_name_n(type, &path[start], end - start, &index) != 0)
-                {
-                    return -1;
-                }
-                if (coda_cursor_goto_record_field_by_index(cursor, index) != 0)
-                {
-                    return -1;
-                }
-            }
-            start = end;
+            return -1;
         }
     }
 
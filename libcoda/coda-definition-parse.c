@@ -197,6 +197,7 @@ struct parser_info_struct
     hashtable *hash_data;
     char *buffer;
     za_file *zf;
+    zip_entry_type entry_type;
     const char *entry_base_name;
     coda_product_class *product_class;
     coda_product_definition *product_definition;
@@ -300,6 +301,133 @@ static int is_whitespace(const char *s, int len)
     return 1;
 }
 
+#define MAX_ORIGIN_DEPTH 32
+
+/* record where in the codadef an expression was defined, so it can be reported by the expression profiler */
+static int set_expression_origin(parser_info *info, const char *exprstring, coda_expression *expr)
+{
+    const char *name[MAX_ORIGIN_DEPTH];
+    int is_attribute[MAX_ORIGIN_DEPTH];
+    int num_names = 0;
+    node_info *node;
+    char *location = NULL;
+    char *item = NULL;
+    long length;
+    int result;
+    int i;
+
+    for (node = info->node->parent; node != NULL && num_names < MAX_ORIGIN_DEPTH; node = node->parent)
+    {
+        if (node->data == NULL)
+        {
+            continue;
+        }
+        switch (node->tag)
+        {
+            case element_cd_field:
+            case element_cd_attribute:
+                name[num_names] = ((coda_type_record_field *)node->data)->name;
+                is_attribute[num_names] = (node->tag == element_cd_attribute);
+                num_names++;
+                break;
+            case element_cd_product_variable:
+                name[num_names] = ((coda_product_variable *)node->data)->name;
+                is_attribute[num_names] = 0;
+                num_names++;
+                break;
+            case element_cd_product_definition:
+                if (info->entry_type == ze_index)
+                {
+                    name[num_names] = ((coda_product_definition *)node->data)->name;
+                    is_attribute[num_names] = 0;
+                    num_names++;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (info->entry_base_name != NULL)
+    {
+        location = malloc(9 + strlen(info->entry_base_name) + 1);
+        if (location == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)9 + strlen(info->entry_base_name) + 1, __FILE__, __LINE__);
+            return -1;
+        }
+        sprintf(location, "%s/%s", info->entry_type == ze_type ? "types" : "products", info->entry_base_name);
+    }
+
+    if (num_names > 0)
+    {
+        length = 0;
+        for (i = 0; i < num_names; i++)
+        {
+            length += (long)strlen(name[i]) + 2;
+        }
+        item = malloc(length);
+        if (item == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)", length,
+                           __FILE__, __LINE__);
+            if (location != NULL)
+            {
+                free(location);
+            }
+            return -1;
+        }
+        item[0] = '\0';
+        for (i = num_names - 1; i >= 0; i--)
+        {
+            if (is_attribute[i])
+            {
+                strcat(item, "@");
+            }
+            else if (i != num_names - 1)
+            {
+                strcat(item, "/");
+            }
+            strcat(item, name[i]);
+        }
+    }
+
+    result = coda_expression_set_origin(expr, exprstring, za_get_filename(info->zf),
+                                        location != NULL ? location : "index", item,
+                                        xml_element_name(info->node->tag),
+                                        (long)XML_GetCurrentLineNumber(info->parser));
+
+    if (location != NULL)
+    {
+        free(location);
+    }
+    if (item != NULL)
+    {
+        free(item);
+    }
+
+    return result;
+}
+
+static int expression_from_string(parser_info *info, const char *exprstring, coda_expression **expr)
+{
+    if (coda_expression_from_string(exprstring, expr) != 0)
+    {
+        return -1;
+    }
+    if (coda_option_profile_expressions && !coda_expression_is_constant(*expr))
+    {
+        if (set_expression_origin(info, exprstring, *expr) != 0)
+        {
+            coda_expression_delete(*expr);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 static char *regexp_match_string(char *str)
 {
     char *match_str;
@@ -801,7 +929,7 @@ static int bool_expression_finalise(parser_info *info)
         coda_set_error(CODA_ERROR_DATA_DEFINITION, "empty boolean expression");
         return -1;
     }
-    if (coda_expression_from_string(info->node->char_data, &expr) != 0)
+    if (expression_from_string(info, info->node->char_data, &expr) != 0)
     {
         return -1;
     }
@@ -850,7 +978,7 @@ static int integer_expression_finalise(parser_info *info)
         coda_set_error(CODA_ERROR_DATA_DEFINITION, "empty integer expression");
         return -1;
     }
-    if (coda_expression_from_string(info->node->char_data, &expr) != 0)
+    if (expression_from_string(info, info->node->char_data, &expr) != 0)
     {
         return -1;
     }
@@ -899,7 +1027,7 @@ static int integer_constant_or_expression_finalise(parser_info *info)
         coda_set_error(CODA_ERROR_DATA_DEFINITION, "empty integer expression");
         return -1;
     }
-    if (coda_expression_from_string(info->node->char_data, &expr) != 0)
+    if (expression_from_string(info, info->node->char_data, &expr) != 0)
     {
         return -1;
     }
@@ -960,7 +1088,7 @@ static int optional_integer_constant_or_expression_finalise(parser_info *info)
         info->node->empty = 1;
         return 0;
     }
-    if (coda_expression_from_string(info->node->char_data, &expr) != 0)
+    if (expression_from_string(info, info->node->char_data, &expr) != 0)
     {
         return -1;
     }
@@ -1130,7 +1258,7 @@ static int void_expression_finalise(parser_info *info)
         coda_set_error(CODA_ERROR_DATA_DEFINITION, "empty void expression");
         return -1;
     }
-    if (coda_expression_from_string(info->node->char_data, &expr) != 0)
+    if (expression_from_string(info, info->node->char_data, &expr) != 0)
     {
         return -1;
     }
@@ -2516,7 +2644,7 @@ static int cd_match_expression_finalise(parser_info *info)
         return -1;
     }
 
-    if (coda_expression_from_string(info->node->char_data, &expr) != 0)
+    if (expression_from_string(info, info->node->char_data, &expr) != 0)
     {
         return -1;
     }
@@ -3591,7 +3719,7 @@ static int cd_time_init(parser_info *info, const char **attr)
         }
     }
 
-    if (coda_expression_from_string(timeformat, &expr) != 0)
+    if (expression_from_string(info, timeformat, &expr) != 0)
     {
         coda_type_release(base_type);
         return -1;
@@ -4149,6 +4277,7 @@ static int parse_entry(za_file *zf, zip_entry_type type, const char *name, coda_
 
     parser_info_init(&info);
     info.zf = zf;
+    info.entry_type = type;
     info.entry_base_name = name;
     info.product_class = current_product_class;
     info.product_definition = current_product_definition;
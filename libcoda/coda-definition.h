@@ -119,6 +119,7 @@ struct coda_detection_node_struct
      * 'path' and 'expression' can not be both != NULL
      */
     char *path;
+    coda_path *compiled_path;   /* compiled version of 'path'; created on first evaluation of the node */
 
     /* detection expression; will be NULL for root node */
     const coda_expression *expression;
@@ -180,6 +180,10 @@ static void delete_detection_node(coda_detection_node *node)
     {
         free(node->path);
     }
+    if (node->compiled_path != NULL)
+    {
+        coda_path_delete(node->compiled_path);
+    }
     if (node->subnode != NULL)
     {
         for (i = 0; i < node->num_subnodes; i++)
@@ -203,6 +207,7 @@ static coda_detection_node *detection_node_new(void)
         return NULL;
     }
     node->path = NULL;
+    node->compiled_path = NULL;
     node->expression = NULL;
     node->rule = NULL;
     node->num_subnodes = 0;
@@ -350,6 +355,11 @@ static coda_detection_node *get_node_for_entry(coda_detection_node *node, char *
                         j++;
                     }
                     node->subnode[i]->path[j - nodepath_pos] = '\0';
+                    if (node->subnode[i]->compiled_path != NULL)
+                    {
+                        coda_path_delete(node->subnode[i]->compiled_path);
+                        node->subnode[i]->compiled_path = NULL;
+                    }
 
                     node->subnode[i] = new_node;
                     return get_node_for_entry(node->subnode[i], &subpath[subpath_pos], entry);
@@ -463,7 +473,16 @@ int coda_evaluate_detection_node(coda_detection_node *node, coda_cursor *cursor,
     }
     if (node->path != NULL)
     {
-        if (coda_cursor_goto(&subcursor, node->path) != 0)
+        if (node->compiled_path == NULL)
+        {
+            if (coda_path_compile(node->path, &node->compiled_path) != 0)
+            {
+                /* treat failures as 'does not exist' */
+                coda_errno = 0;
+                return 0;
+            }
+        }
+        if (coda_cursor_goto_path(&subcursor, node->compiled_path) != 0)
         {
             /* treat failures as 'does not exist' */
             coda_errno = 0;
@@ -38,6 +38,11 @@
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
 
 #include "coda-ascii.h"
 #include "ipow.h"
@@ -237,6 +242,7 @@ static coda_expression *boolean_constant_new(char *string_value)
     expr->result_type = coda_expression_boolean;
     expr->is_constant = 1;
     expr->recursion_depth = 0;
+    expr->profile = NULL;
     expr->value = (*string_value == 't' || *string_value == 'T');
     free(string_value);
 
@@ -266,6 +272,7 @@ static coda_expression *float_constant_new(char *string_value)
     expr->result_type = coda_expression_float;
     expr->is_constant = 1;
     expr->recursion_depth = 0;
+    expr->profile = NULL;
     expr->value = value;
 
     return (coda_expression *)expr;
@@ -294,6 +301,7 @@ static coda_expression *integer_constant_new(char *string_value)
     expr->result_type = coda_expression_integer;
     expr->is_constant = 1;
     expr->recursion_depth = 0;
+    expr->profile = NULL;
     expr->value = value;
 
     return (coda_expression *)expr;
@@ -314,6 +322,7 @@ static coda_expression *rawstring_constant_new(char *string_value)
     expr->result_type = coda_expression_string;
     expr->is_constant = 1;
     expr->recursion_depth = 0;
+    expr->profile = NULL;
     expr->length = (long)strlen(string_value);
     expr->value = string_value;
 
@@ -343,6 +352,7 @@ static coda_expression *string_constant_new(char *string_value)
     expr->result_type = coda_expression_string;
     expr->is_constant = 1;
     expr->recursion_depth = 0;
+    expr->profile = NULL;
     expr->length = length;
     expr->value = string_value;
 
@@ -418,6 +428,8 @@ coda_expression *coda_expression_new(coda_expression_node_type tag, char *string
     expr->operand[1] = op2;
     expr->operand[2] = op3;
     expr->operand[3] = op4;
+    expr->profile = NULL;
+    expr->time_format = NULL;
 
     switch (tag)
     {
@@ -602,6 +614,19 @@ coda_expression *coda_expression_new(coda_expression_node_type tag, char *string
         return NULL;
     }
 
+    if ((tag == expr_time || tag == expr_strtime) && op2 != NULL &&
+        (op2->tag == expr_constant_string || op2->tag == expr_constant_rawstring) &&
+        ((coda_expression_string_constant *)op2)->length > 0)
+    {
+        /* precompile constant time formats (invalid formats will be reported when the expression is evaluated) */
+        if (coda_time_format_compile(((coda_expression_string_constant *)op2)->value, &expr->time_format) != 0)
+        {
+            /* the error is not propagated, so don't leave it set */
+            coda_errno = 0;
+            expr->time_format = NULL;
+        }
+    }
+
     return (coda_expression *)expr;
 }
 
@@ -1734,6 +1759,16 @@ static int eval_float(eval_info *info, const coda_expression *expr, double *valu
                     return -1;
                 }
                 timestr[off_timestr + len_timestr] = '\0';      /* add terminating zero */
+                if (opexpr->time_format != NULL)
+                {
+                    if (coda_time_format_string_to_double(opexpr->time_format, &timestr[off_timestr], value) != 0)
+                    {
+                        free(timestr);
+                        return -1;
+                    }
+                    free(timestr);
+                    break;
+                }
                 if (eval_string(info, opexpr->operand[1], &off_format, &len_format, &format) != 0)
                 {
                     free(timestr);
@@ -3777,6 +3812,24 @@ static int eval_string(eval_info *info, const coda_expression *expr, long *offse
                 {
                     return -1;
                 }
+                if (opexpr->time_format != NULL)
+                {
+                    coda_time_format_get_string_length(opexpr->time_format, length);
+                    *value = malloc(*length + 1);       /* add room for zero termination at the end */
+                    if (*value == NULL)
+                    {
+                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %ld bytes) (%s:%u)",
+                                       *length + 1, __FILE__, __LINE__);
+                        return -1;
+                    }
+                    if (coda_time_format_double_to_string(opexpr->time_format, timevalue, *value) != 0)
+                    {
+                        free(*value);
+                        return -1;
+                    }
+                    *offset = 0;
+                    break;
+                }
                 if (opexpr->operand[1] != NULL)
                 {
                     if (eval_string(info, opexpr->operand[1], &off_format, &len_format, &format) != 0)
@@ -4155,9 +4208,212 @@ static int eval_cursor(eval_info *info, const coda_expression *expr)
     return 0;
 }
 
+struct coda_expression_profile_struct
+{
+    char *expression;
+    char *definition_file;
+    char *location;
+    char *item;
+    char *element;
+    long line;
+    int64_t num_evaluations;
+    double total_time;
+    double self_time;
+};
+
+static THREAD_LOCAL coda_expression_profile **profile_entry = NULL;
+static THREAD_LOCAL long num_profile_entries = 0;
+
+/* time spent in profiled expressions that are evaluated from within the current profiled expression */
+static THREAD_LOCAL double profile_nested_time = 0;
+
+static double profile_get_time(void)
+{
+#ifdef WIN32
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+#endif
+}
+
+static void profile_entry_delete(coda_expression_profile *entry)
+{
+    if (entry->expression != NULL)
+    {
+        free(entry->expression);
+    }
+    if (entry->definition_file != NULL)
+    {
+        free(entry->definition_file);
+    }
+    if (entry->location != NULL)
+    {
+        free(entry->location);
+    }
+    if (entry->item != NULL)
+    {
+        free(entry->item);
+    }
+    if (entry->element != NULL)
+    {
+        free(entry->element);
+    }
+    free(entry);
+}
+
+static char *profile_strdup(const char *str)
+{
+    char *result;
+
+    if (str == NULL)
+    {
+        return NULL;
+    }
+    result = strdup(str);
+    if (result == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate string) (%s:%u)", __FILE__,
+                       __LINE__);
+    }
+    return result;
+}
+
+/* Attach origin information (where in the codadef the expression was defined) to a top level expression.
+ * Only expressions that have an origin are included in the expression profile.
+ * The profile information is owned by the profiler and stays available after the expression is deleted.
+ */
+int coda_expression_set_origin(coda_expression *expr, const char *exprstring, const char *definition_file,
+                               const char *location, const char *item, const char *element, long line)
+{
+    coda_expression_profile *entry;
+
+    entry = malloc(sizeof(coda_expression_profile));
+    if (entry == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)sizeof(coda_expression_profile), __FILE__, __LINE__);
+        return -1;
+    }
+    entry->expression = NULL;
+    entry->definition_file = NULL;
+    entry->location = NULL;
+    entry->item = NULL;
+    entry->element = NULL;
+    entry->line = line;
+    entry->num_evaluations = 0;
+    entry->total_time = 0;
+    entry->self_time = 0;
+
+    if ((exprstring != NULL && (entry->expression = profile_strdup(exprstring)) == NULL) ||
+        (definition_file != NULL && (entry->definition_file = profile_strdup(definition_file)) == NULL) ||
+        (location != NULL && (entry->location = profile_strdup(location)) == NULL) ||
+        (item != NULL && (entry->item = profile_strdup(item)) == NULL) ||
+        (element != NULL && (entry->element = profile_strdup(element)) == NULL))
+    {
+        profile_entry_delete(entry);
+        return -1;
+    }
+    if (entry->expression != NULL)
+    {
+        char *from = entry->expression;
+        char *to = entry->expression;
+
+        /* reduce the expression to a single line for reporting */
+        while (*from != '\0')
+        {
+            if (iswhitespace(*from))
+            {
+                while (iswhitespace(from[1]))
+                {
+                    from++;
+                }
+                if (to != entry->expression && from[1] != '\0')
+                {
+                    *to++ = ' ';
+                }
+            }
+            else
+            {
+                *to++ = *from;
+            }
+            from++;
+        }
+        *to = '\0';
+    }
+
+    if (num_profile_entries % BLOCK_SIZE == 0)
+    {
+        coda_expression_profile **new_profile_entry;
+
+        new_profile_entry = realloc(profile_entry, (num_profile_entries + BLOCK_SIZE) *
+                                    sizeof(coda_expression_profile *));
+        if (new_profile_entry == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)(num_profile_entries + BLOCK_SIZE) * sizeof(coda_expression_profile *), __FILE__,
+                           __LINE__);
+            profile_entry_delete(entry);
+            return -1;
+        }
+        profile_entry = new_profile_entry;
+    }
+    profile_entry[num_profile_entries] = entry;
+    num_profile_entries++;
+
+    expr->profile = entry;
+
+    return 0;
+}
+
+void coda_expression_profile_done(void)
+{
+    long i;
+
+    if (profile_entry != NULL)
+    {
+        for (i = 0; i < num_profile_entries; i++)
+        {
+            profile_entry_delete(profile_entry[i]);
+        }
+        free(profile_entry);
+        profile_entry = NULL;
+    }
+    num_profile_entries = 0;
+    profile_nested_time = 0;
+}
+
+static void profile_start(double *start_time, double *outer_nested_time)
+{
+    *outer_nested_time = profile_nested_time;
+    profile_nested_time = 0;
+    *start_time = profile_get_time();
+}
+
+static void profile_stop(coda_expression_profile *profile, double start_time, double outer_nested_time)
+{
+    double elapsed_time;
+
+    elapsed_time = profile_get_time() - start_time;
+    profile->num_evaluations++;
+    profile->total_time += elapsed_time;
+    profile->self_time += elapsed_time - profile_nested_time;
+    profile_nested_time = outer_nested_time + elapsed_time;
+}
+
 int coda_expression_eval_void(const coda_expression *expr, const coda_cursor *cursor)
 {
     eval_info info;
+    double start_time;
+    double outer_nested_time;
+    int result;
 
     if (expr->result_type != coda_expression_void)
     {
@@ -4171,7 +4427,18 @@ int coda_expression_eval_void(const coda_expression *expr, const coda_cursor *cu
     }
 
     init_eval_info(&info, cursor);
-    return eval_void(&info, expr);
+    if (expr->profile != NULL && coda_option_profile_expressions)
+    {
+        profile_start(&start_time, &outer_nested_time);
+        result = eval_void(&info, expr);
+        profile_stop(expr->profile, start_time, outer_nested_time);
+    }
+    else
+    {
+        result = eval_void(&info, expr);
+    }
+
+    return result;
 }
 
 static void print_escaped_string(const char *str, int length, int (*print)(const char *, ...), int xml, int html)
@@ -5012,6 +5279,10 @@ LIBCODA_API void coda_expression_delete(coda_expression *expr)
                 {
                     free(opexpr->identifier);
                 }
+                if (opexpr->time_format != NULL)
+                {
+                    coda_time_format_delete(opexpr->time_format);
+                }
                 for (i = 0; i < 4; i++)
                 {
                     if (opexpr->operand[i] != NULL)
@@ -5162,6 +5433,9 @@ LIBCODA_API int coda_expression_get_type(const coda_expression *expr, coda_expre
 LIBCODA_API int coda_expression_eval_bool(const coda_expression *expr, const coda_cursor *cursor, int *value)
 {
     eval_info info;
+    double start_time;
+    double outer_nested_time;
+    int result;
 
     if (expr->result_type != coda_expression_boolean)
     {
@@ -5175,7 +5449,17 @@ LIBCODA_API int coda_expression_eval_bool(const coda_expression *expr, const cod
     }
 
     init_eval_info(&info, cursor);
-    if (eval_boolean(&info, expr, value) != 0)
+    if (expr->profile != NULL && coda_option_profile_expressions)
+    {
+        profile_start(&start_time, &outer_nested_time);
+        result = eval_boolean(&info, expr, value);
+        profile_stop(expr->profile, start_time, outer_nested_time);
+    }
+    else
+    {
+        result = eval_boolean(&info, expr, value);
+    }
+    if (result != 0)
     {
         if (cursor != NULL && coda_cursor_compare(cursor, &info.cursor) != 0)
         {
@@ -5201,6 +5485,9 @@ LIBCODA_API int coda_expression_eval_bool(const coda_expression *expr, const cod
 LIBCODA_API int coda_expression_eval_integer(const coda_expression *expr, const coda_cursor *cursor, int64_t *value)
 {
     eval_info info;
+    double start_time;
+    double outer_nested_time;
+    int result;
 
     if (expr->result_type != coda_expression_integer)
     {
@@ -5214,7 +5501,17 @@ LIBCODA_API int coda_expression_eval_integer(const coda_expression *expr, const
     }
 
     init_eval_info(&info, cursor);
-    if (eval_integer(&info, expr, value) != 0)
+    if (expr->profile != NULL && coda_option_profile_expressions)
+    {
+        profile_start(&start_time, &outer_nested_time);
+        result = eval_integer(&info, expr, value);
+        profile_stop(expr->profile, start_time, outer_nested_time);
+    }
+    else
+    {
+        result = eval_integer(&info, expr, value);
+    }
+    if (result != 0)
     {
         if (cursor != NULL && coda_cursor_compare(cursor, &info.cursor) != 0)
         {
@@ -5240,6 +5537,9 @@ LIBCODA_API int coda_expression_eval_integer(const coda_expression *expr, const
 LIBCODA_API int coda_expression_eval_float(const coda_expression *expr, const coda_cursor *cursor, double *value)
 {
     eval_info info;
+    double start_time;
+    double outer_nested_time;
+    int result;
 
     if (expr->result_type != coda_expression_float)
     {
@@ -5253,7 +5553,17 @@ LIBCODA_API int coda_expression_eval_float(const coda_expression *expr, const co
     }
 
     init_eval_info(&info, cursor);
-    if (eval_float(&info, expr, value) != 0)
+    if (expr->profile != NULL && coda_option_profile_expressions)
+    {
+        profile_start(&start_time, &outer_nested_time);
+        result = eval_float(&info, expr, value);
+        profile_stop(expr->profile, start_time, outer_nested_time);
+    }
+    else
+    {
+        result = eval_float(&info, expr, value);
+    }
+    if (result != 0)
     {
         if (cursor != NULL && coda_cursor_compare(cursor, &info.cursor) != 0)
         {
@@ -5288,6 +5598,9 @@ LIBCODA_API int coda_expression_eval_string(const coda_expression *expr, const c
 {
     eval_info info;
     long offset;
+    double start_time;
+    double outer_nested_time;
+    int result;
 
     if (expr->result_type != coda_expression_string)
     {
@@ -5301,7 +5614,17 @@ LIBCODA_API int coda_expression_eval_string(const coda_expression *expr, const c
     }
 
     init_eval_info(&info, cursor);
-    if (eval_string(&info, expr, &offset, length, value) != 0)
+    if (expr->profile != NULL && coda_option_profile_expressions)
+    {
+        profile_start(&start_time, &outer_nested_time);
+        result = eval_string(&info, expr, &offset, length, value);
+        profile_stop(expr->profile, start_time, outer_nested_time);
+    }
+    else
+    {
+        result = eval_string(&info, expr, &offset, length, value);
+    }
+    if (result != 0)
     {
         if (cursor != NULL && coda_cursor_compare(cursor, &info.cursor) != 0)
         {
@@ -5353,6 +5676,9 @@ LIBCODA_API int coda_expression_eval_string(const coda_expression *expr, const c
 LIBCODA_API int coda_expression_eval_node(const coda_expression *expr, coda_cursor *cursor)
 {
     eval_info info;
+    double start_time;
+    double outer_nested_time;
+    int result;
 
     if (expr->result_type != coda_expression_node)
     {
@@ -5367,7 +5693,17 @@ LIBCODA_API int coda_expression_eval_node(const coda_expression *expr, coda_curs
     }
 
     init_eval_info(&info, cursor);
-    if (eval_cursor(&info, expr) != 0)
+    if (expr->profile != NULL && coda_option_profile_expressions)
+    {
+        profile_start(&start_time, &outer_nested_time);
+        result = eval_cursor(&info, expr);
+        profile_stop(expr->profile, start_time, outer_nested_time);
+    }
+    else
+    {
+        result = eval_cursor(&info, expr);
+    }
+    if (result != 0)
     {
         if (cursor != NULL && coda_cursor_compare(cursor, &info.cursor) != 0)
         {
@@ -5381,4 +5717,142 @@ LIBCODA_API int coda_expression_eval_node(const coda_expression *expr, coda_curs
     return 0;
 }
 
+static int compare_profile_entries(const void *a, const void *b)
+{
+    const coda_expression_profile *entry_a = *(const coda_expression_profile **)a;
+    const coda_expression_profile *entry_b = *(const coda_expression_profile **)b;
+
+    if (entry_a->self_time > entry_b->self_time)
+    {
+        return -1;
+    }
+    if (entry_a->self_time < entry_b->self_time)
+    {
+        return 1;
+    }
+    if (entry_a->num_evaluations > entry_b->num_evaluations)
+    {
+        return -1;
+    }
+    if (entry_a->num_evaluations < entry_b->num_evaluations)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/** Reset the expression profile.
+ * This sets the evaluation counts and accumulated evaluation times of all profiled expressions back to zero.
+ * \see coda_set_option_profile_expressions()
+ */
+LIBCODA_API void coda_expression_profile_reset(void)
+{
+    long i;
+
+    for (i = 0; i < num_profile_entries; i++)
+    {
+        profile_entry[i]->num_evaluations = 0;
+        profile_entry[i]->total_time = 0;
+        profile_entry[i]->self_time = 0;
+    }
+}
+
+/** Print a report of the most expensive codadef expressions.
+ * When expression profiling is enabled (see coda_set_option_profile_expressions()) CODA keeps track of how often each
+ * expression from the codadef files was evaluated and how much time was spent in the evaluation. This function prints
+ * the \a max_entries expressions with the highest 'self' time (i.e. the evaluation time of the expression excluding
+ * the time spent in the evaluation of other profiled expressions that got triggered by it).
+ * Each entry shows the definition file, the named type or product definition, the field (or attribute) and the
+ * definition element (e.g. 'BitSize' or 'Available') from which the expression originates.
+ * Expressions that were never evaluated are not included in the report.
+ *
+ * You can use e.g. printf as print function:
+ * \code{.c}
+ * coda_expression_profile_print(20, printf);
+ * \endcode
+ * \param max_entries Maximum number of expressions to include in the report (use -1 to include all expressions).
+ * \param print Reference to a printf compatible function.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_expression_profile_print(int max_entries, int (*print)(const char *, ...))
+{
+    coda_expression_profile **sorted_entry;
+    long num_evaluated_entries = 0;
+    long i;
+
+    if (print == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid print argument (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (num_profile_entries == 0)
+    {
+        print("no expression profile information available\n");
+        return 0;
+    }
+
+    sorted_entry = malloc(num_profile_entries * sizeof(coda_expression_profile *));
+    if (sorted_entry == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)num_profile_entries * sizeof(coda_expression_profile *), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_profile_entries; i++)
+    {
+        if (profile_entry[i]->num_evaluations > 0)
+        {
+            sorted_entry[num_evaluated_entries] = profile_entry[i];
+            num_evaluated_entries++;
+        }
+    }
+    qsort(sorted_entry, num_evaluated_entries, sizeof(coda_expression_profile *), compare_profile_entries);
+    if (max_entries < 0 || max_entries > num_evaluated_entries)
+    {
+        max_entries = (int)num_evaluated_entries;
+    }
+
+    print("expression profile: %d of %ld evaluated expressions (sorted by self time)\n", max_entries,
+          num_evaluated_entries);
+    print("%6s %12s %12s %14s %12s\n", "rank", "self [s]", "total [s]", "evaluations", "avg [us]");
+    for (i = 0; i < max_entries; i++)
+    {
+        coda_expression_profile *entry = sorted_entry[i];
+        char s[21];
+
+        coda_str64(entry->num_evaluations, s);
+        print("%6ld %12.6f %12.6f %14s %12.3f\n", i + 1, entry->self_time, entry->total_time, s,
+              1.0e6 * entry->total_time / entry->num_evaluations);
+        print("       %s", entry->definition_file != NULL ? entry->definition_file : "-");
+        if (entry->location != NULL)
+        {
+            print(" %s", entry->location);
+        }
+        if (entry->line > 0)
+        {
+            print(":%ld", entry->line);
+        }
+        if (entry->item != NULL)
+        {
+            print(" %s", entry->item);
+        }
+        if (entry->element != NULL)
+        {
+            print(" (%s)", entry->element);
+        }
+        print("\n");
+        if (entry->expression != NULL)
+        {
+            print("       %s\n", entry->expression);
+        }
+    }
+
+    free(sorted_entry);
+
+    return 0;
+}
+
 /** @} */
@@ -126,12 +126,16 @@ enum coda_expression_node_type_enum
 };
 typedef enum coda_expression_node_type_enum coda_expression_node_type;
 
+/* evaluation statistics for an expression from a definition file (only used when expression profiling is enabled) */
+typedef struct coda_expression_profile_struct coda_expression_profile;
+
 struct coda_expression_struct
 {
     coda_expression_node_type tag;
     coda_expression_type result_type;
     int is_constant;
     int recursion_depth;
+    coda_expression_profile *profile;
 };
 
 struct coda_expression_bool_constant_struct
@@ -140,6 +144,7 @@ struct coda_expression_bool_constant_struct
     coda_expression_type result_type;
     int is_constant;
     int recursion_depth;
+    coda_expression_profile *profile;
     int value;
 };
 typedef struct coda_expression_bool_constant_struct coda_expression_bool_constant;
@@ -150,6 +155,7 @@ struct coda_expression_float_constant_struct
     coda_expression_type result_type;
     int is_constant;
     int recursion_depth;
+    coda_expression_profile *profile;
     double value;
 };
 typedef struct coda_expression_float_constant_struct coda_expression_float_constant;
@@ -160,6 +166,7 @@ struct coda_expression_integer_constant_struct
     coda_expression_type result_type;
     int is_constant;
     int recursion_depth;
+    coda_expression_profile *profile;
     int64_t value;
 };
 typedef struct coda_expression_integer_constant_struct coda_expression_integer_constant;
@@ -170,6 +177,7 @@ struct coda_expression_string_constant_struct
     coda_expression_type result_type;
     int is_constant;
     int recursion_depth;
+    coda_expression_profile *profile;
     long length;
     char *value;
 };
@@ -181,8 +189,10 @@ struct coda_expression_operation_struct
     coda_expression_type result_type;
     int is_constant;
     int recursion_depth;
+    coda_expression_profile *profile;
     char *identifier;
     coda_expression *operand[4];
+    coda_time_format *time_format;      /* precompiled format for time() and strtime() with a constant format */
 };
 typedef struct coda_expression_operation_struct coda_expression_operation;
 
@@ -190,4 +200,8 @@ typedef struct coda_expression_operation_struct coda_expression_operation;
 coda_expression *coda_expression_new(coda_expression_node_type tag, char *string_value, coda_expression *op1,
                                      coda_expression *op2, coda_expression *op3, coda_expression *op4);
 
+int coda_expression_set_origin(coda_expression *expr, const char *exprstring, const char *definition_file,
+                               const char *location, const char *item, const char *element, long line);
+void coda_expression_profile_done(void);
+
 #endif
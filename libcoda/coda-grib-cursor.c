@@ -47,6 +47,8 @@
 #include "coda-grib-internal.h"
 #include "coda-bin.h"
 
+#include "zlib.h"
+
 int coda_grib_cursor_set_product(coda_cursor *cursor, coda_product *product)
 {
     cursor->product = product;
@@ -71,9 +73,44 @@ int coda_grib_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const
     return coda_grib_cursor_goto_array_element_by_index(cursor, subs[0]);
 }
 
+static int goto_message(coda_cursor *cursor, long index)
+{
+    coda_grib_message_array *type = (coda_grib_message_array *)cursor->stack[cursor->n - 1].type;
+
+    /* we always check the range since we may need to read the message */
+    if (index < 0 || index >= type->num_elements)
+    {
+        coda_set_error(CODA_ERROR_ARRAY_OUT_OF_BOUNDS, "array index (%ld) exceeds array range [0:%ld) (%s:%u)",
+                       index, type->num_elements, __FILE__, __LINE__);
+        return -1;
+    }
+    if (type->message[index] == NULL)
+    {
+        if (coda_grib_read_message((coda_grib_product *)cursor->product, index) != 0)
+        {
+            return -1;
+        }
+    }
+
+    cursor->n++;
+    cursor->stack[cursor->n - 1].type = type->message[index];
+    cursor->stack[cursor->n - 1].index = index;
+    cursor->stack[cursor->n - 1].bit_offset = -1;
+
+    return 0;
+}
+
 int coda_grib_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
 {
-    coda_grib_value_array *type = (coda_grib_value_array *)cursor->stack[cursor->n - 1].type;
+    coda_grib_value_array *type;
+
+    if (cursor->n == 1)
+    {
+        /* the root of the product is the array of messages */
+        return goto_message(cursor, index);
+    }
+
+    type = (coda_grib_value_array *)cursor->stack[cursor->n - 1].type;
 
     /* check the range for index */
     if (coda_option_perform_boundary_checks)
@@ -119,7 +156,11 @@ int coda_grib_cursor_goto_attributes(coda_cursor *cursor)
 
 int coda_grib_cursor_get_num_elements(const coda_cursor *cursor, long *num_elements)
 {
-    if (cursor->stack[cursor->n - 1].type->definition->type_class == coda_array_class)
+    if (cursor->n == 1)
+    {
+        *num_elements = ((coda_grib_message_array *)cursor->stack[0].type)->num_elements;
+    }
+    else if (cursor->stack[cursor->n - 1].type->definition->type_class == coda_array_class)
     {
         *num_elements = ((coda_grib_value_array *)cursor->stack[cursor->n - 1].type)->num_elements;
     }
@@ -136,6 +177,809 @@ int coda_grib_cursor_get_array_dim(const coda_cursor *cursor, int *num_dims, lon
     return coda_grib_cursor_get_num_elements(cursor, dim);
 }
 
+/* number of packed values that are unpacked per block when reading arrays (should be a multiple of 8) */
+#define UNPACK_BLOCK_SIZE 8192
+
+/* Returns the index in the array of packed values for element 'index' of a value array that has a bitmask.
+ * This equals the number of bits in the bitmask that are set before position 'index'.
+ */
+static long bitmask_get_value_index(const coda_grib_value_array *array, long index)
+{
+    long bm_index = index >> 3;
+    long value_index = 0;
+    long i;
+
+    for (i = 0; i < bm_index >> 4; i++)
+    {
+        /* advance value_index based on cumsum of blocks of 128 bitmap bits (= 16 bytes) */
+        value_index += array->bitmask_cumsum128[16 * i + 15];
+    }
+    if (bm_index % 16 != 0)
+    {
+        value_index += array->bitmask_cumsum128[bm_index - 1];
+    }
+    if ((index & 0x7) != 0)
+    {
+        uint8_t bm = array->bitmask[bm_index];
+
+        for (i = 0; i < (index & 0x7); i++)
+        {
+            value_index += (bm >> (7 - i)) & 1;
+        }
+    }
+
+    return value_index;
+}
+
+/* Unpack 'num_values' consecutive 'bit_size'-bit unsigned integers from 'buffer', starting at bit 'bit_shift'
+ * (0 - 7) of the first byte, and store the scaled values in 'dst'. Requires bit_size <= 57.
+ */
+static void unpack_simple_packing(const uint8_t *buffer, int bit_shift, int bit_size, long num_values,
+                                  double scalefactor, double offset, float *dst)
+{
+    uint64_t mask = (((uint64_t)1) << bit_size) - 1;
+    uint64_t bits;
+    int num_bits;
+    long i;
+
+    bits = *buffer++ & (0xFF >> bit_shift);
+    num_bits = 8 - bit_shift;
+    for (i = 0; i < num_values; i++)
+    {
+        while (num_bits < bit_size)
+        {
+            bits = (bits << 8) | *buffer++;
+            num_bits += 8;
+        }
+        num_bits -= bit_size;
+        dst[i] = (float)((int64_t)((bits >> num_bits) & mask) * scalefactor + offset);
+    }
+}
+
+/* Return the 'bit_size'-bit unsigned integer that starts at bit position 'bit_offset' in 'buffer'.
+ * Requires bit_size <= 57 and at least 8 accessible bytes in buffer starting at byte position (bit_offset >> 3).
+ */
+static uint64_t get_bits(const uint8_t *buffer, int64_t bit_offset, int bit_size)
+{
+    const uint8_t *ptr = &buffer[bit_offset >> 3];
+    uint64_t bits;
+
+    if (bit_size == 0)
+    {
+        return 0;
+    }
+    bits = ((uint64_t)ptr[0] << 56) | ((uint64_t)ptr[1] << 48) | ((uint64_t)ptr[2] << 40) | ((uint64_t)ptr[3] << 32) |
+        ((uint64_t)ptr[4] << 24) | ((uint64_t)ptr[5] << 16) | ((uint64_t)ptr[6] << 8) | (uint64_t)ptr[7];
+
+    return (bits << (bit_offset & 0x7)) >> (64 - bit_size);
+}
+
+/* Return the signed integer (using a sign bit followed by the magnitude) stored in 'num_bytes' bytes */
+static int64_t get_signed_value(const uint8_t *buffer, int num_bytes)
+{
+    int64_t value;
+    int i;
+
+    if (num_bytes == 0)
+    {
+        return 0;
+    }
+    value = buffer[0] & 0x7F;
+    for (i = 1; i < num_bytes; i++)
+    {
+        value = value * 256 + buffer[i];
+    }
+
+    return (buffer[0] & 0x80) ? -value : value;
+}
+
+/* round a bit offset up to the next byte boundary */
+#define BYTE_ALIGN(bit_offset) (((bit_offset) + 7) & ~((int64_t)7))
+
+/* Unpack all values of a value array that uses complex packing (with optional spatial differencing) and store them
+ * in array->unpacked_values. Missing values (as indicated by the missing value management) are set to NaN.
+ */
+static int unpack_complex_packing(coda_product *raw_product, coda_grib_value_array *array)
+{
+    const coda_grib_complex_packing *packing = array->complex_packing;
+    int reference_bit_size = array->element_bit_size;
+    int order = packing->spatial_differencing_order;
+    int64_t first_value[2] = { 0, 0 };
+    int64_t overall_minimum = 0;
+    int64_t reference_offset;
+    int64_t width_offset;
+    int64_t length_offset;
+    int64_t value_offset;
+    int64_t total_length = 0;
+    int64_t total_bit_size = 0;
+    uint64_t missing_reference[2];
+    uint8_t *buffer;
+    uint8_t *missing = NULL;
+    int64_t *ivalue;
+    long num_valid = 0;
+    long index = 0;
+    long i;
+    uint32_t k;
+
+    if (reference_bit_size > 57 || packing->group_width_bit_size > 57 || packing->group_length_bit_size > 57)
+    {
+        coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "unsupported bit size for complex packing group descriptors");
+        return -1;
+    }
+
+    /* the Data Section contains (in this order): the extra descriptors for spatial differencing, the group
+     * reference values, the group widths, the group lengths, and the packed values of all groups;
+     * each of the group descriptor lists starts at a byte boundary */
+    reference_offset = order > 0 ? 8 * (order + 1) * (int64_t)packing->extra_descriptor_byte_size : 0;
+    width_offset = BYTE_ALIGN(reference_offset + (int64_t)packing->num_groups * reference_bit_size);
+    length_offset = BYTE_ALIGN(width_offset + (int64_t)packing->num_groups * packing->group_width_bit_size);
+    value_offset = BYTE_ALIGN(length_offset + (int64_t)packing->num_groups * packing->group_length_bit_size);
+    if (value_offset > 8 * packing->byte_size)
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "Data Section too small for group descriptors of complex packing");
+        return -1;
+    }
+
+    buffer = malloc((size_t)packing->byte_size + 8);
+    if (buffer == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(packing->byte_size + 8), __FILE__, __LINE__);
+        return -1;
+    }
+    if (read_bytes(raw_product, array->bit_offset >> 3, packing->byte_size, buffer) != 0)
+    {
+        free(buffer);
+        return -1;
+    }
+    /* padding so get_bits() can always access 8 bytes */
+    memset(&buffer[packing->byte_size], 0, 8);
+
+    /* verify that the group lengths match the number of values and that all packed values are within the section */
+    for (k = 0; k < packing->num_groups; k++)
+    {
+        int64_t length;
+        int64_t width;
+
+        width = packing->group_width_reference +
+            (int64_t)get_bits(buffer, width_offset + (int64_t)k * packing->group_width_bit_size,
+                              packing->group_width_bit_size);
+        if (k == packing->num_groups - 1)
+        {
+            length = packing->last_group_length;
+        }
+        else
+        {
+            length = packing->group_length_reference + packing->group_length_increment *
+                (int64_t)get_bits(buffer, length_offset + (int64_t)k * packing->group_length_bit_size,
+                                  packing->group_length_bit_size);
+        }
+        if (width > 57)
+        {
+            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "unsupported group width (%ld) for complex packing",
+                           (long)width);
+            free(buffer);
+            return -1;
+        }
+        total_length += length;
+        total_bit_size += length * width;
+    }
+    if (total_length != packing->num_values)
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "total length of complex packing groups (%ld) does not match number of "
+                       "values (%ld)", (long)total_length, packing->num_values);
+        free(buffer);
+        return -1;
+    }
+    if (value_offset + total_bit_size > 8 * packing->byte_size)
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "Data Section too small for packed values of complex packing");
+        free(buffer);
+        return -1;
+    }
+
+    if (order > 0)
+    {
+        for (i = 0; i < order; i++)
+        {
+            first_value[i] = get_signed_value(&buffer[i * packing->extra_descriptor_byte_size],
+                                              packing->extra_descriptor_byte_size);
+        }
+        overall_minimum = get_signed_value(&buffer[order * packing->extra_descriptor_byte_size],
+                                           packing->extra_descriptor_byte_size);
+    }
+
+    array->unpacked_values = malloc((packing->num_values > 0 ? packing->num_values : 1) * sizeof(float));
+    ivalue = malloc((packing->num_values > 0 ? packing->num_values : 1) * sizeof(int64_t));
+    if (packing->missing_value_management > 0)
+    {
+        missing = malloc((packing->num_values > 0 ? packing->num_values : 1) * sizeof(uint8_t));
+    }
+    if (array->unpacked_values == NULL || ivalue == NULL || (packing->missing_value_management > 0 && missing == NULL))
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(packing->num_values * (sizeof(float) + sizeof(int64_t) + sizeof(uint8_t))), __FILE__,
+                       __LINE__);
+        if (array->unpacked_values != NULL)
+        {
+            free(array->unpacked_values);
+            array->unpacked_values = NULL;
+        }
+        if (ivalue != NULL)
+        {
+            free(ivalue);
+        }
+        if (missing != NULL)
+        {
+            free(missing);
+        }
+        free(buffer);
+        return -1;
+    }
+
+    /* reference values that indicate missing values for groups with a width of 0 */
+    missing_reference[0] = (((uint64_t)1) << reference_bit_size) - 1;
+    missing_reference[1] = missing_reference[0] - 1;
+
+    /* unpack the groups; the non-missing values are stored consecutively in ivalue */
+    for (k = 0; k < packing->num_groups; k++)
+    {
+        uint64_t reference;
+        int64_t length;
+        int64_t j;
+        int width;
+
+        reference = get_bits(buffer, reference_offset + (int64_t)k * reference_bit_size, reference_bit_size);
+        width = packing->group_width_reference +
+            (int)get_bits(buffer, width_offset + (int64_t)k * packing->group_width_bit_size,
+                          packing->group_width_bit_size);
+        if (k == packing->num_groups - 1)
+        {
+            length = packing->last_group_length;
+        }
+        else
+        {
+            length = packing->group_length_reference + packing->group_length_increment *
+                (int64_t)get_bits(buffer, length_offset + (int64_t)k * packing->group_length_bit_size,
+                                  packing->group_length_bit_size);
+        }
+
+        if (missing == NULL)
+        {
+            for (j = 0; j < length; j++)
+            {
+                ivalue[num_valid++] = (int64_t)(reference + get_bits(buffer, value_offset, width));
+                value_offset += width;
+            }
+        }
+        else if (width == 0)
+        {
+            int is_missing = (reference == missing_reference[0] ||
+                              (packing->missing_value_management == 2 && reference == missing_reference[1]));
+
+            for (j = 0; j < length; j++)
+            {
+                missing[index++] = (uint8_t)is_missing;
+                if (!is_missing)
+                {
+                    ivalue[num_valid++] = (int64_t)reference;
+                }
+            }
+        }
+        else
+        {
+            uint64_t missing_value[2];
+
+            missing_value[0] = (((uint64_t)1) << width) - 1;
+            missing_value[1] = missing_value[0] - 1;
+            for (j = 0; j < length; j++)
+            {
+                uint64_t value = get_bits(buffer, value_offset, width);
+
+                value_offset += width;
+                if (value == missing_value[0] ||
+                    (packing->missing_value_management == 2 && value == missing_value[1]))
+                {
+                    missing[index++] = 1;
+                }
+                else
+                {
+                    missing[index++] = 0;
+                    ivalue[num_valid++] = (int64_t)(reference + value);
+                }
+            }
+        }
+    }
+    free(buffer);
+
+    /* undo the spatial differencing (which is only applied to the non-missing values) */
+    if (order == 1)
+    {
+        if (num_valid > 0)
+        {
+            ivalue[0] = first_value[0];
+        }
+        for (i = 1; i < num_valid; i++)
+        {
+            ivalue[i] += overall_minimum + ivalue[i - 1];
+        }
+    }
+    else if (order == 2)
+    {
+        for (i = 0; i < num_valid && i < 2; i++)
+        {
+            ivalue[i] = first_value[i];
+        }
+        for (i = 2; i < num_valid; i++)
+        {
+            ivalue[i] += overall_minimum + 2 * ivalue[i - 1] - ivalue[i - 2];
+        }
+    }
+
+    num_valid = 0;
+    for (i = 0; i < packing->num_values; i++)
+    {
+        if (missing != NULL && missing[i])
+        {
+            array->unpacked_values[i] = (float)coda_NaN();
+        }
+        else
+        {
+            array->unpacked_values[i] = (float)(ivalue[num_valid++] * array->scalefactor + array->offset);
+        }
+    }
+
+    free(ivalue);
+    if (missing != NULL)
+    {
+        free(missing);
+    }
+
+    return 0;
+}
+
+static uint32_t get_uint32(const uint8_t *buffer)
+{
+    return (((uint32_t)buffer[0] * 256 + buffer[1]) * 256 + buffer[2]) * 256 + buffer[3];
+}
+
+/* find the next IDAT chunk of the PNG image in 'buffer' at or after byte position 'offset' and make it the input
+ * for the zlib stream; returns 0 on success, and -1 if there are no more IDAT chunks */
+static int png_next_idat(const uint8_t *buffer, int64_t size, int64_t *offset, z_stream *zs)
+{
+    while (*offset + 12 <= size)
+    {
+        uint32_t length = get_uint32(&buffer[*offset]);
+        int is_idat = memcmp(&buffer[*offset + 4], "IDAT", 4) == 0;
+
+        if ((int64_t)length > size - *offset - 12)
+        {
+            break;
+        }
+        *offset += 8;
+        if (is_idat && length > 0)
+        {
+            zs->next_in = (Bytef *)&buffer[*offset];
+            zs->avail_in = length;
+            *offset += length + 4;
+            return 0;
+        }
+        *offset += length + 4;
+    }
+    return -1;
+}
+
+/* reverse the PNG filter of a row; 'bpp' is the number of bytes per complete pixel (minimum 1) */
+static int png_unfilter_row(int filter_type, uint8_t *row, const uint8_t *prev_row, long row_size, int bpp)
+{
+    long i;
+
+    switch (filter_type)
+    {
+        case 0:
+            break;
+        case 1:
+            for (i = bpp; i < row_size; i++)
+            {
+                row[i] += row[i - bpp];
+            }
+            break;
+        case 2:
+            for (i = 0; i < row_size; i++)
+            {
+                row[i] += prev_row[i];
+            }
+            break;
+        case 3:
+            for (i = 0; i < bpp; i++)
+            {
+                row[i] += prev_row[i] >> 1;
+            }
+            for (i = bpp; i < row_size; i++)
+            {
+                row[i] += (row[i - bpp] + prev_row[i]) >> 1;
+            }
+            break;
+        case 4:
+            for (i = 0; i < bpp; i++)
+            {
+                row[i] += prev_row[i];
+            }
+            for (i = bpp; i < row_size; i++)
+            {
+                int a = row[i - bpp];
+                int b = prev_row[i];
+                int c = prev_row[i - bpp];
+                int pa = abs(b - c);
+                int pb = abs(a - c);
+                int pc = abs(a + b - 2 * c);
+
+                row[i] += (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+            }
+            break;
+        default:
+            coda_set_error(CODA_ERROR_PRODUCT, "invalid PNG filter type (%d)", filter_type);
+            return -1;
+    }
+
+    return 0;
+}
+
+/* Read packed values [value_index, value_index + num_values) of a value array that uses PNG packing.
+ * The image is decompressed row by row and the values are scaled directly into dst; decompression stops as soon
+ * as the last requested row has been processed.
+ */
+static int read_png_values(coda_product *raw_product, const coda_grib_value_array *array, long value_index,
+                           long num_values, float *dst)
+{
+    int bit_size = array->element_bit_size;
+    uint8_t *buffer;
+    uint8_t *row[2];
+    int64_t offset;
+    z_stream zs;
+    uint32_t width;
+    uint32_t height;
+    long row_size;
+    long first_row;
+    long last_row;
+    long current_row;
+    long num_filled;
+    int bpp;
+    int result;
+
+    if (value_index + num_values > array->num_packed_values)
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "number of grid points in bitmap exceeds number of packed values (%ld)",
+                       array->num_packed_values);
+        return -1;
+    }
+
+    buffer = malloc((size_t)array->packed_byte_size + 1);
+    if (buffer == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(array->packed_byte_size + 1), __FILE__, __LINE__);
+        return -1;
+    }
+    if (read_bytes(raw_product, array->bit_offset >> 3, array->packed_byte_size, buffer) != 0)
+    {
+        free(buffer);
+        return -1;
+    }
+
+    /* PNG signature followed by the IHDR chunk */
+    if (array->packed_byte_size < 33 || memcmp(buffer, "\211PNG\r\n\032\n", 8) != 0 ||
+        memcmp(&buffer[12], "IHDR", 4) != 0)
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "invalid PNG image in Data Section");
+        free(buffer);
+        return -1;
+    }
+    width = get_uint32(&buffer[16]);
+    height = get_uint32(&buffer[20]);
+    /* the image can be grayscale (1, 2, 4, 8, or 16 bits), RGB (3x8 bits), or RGBA (4x8 bits) */
+    if (buffer[28] != 0 || !((buffer[25] == 0 && buffer[24] * 1 == bit_size && bit_size <= 16) ||
+                             (buffer[25] == 2 && buffer[24] * 3 == bit_size) ||
+                             (buffer[25] == 6 && buffer[24] * 4 == bit_size)))
+    {
+        coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "unsupported PNG image (bit depth %d, color type %d, "
+                       "interlace method %d) for %d bits per value", buffer[24], buffer[25], buffer[28], bit_size);
+        free(buffer);
+        return -1;
+    }
+    if (width == 0 || (int64_t)width * height < array->num_packed_values)
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "size of PNG image (%lux%lu) too small for number of packed values (%ld)",
+                       (unsigned long)width, (unsigned long)height, array->num_packed_values);
+        free(buffer);
+        return -1;
+    }
+    if (num_values <= 0)
+    {
+        free(buffer);
+        return 0;
+    }
+    row_size = (long)(((int64_t)width * bit_size + 7) >> 3);
+    bpp = bit_size < 8 ? 1 : bit_size >> 3;
+    first_row = value_index / width;
+    last_row = (value_index + num_values - 1) / width;
+
+    /* each row buffer contains the filter type byte followed by the row data; the buffers are initialized with zeros
+     * since the row before the first row should be treated as a row with only zeros */
+    row[0] = calloc(2 * ((size_t)row_size + 1), 1);
+    if (row[0] == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(2 * (row_size + 1)), __FILE__, __LINE__);
+        free(buffer);
+        return -1;
+    }
+    row[1] = row[0] + row_size + 1;
+
+    zs.next_in = Z_NULL;
+    zs.avail_in = 0;
+    zs.zalloc = Z_NULL;
+    zs.zfree = Z_NULL;
+    zs.opaque = Z_NULL;
+    zs.msg = NULL;
+    if (inflateInit(&zs) != Z_OK)
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "could not intialize zip decompression");
+        if (zs.msg != NULL)
+        {
+            coda_add_error_message(" (%s)", zs.msg);
+        }
+        free(row[0]);
+        free(buffer);
+        return -1;
+    }
+
+    offset = 33;
+    current_row = 0;
+    num_filled = 0;
+    while (current_row <= last_row)
+    {
+        uint8_t *data = &row[current_row & 1][1];
+        const uint8_t *prev_data = &row[(current_row + 1) & 1][1];
+        long first_column;
+        long last_column;
+        long i;
+
+        if (zs.avail_in == 0 && png_next_idat(buffer, array->packed_byte_size, &offset, &zs) != 0)
+        {
+            coda_set_error(CODA_ERROR_PRODUCT, "PNG image in Data Section is incomplete");
+            break;
+        }
+        zs.next_out = &row[current_row & 1][num_filled];
+        zs.avail_out = (uInt)(row_size + 1 - num_filled);
+        result = inflate(&zs, Z_NO_FLUSH);
+        if (result != Z_OK && !(result == Z_STREAM_END && zs.avail_out == 0))
+        {
+            if (result == Z_MEM_ERROR)
+            {
+                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, NULL);
+            }
+            else
+            {
+                coda_set_error(CODA_ERROR_PRODUCT, "invalid or incomplete compressed data for PNG image");
+                if (zs.msg != NULL)
+                {
+                    coda_add_error_message(" (%s)", zs.msg);
+                }
+            }
+            break;
+        }
+        num_filled = row_size + 1 - zs.avail_out;
+        if (num_filled < row_size + 1)
+        {
+            continue;
+        }
+
+        /* we have a complete row */
+        num_filled = 0;
+        if (png_unfilter_row(data[-1], data, prev_data, row_size, bpp) != 0)
+        {
+            break;
+        }
+        if (current_row >= first_row)
+        {
+            first_column = current_row == first_row ? value_index % width : 0;
+            last_column = current_row == last_row ? (value_index + num_values - 1) % width : (long)width - 1;
+            for (i = first_column; i <= last_column; i++)
+            {
+                uint32_t value;
+
+                switch (bit_size)
+                {
+                    case 8:
+                        value = data[i];
+                        break;
+                    case 16:
+                        value = ((uint32_t)data[2 * i] << 8) | data[2 * i + 1];
+                        break;
+                    case 24:
+                        value = ((uint32_t)data[3 * i] << 16) | ((uint32_t)data[3 * i + 1] << 8) | data[3 * i + 2];
+                        break;
+                    case 32:
+                        value = get_uint32(&data[4 * i]);
+                        break;
+                    default:
+                        /* 1, 2, or 4 bits; pixels are packed from the most significant bit onwards */
+                        value = (data[(i * bit_size) >> 3] >> (8 - bit_size - ((i * bit_size) & 0x7))) &
+                            ((1 << bit_size) - 1);
+                        break;
+                }
+                dst[current_row * (long)width + i - value_index] =
+                    (float)(value * array->scalefactor + array->offset);
+            }
+        }
+        current_row++;
+    }
+    inflateEnd(&zs);
+    free(row[0]);
+    free(buffer);
+
+    return current_row > last_row ? 0 : -1;
+}
+
+/* read 'num_values' packed values starting at packed value 'value_index' */
+static int read_packed_values(coda_product *raw_product, const coda_grib_value_array *array, long value_index,
+                              long num_values, float *dst)
+{
+    uint8_t *buffer;
+    long i;
+
+    if (num_values <= 0)
+    {
+        return 0;
+    }
+
+    if (array->png_packing && array->unpacked_values == NULL)
+    {
+        return read_png_values(raw_product, array, value_index, num_values, dst);
+    }
+
+    if (array->complex_packing != NULL || array->png_packing)
+    {
+        long num_packed_values;
+
+        if (array->unpacked_values == NULL)
+        {
+            /* the values of an array with complex packing can only be decoded all at once */
+            if (unpack_complex_packing(raw_product, (coda_grib_value_array *)array) != 0)
+            {
+                return -1;
+            }
+        }
+        num_packed_values = array->png_packing ? array->num_packed_values : array->complex_packing->num_values;
+        if (value_index + num_values > num_packed_values)
+        {
+            coda_set_error(CODA_ERROR_PRODUCT, "number of grid points in bitmap exceeds number of packed values (%ld)",
+                           num_packed_values);
+            return -1;
+        }
+        memcpy(dst, &array->unpacked_values[value_index], num_values * sizeof(float));
+        return 0;
+    }
+
+    if (array->element_bit_size > 57)
+    {
+        /* too large for the unpack accumulator; read values individually */
+        for (i = 0; i < num_values; i++)
+        {
+            int64_t ivalue = 0;
+            uint8_t *ibuffer = &((uint8_t *)&ivalue)[8 - bit_size_to_byte_size(array->element_bit_size)];
+
+            if (read_bits(raw_product, array->bit_offset + (value_index + i) * array->element_bit_size,
+                          array->element_bit_size, ibuffer) != 0)
+            {
+                return -1;
+            }
+#ifndef WORDS_BIGENDIAN
+            swap8(&ivalue);
+#endif
+            dst[i] = (float)(ivalue * array->scalefactor + array->offset);
+        }
+        return 0;
+    }
+
+    /* we read the data in blocks; since the block size is a multiple of 8, each block starts at the same bit shift */
+    buffer = malloc(UNPACK_BLOCK_SIZE * array->element_bit_size / 8 + 1);
+    if (buffer == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(UNPACK_BLOCK_SIZE * array->element_bit_size / 8 + 1), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_values; i += UNPACK_BLOCK_SIZE)
+    {
+        long block_size = num_values - i < UNPACK_BLOCK_SIZE ? num_values - i : UNPACK_BLOCK_SIZE;
+        int64_t bit_offset = array->bit_offset + (int64_t)(value_index + i) * array->element_bit_size;
+        int64_t byte_size = ((bit_offset & 0x7) + (int64_t)block_size * array->element_bit_size + 7) >> 3;
+
+        if (read_bytes(raw_product, bit_offset >> 3, byte_size, buffer) != 0)
+        {
+            free(buffer);
+            return -1;
+        }
+        unpack_simple_packing(buffer, (int)(bit_offset & 0x7), array->element_bit_size, block_size,
+                              array->scalefactor, array->offset, &dst[i]);
+    }
+    free(buffer);
+
+    return 0;
+}
+
+/* read elements [offset, offset + length) of the value array at the cursor position */
+static int read_float_values(const coda_cursor *cursor, long offset, long length, float *dst)
+{
+    coda_grib_value_array *array = (coda_grib_value_array *)cursor->stack[cursor->n - 1].type;
+    coda_product *raw_product = ((coda_grib_product *)cursor->product)->raw_product;
+    long value_index;
+    long num_values;
+    long i;
+
+    if (length <= 0)
+    {
+        return 0;
+    }
+
+    if (!array->simple_packing)
+    {
+        if (read_bytes(raw_product, (array->bit_offset >> 3) + offset * 4, length * 4, dst) != 0)
+        {
+            return -1;
+        }
+#ifndef WORDS_BIGENDIAN
+        for (i = 0; i < length; i++)
+        {
+            swap_float(&dst[i]);
+        }
+#endif
+        return 0;
+    }
+
+    if (array->element_bit_size == 0 && array->complex_packing == NULL)
+    {
+        for (i = 0; i < length; i++)
+        {
+            dst[i] = array->referenceValue;
+        }
+        return 0;
+    }
+
+    if (array->bitmask == NULL)
+    {
+        return read_packed_values(raw_product, array, offset, length, dst);
+    }
+
+    /* read the packed values into the end of dst and then expand them in place (front to back) using the bitmask;
+     * this works since the read position is never before the write position */
+    value_index = bitmask_get_value_index(array, offset);
+    num_values = bitmask_get_value_index(array, offset + length) - value_index;
+    if (read_packed_values(raw_product, array, value_index, num_values, &dst[length - num_values]) != 0)
+    {
+        return -1;
+    }
+    value_index = length - num_values;
+    for (i = 0; i < length; i++)
+    {
+        long index = offset + i;
+
+        if ((array->bitmask[index >> 3] >> (7 - (index & 0x7))) & 1)
+        {
+            dst[i] = dst[value_index];
+            value_index++;
+        }
+        else
+        {
+            dst[i] = (float)coda_NaN();
+        }
+    }
+
+    return 0;
+}
+
 int coda_grib_cursor_read_float(const coda_cursor *cursor, float *dst)
 {
     coda_grib_value_array *array;
@@ -150,21 +994,14 @@ int coda_grib_cursor_read_float(const coda_cursor *cursor, float *dst)
         int64_t ivalue = 0;
         uint8_t *buffer;
 
-        if (array->element_bit_size == 0)
+        if (array->element_bit_size == 0 && array->complex_packing == NULL)
         {
             *((float *)dst) = array->referenceValue;
             return 0;
         }
         if (array->bitmask != NULL)
         {
-            uint8_t bm;
-            long bm_index;
-            long value_index = 0;
-            long i;
-
-            bm_index = index >> 3;
-            bm = array->bitmask[bm_index];
-            if (!((bm >> (7 - (index & 0x7))) & 1))
+            if (!((array->bitmask[index >> 3] >> (7 - (index & 0x7))) & 1))
             {
                 /* bitmask value is 0 -> return NaN */
                 *((float *)dst) = (float)coda_NaN();
@@ -172,21 +1009,29 @@ int coda_grib_cursor_read_float(const coda_cursor *cursor, float *dst)
             }
 
             /* bitmask value is 1 -> update index to be the index in the value array */
-            for (i = 0; i < bm_index >> 4; i++)
-            {
-                /* advance value_index based on cumsum of blocks of 128 bitmap bits (= 16 bytes) */
-                value_index += array->bitmask_cumsum128[16 * i + 15];
-            }
-            if (bm_index % 16 != 0)
+            index = bitmask_get_value_index(array, index);
+        }
+        if (array->png_packing && array->unpacked_values == NULL && array->num_packed_values > 0)
+        {
+            /* decode the full image once, so reading all elements one by one does not become quadratic */
+            array->unpacked_values = malloc(array->num_packed_values * sizeof(float));
+            if (array->unpacked_values == NULL)
             {
-                value_index += array->bitmask_cumsum128[bm_index - 1];
+                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                               (long)(array->num_packed_values * sizeof(float)), __FILE__, __LINE__);
+                return -1;
             }
-            bm = array->bitmask[bm_index];
-            for (i = 0; i < (index & 0x7); i++)
+            if (read_png_values(((coda_grib_product *)cursor->product)->raw_product, array, 0,
+                                array->num_packed_values, array->unpacked_values) != 0)
             {
-                value_index += (bm >> (7 - i)) & 1;
+                free(array->unpacked_values);
+                array->unpacked_values = NULL;
+                return -1;
             }
-            index = value_index;
+        }
+        if (array->complex_packing != NULL || array->png_packing)
+        {
+            return read_packed_values(((coda_grib_product *)cursor->product)->raw_product, array, index, 1, dst);
         }
         buffer = &((uint8_t *)&ivalue)[8 - bit_size_to_byte_size(array->element_bit_size)];
         if (read_bits(((coda_grib_product *)cursor->product)->raw_product,
@@ -218,48 +1063,10 @@ int coda_grib_cursor_read_float_array(const coda_cursor *cursor, float *dst)
 {
     coda_grib_value_array *array = (coda_grib_value_array *)cursor->stack[cursor->n - 1].type;
 
-    if (array->num_elements > 0)
-    {
-        coda_cursor element_cursor = *cursor;
-        long i;
-
-        element_cursor.n++;
-        element_cursor.stack[element_cursor.n - 1].type = array->base_type;
-        element_cursor.stack[element_cursor.n - 1].bit_offset = -1;
-        for (i = 0; i < array->num_elements; i++)
-        {
-            element_cursor.stack[element_cursor.n - 1].index = i;
-            if (coda_grib_cursor_read_float(&element_cursor, &((float *)dst)[i]) != 0)
-            {
-                return -1;
-            }
-        }
-    }
-
-    return 0;
+    return read_float_values(cursor, 0, array->num_elements, dst);
 }
 
 int coda_grib_cursor_read_float_partial_array(const coda_cursor *cursor, long offset, long length, float *dst)
 {
-    coda_grib_value_array *array = (coda_grib_value_array *)cursor->stack[cursor->n - 1].type;
-
-    if (array->num_elements > 0)
-    {
-        coda_cursor element_cursor = *cursor;
-        long i;
-
-        element_cursor.n++;
-        element_cursor.stack[element_cursor.n - 1].type = array->base_type;
-        element_cursor.stack[element_cursor.n - 1].bit_offset = -1;
-        for (i = 0; i < length; i++)
-        {
-            element_cursor.stack[element_cursor.n - 1].index = offset + i;
-            if (coda_grib_cursor_read_float(&element_cursor, &((float *)dst)[i]) != 0)
-            {
-                return -1;
-            }
-        }
-    }
-
-    return 0;
+    return read_float_values(cursor, offset, length, dst);
 }
@@ -36,6 +36,23 @@
 #include "coda-type.h"
 #include "coda-bin-internal.h"
 
+/* parameters of complex packing (GRIB2 Data Representation Templates 5.2 and 5.3) */
+typedef struct coda_grib_complex_packing_struct
+{
+    long num_values;    /* number of packed values (including missing values, but excluding bitmap points) */
+    int64_t byte_size;  /* size of the Data Section content */
+    uint8_t missing_value_management;
+    uint32_t num_groups;
+    uint8_t group_width_reference;
+    uint8_t group_width_bit_size;
+    uint32_t group_length_reference;
+    uint8_t group_length_increment;
+    uint32_t last_group_length;
+    uint8_t group_length_bit_size;
+    uint8_t spatial_differencing_order; /* 0 (no spatial differencing), 1, or 2 */
+    uint8_t extra_descriptor_byte_size; /* number of bytes for the first values and overall minimum */
+} coda_grib_complex_packing;
+
 typedef struct coda_grib_value_array_struct
 {
     coda_backend backend;
@@ -54,8 +71,23 @@ typedef struct coda_grib_value_array_struct
     double offset;      /* combination of referenceValue and decimalScaleFactor */
     uint8_t *bitmask;
     uint8_t *bitmask_cumsum128;
+    coda_grib_complex_packing *complex_packing; /* only set if complex packing is used */
+    int png_packing;    /* if 1, the packed values are stored as a PNG image */
+    long num_packed_values;     /* number of values in the PNG image */
+    int64_t packed_byte_size;   /* size of the PNG image */
+    float *unpacked_values;     /* complex/PNG packing values; will be NULL until all data has been decoded */
 } coda_grib_value_array;
 
+/* root array of a GRIB product; the messages are only read when they are accessed for the first time */
+typedef struct coda_grib_message_array_struct
+{
+    coda_backend backend;
+    coda_type_array *definition;
+
+    long num_elements;
+    int64_t *message_offset;    /* file offset of the Indicator Section of each message */
+    coda_dynamic_type **message;        /* will be NULL for messages that have not been read yet */
+} coda_grib_message_array;
 
 typedef struct coda_grib_product_struct
 {
@@ -75,10 +107,25 @@ typedef struct coda_grib_product_struct
 } coda_grib_product;
 
 
+coda_grib_message_array *coda_grib_message_array_new(coda_type_array *definition);
+int coda_grib_message_array_add_message(coda_grib_message_array *type, int64_t file_offset);
+int coda_grib_read_message(coda_grib_product *product, long index);
+
 coda_grib_value_array *coda_grib_value_array_new(coda_type_array *definition, long num_elements, int64_t byte_offset);
 coda_grib_value_array *coda_grib_value_array_simple_packing_new(coda_type_array *definition, long num_elements,
                                                                 int64_t byte_offset, int element_bit_size,
                                                                 int16_t decimalScaleFactor, int16_t binaryScaleFactor,
                                                                 float referenceValue, const uint8_t *bitmask);
+coda_grib_value_array *coda_grib_value_array_complex_packing_new(coda_type_array *definition, long num_elements,
+                                                                 int64_t byte_offset, int element_bit_size,
+                                                                 int16_t decimalScaleFactor,
+                                                                 int16_t binaryScaleFactor, float referenceValue,
+                                                                 const uint8_t *bitmask,
+                                                                 const coda_grib_complex_packing *complex_packing);
+coda_grib_value_array *coda_grib_value_array_png_packing_new(coda_type_array *definition, long num_elements,
+                                                             int64_t byte_offset, int element_bit_size,
+                                                             int16_t decimalScaleFactor, int16_t binaryScaleFactor,
+                                                             float referenceValue, const uint8_t *bitmask,
+                                                             long num_packed_values, int64_t packed_byte_size);
 
 #endif
@@ -61,7 +61,31 @@ void coda_grib_type_delete(coda_dynamic_type *type)
     assert(type != NULL);
     assert(type->backend == coda_backend_grib);
 
-    if (type->definition->type_class == coda_array_class)
+    if (type->definition->type_class == coda_array_class &&
+        ((coda_type_array *)type->definition)->base_type->type_class == coda_record_class)
+    {
+        coda_grib_message_array *message_array = (coda_grib_message_array *)type;
+
+        /* root array of messages */
+        if (message_array->message != NULL)
+        {
+            long i;
+
+            for (i = 0; i < message_array->num_elements; i++)
+            {
+                if (message_array->message[i] != NULL)
+                {
+                    coda_dynamic_type_delete(message_array->message[i]);
+                }
+            }
+            free(message_array->message);
+        }
+        if (message_array->message_offset != NULL)
+        {
+            free(message_array->message_offset);
+        }
+    }
+    else if (type->definition->type_class == coda_array_class)
     {
         if (((coda_grib_value_array *)type)->base_type != NULL)
         {
@@ -75,6 +99,14 @@ void coda_grib_type_delete(coda_dynamic_type *type)
         {
             free(((coda_grib_value_array *)type)->bitmask_cumsum128);
         }
+        if (((coda_grib_value_array *)type)->complex_packing != NULL)
+        {
+            free(((coda_grib_value_array *)type)->complex_packing);
+        }
+        if (((coda_grib_value_array *)type)->unpacked_values != NULL)
+        {
+            free(((coda_grib_value_array *)type)->unpacked_values);
+        }
     }
     if (type->definition != NULL)
     {
@@ -83,6 +115,65 @@ void coda_grib_type_delete(coda_dynamic_type *type)
     free(type);
 }
 
+coda_grib_message_array *coda_grib_message_array_new(coda_type_array *definition)
+{
+    coda_grib_message_array *type;
+
+    if (definition == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "definition argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return NULL;
+    }
+
+    type = (coda_grib_message_array *)malloc(sizeof(coda_grib_message_array));
+    if (type == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)sizeof(coda_grib_message_array), __FILE__, __LINE__);
+        return NULL;
+    }
+    type->backend = coda_backend_grib;
+    type->definition = definition;
+    definition->retain_count++;
+    type->num_elements = 0;
+    type->message_offset = NULL;
+    type->message = NULL;
+
+    return type;
+}
+
+int coda_grib_message_array_add_message(coda_grib_message_array *type, int64_t file_offset)
+{
+    if (type->num_elements % BLOCK_SIZE == 0)
+    {
+        int64_t *new_message_offset;
+        coda_dynamic_type **new_message;
+
+        new_message_offset = realloc(type->message_offset, (type->num_elements + BLOCK_SIZE) * sizeof(int64_t));
+        if (new_message_offset == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)((type->num_elements + BLOCK_SIZE) * sizeof(int64_t)), __FILE__, __LINE__);
+            return -1;
+        }
+        type->message_offset = new_message_offset;
+        new_message = realloc(type->message, (type->num_elements + BLOCK_SIZE) * sizeof(coda_dynamic_type *));
+        if (new_message == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)((type->num_elements + BLOCK_SIZE) * sizeof(coda_dynamic_type *)), __FILE__,
+                           __LINE__);
+            return -1;
+        }
+        type->message = new_message;
+    }
+    type->message_offset[type->num_elements] = file_offset;
+    type->message[type->num_elements] = NULL;
+    type->num_elements++;
+
+    return 0;
+}
+
 coda_grib_value_array *coda_grib_value_array_new(coda_type_array *definition, long num_elements, int64_t byte_offset)
 {
     coda_grib_value_array *type;
@@ -121,6 +212,11 @@ coda_grib_value_array *coda_grib_value_array_new(coda_type_array *definition, lo
     type->offset = 0.0;
     type->bitmask = NULL;
     type->bitmask_cumsum128 = NULL;
+    type->complex_packing = NULL;
+    type->png_packing = 0;
+    type->num_packed_values = 0;
+    type->packed_byte_size = 0;
+    type->unpacked_values = NULL;
 
     type->base_type = (coda_dynamic_type *)malloc(sizeof(coda_dynamic_type));
     if (type->base_type == NULL)
@@ -198,3 +294,54 @@ coda_grib_value_array *coda_grib_value_array_simple_packing_new(coda_type_array
 
     return type;
 }
+
+coda_grib_value_array *coda_grib_value_array_complex_packing_new(coda_type_array *definition, long num_elements,
+                                                                 int64_t byte_offset, int element_bit_size,
+                                                                 int16_t decimalScaleFactor,
+                                                                 int16_t binaryScaleFactor, float referenceValue,
+                                                                 const uint8_t *bitmask,
+                                                                 const coda_grib_complex_packing *complex_packing)
+{
+    coda_grib_value_array *type;
+
+    type = coda_grib_value_array_simple_packing_new(definition, num_elements, byte_offset, element_bit_size,
+                                                    decimalScaleFactor, binaryScaleFactor, referenceValue, bitmask);
+    if (type == NULL)
+    {
+        return NULL;
+    }
+
+    type->complex_packing = (coda_grib_complex_packing *)malloc(sizeof(coda_grib_complex_packing));
+    if (type->complex_packing == NULL)
+    {
+        coda_grib_type_delete((coda_dynamic_type *)type);
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)sizeof(coda_grib_complex_packing), __FILE__, __LINE__);
+        return NULL;
+    }
+    memcpy(type->complex_packing, complex_packing, sizeof(coda_grib_complex_packing));
+
+    return type;
+}
+
+coda_grib_value_array *coda_grib_value_array_png_packing_new(coda_type_array *definition, long num_elements,
+                                                             int64_t byte_offset, int element_bit_size,
+                                                             int16_t decimalScaleFactor, int16_t binaryScaleFactor,
+                                                             float referenceValue, const uint8_t *bitmask,
+                                                             long num_packed_values, int64_t packed_byte_size)
+{
+    coda_grib_value_array *type;
+
+    type = coda_grib_value_array_simple_packing_new(definition, num_elements, byte_offset, element_bit_size,
+                                                    decimalScaleFactor, binaryScaleFactor, referenceValue, bitmask);
+    if (type == NULL)
+    {
+        return NULL;
+    }
+
+    type->png_packing = 1;
+    type->num_packed_values = num_packed_values;
+    type->packed_byte_size = packed_byte_size;
+
+    return type;
+}
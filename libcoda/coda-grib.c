@@ -40,8 +40,11 @@
 #include "coda-swap8.h"
 #endif
 
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <assert.h>
 #include <errno.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #ifdef HAVE_UNISTD_H
@@ -2214,6 +2217,11 @@ static int read_grib2_message(coda_grib_product *product, coda_mem_record *messa
     float referenceValue = 0;
     uint8_t bitsPerValue = 0;
     uint32_t num_elements = 0;
+    uint32_t num_data_points = 0;
+    coda_grib_complex_packing complex_packing;
+    int has_complex_packing = 0;
+    int has_png_packing = 0;
+    uint32_t num_packed_values = 0;
     uint32_t section_size;
     uint8_t buffer[64];
     uint8_t prev_section;
@@ -2363,7 +2371,6 @@ static int read_grib2_message(coda_grib_product *product, coda_mem_record *messa
         else if (*buffer == 3)
         {
             coda_mem_record *grid;
-            uint32_t num_data_points;
             uint16_t template_number;
             uint8_t number_size;
             uint8_t number_interpretation;
@@ -2813,38 +2820,94 @@ static int read_grib2_message(coda_grib_product *product, coda_mem_record *messa
                 return -1;
             }
             num_elements = (((uint32_t)buffer[0] * 256 + buffer[1]) * 256 + buffer[2]) * 256 + buffer[3];
+            num_packed_values = num_elements;
             dataRepresentationTemplate = buffer[4] * 256 + buffer[5];
             file_offset += 6;
 
-            if (dataRepresentationTemplate == 0 || dataRepresentationTemplate == 1)
+            if (dataRepresentationTemplate > 3 && dataRepresentationTemplate != 41)
             {
-                if (read_bytes(product->raw_product, file_offset, 4, &referenceValue) < 0)
+                coda_set_error(CODA_ERROR_PRODUCT, "unsupported Data Representation Template (%d)",
+                               dataRepresentationTemplate);
+                return -1;
+            }
+
+            /* the initial part is the same for simple packing (5.0), matrix values (5.1), complex packing (5.2, 5.3),
+             * and PNG packing (5.41) */
+            if (read_bytes(product->raw_product, file_offset, 4, &referenceValue) < 0)
+            {
+                return -1;
+            }
+#ifndef WORDS_BIGENDIAN
+            swap_float(&referenceValue);
+#endif
+            if (read_bytes(product->raw_product, file_offset + 4, 5, buffer) < 0)
+            {
+                return -1;
+            }
+
+            binaryScaleFactor = (buffer[0] & 0x80 ? -1 : 1) * ((buffer[0] & 0x7F) * 256 + buffer[1]);
+            decimalScaleFactor = (buffer[2] & 0x80 ? -1 : 1) * ((buffer[2] & 0x7F) * 256 + buffer[3]);
+            bitsPerValue = buffer[4];
+            if (bitsPerValue > 63)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT, "bitsPerValue (%d) too large", bitsPerValue);
+                return -1;
+            }
+            file_offset += 9;
+            has_complex_packing = 0;
+            has_png_packing = (dataRepresentationTemplate == 41);
+            if (dataRepresentationTemplate == 2 || dataRepresentationTemplate == 3)
+            {
+                /* complex packing (and spatial differencing) */
+                if (section_size < (uint32_t)(dataRepresentationTemplate == 2 ? 47 : 49))
                 {
+                    coda_set_error(CODA_ERROR_PRODUCT, "invalid size (%ld) of Data Representation Section",
+                                   (long)section_size);
                     return -1;
                 }
-#ifndef WORDS_BIGENDIAN
-                swap_float(&referenceValue);
-#endif
-                if (read_bytes(product->raw_product, file_offset + 4, 5, buffer) < 0)
+                if (read_bytes(product->raw_product, file_offset, dataRepresentationTemplate == 2 ? 27 : 29,
+                               buffer) < 0)
                 {
                     return -1;
                 }
-
-                binaryScaleFactor = (buffer[0] & 0x80 ? -1 : 1) * ((buffer[0] & 0x7F) * 256 + buffer[1]);
-                decimalScaleFactor = (buffer[2] & 0x80 ? -1 : 1) * ((buffer[2] & 0x7F) * 256 + buffer[3]);
-                bitsPerValue = buffer[4];
-                if (bitsPerValue > 63)
+                complex_packing.num_values = num_elements;
+                complex_packing.missing_value_management = buffer[2];
+                complex_packing.num_groups =
+                    (((uint32_t)buffer[11] * 256 + buffer[12]) * 256 + buffer[13]) * 256 + buffer[14];
+                complex_packing.group_width_reference = buffer[15];
+                complex_packing.group_width_bit_size = buffer[16];
+                complex_packing.group_length_reference =
+                    (((uint32_t)buffer[17] * 256 + buffer[18]) * 256 + buffer[19]) * 256 + buffer[20];
+                complex_packing.group_length_increment = buffer[21];
+                complex_packing.last_group_length =
+                    (((uint32_t)buffer[22] * 256 + buffer[23]) * 256 + buffer[24]) * 256 + buffer[25];
+                complex_packing.group_length_bit_size = buffer[26];
+                complex_packing.spatial_differencing_order = 0;
+                complex_packing.extra_descriptor_byte_size = 0;
+                if (dataRepresentationTemplate == 3)
+                {
+                    complex_packing.spatial_differencing_order = buffer[27];
+                    complex_packing.extra_descriptor_byte_size = buffer[28];
+                    if (buffer[27] != 1 && buffer[27] != 2)
+                    {
+                        coda_set_error(CODA_ERROR_PRODUCT, "unsupported order of spatial differencing (%d)",
+                                       buffer[27]);
+                        return -1;
+                    }
+                    if (buffer[28] > 4)
+                    {
+                        coda_set_error(CODA_ERROR_PRODUCT, "unsupported number of octets (%d) for extra "
+                                       "descriptors of spatial differencing", buffer[28]);
+                        return -1;
+                    }
+                }
+                if (complex_packing.missing_value_management > 2)
                 {
-                    coda_set_error(CODA_ERROR_PRODUCT, "bitsPerValue (%d) too large", bitsPerValue);
+                    coda_set_error(CODA_ERROR_PRODUCT, "invalid missing value management (%d)",
+                                   complex_packing.missing_value_management);
                     return -1;
                 }
-                file_offset += 9;
-            }
-            else
-            {
-                coda_set_error(CODA_ERROR_PRODUCT, "unsupported Data Representation Template (%d)",
-                               dataRepresentationTemplate);
-                return -1;
+                has_complex_packing = 1;
             }
 
             if (section_size > 20)
@@ -3020,6 +3083,17 @@ static int read_grib2_message(coda_grib_product *product, coda_mem_record *messa
 
             if (has_bitmask)
             {
+                /* with a bitmap, num_elements is the number of packed values and the array covers all grid points */
+                num_elements = num_data_points;
+                if (bitmask_length < bit_size_to_byte_size(num_elements))
+                {
+                    coda_set_error(CODA_ERROR_PRODUCT, "Size of bitmap in Bit-Map Section (%ld bytes) does not match "
+                                   "expected size (%ld bytes) based on %ld grid elements", (long)bitmask_length,
+                                   (long)bit_size_to_byte_size(num_elements), (long)num_elements);
+                    coda_dynamic_type_delete((coda_dynamic_type *)data);
+                    return -1;
+                }
+
                 /* read bitmask array */
                 bitmask = malloc((size_t)bitmask_length * sizeof(uint8_t));
                 if (bitmask == NULL)
@@ -3036,10 +3110,35 @@ static int read_grib2_message(coda_grib_product *product, coda_mem_record *messa
             }
 
             gtype = grib_type[grib2_values];
-            type = (coda_dynamic_type *)coda_grib_value_array_simple_packing_new((coda_type_array *)gtype, num_elements,
-                                                                                 file_offset, bitsPerValue,
-                                                                                 decimalScaleFactor, binaryScaleFactor,
-                                                                                 referenceValue, bitmask);
+            if (has_png_packing)
+            {
+                type = (coda_dynamic_type *)coda_grib_value_array_png_packing_new((coda_type_array *)gtype,
+                                                                                  num_elements, file_offset,
+                                                                                  bitsPerValue, decimalScaleFactor,
+                                                                                  binaryScaleFactor, referenceValue,
+                                                                                  bitmask, num_packed_values,
+                                                                                  section_size > 5 ? section_size - 5 :
+                                                                                  0);
+            }
+            else if (has_complex_packing)
+            {
+                complex_packing.byte_size = section_size > 5 ? section_size - 5 : 0;
+                type = (coda_dynamic_type *)coda_grib_value_array_complex_packing_new((coda_type_array *)gtype,
+                                                                                      num_elements, file_offset,
+                                                                                      bitsPerValue,
+                                                                                      decimalScaleFactor,
+                                                                                      binaryScaleFactor,
+                                                                                      referenceValue, bitmask,
+                                                                                      &complex_packing);
+            }
+            else
+            {
+                type = (coda_dynamic_type *)coda_grib_value_array_simple_packing_new((coda_type_array *)gtype,
+                                                                                     num_elements, file_offset,
+                                                                                     bitsPerValue, decimalScaleFactor,
+                                                                                     binaryScaleFactor, referenceValue,
+                                                                                     bitmask);
+            }
             if (bitmask != NULL)
             {
                 free(bitmask);
@@ -3084,151 +3183,179 @@ static int read_grib2_message(coda_grib_product *product, coda_mem_record *messa
     return 0;
 }
 
-int coda_grib_reopen(coda_product **product)
+int coda_grib_read_message(coda_grib_product *product, long index)
 {
+    coda_grib_message_array *root_type = (coda_grib_message_array *)product->root_type;
     coda_dynamic_type *type;
-    coda_grib_product *product_file;
-    long message_number;
-    uint8_t buffer[28];
-    int64_t message_size;
-    int64_t file_offset = 0;
+    coda_mem_record *message_union;
+    coda_mem_record *message;
+    uint8_t buffer[8];
+    int64_t file_offset;
+    int grib_version;
 
-    if (grib_init() != 0)
+    assert(index >= 0 && index < root_type->num_elements && root_type->message[index] == NULL);
+    file_offset = root_type->message_offset[index];
+
+    /* Section 0: Indicator Section */
+    if (read_bytes(product->raw_product, file_offset, 8, buffer) < 0)
     {
-        coda_close(*product);
+        return -1;
+    }
+    if (buffer[0] != 'G' || buffer[1] != 'R' || buffer[2] != 'I' || buffer[3] != 'B')
+    {
+        coda_set_error(CODA_ERROR_PRODUCT, "invalid indicator for message %ld", index);
         return -1;
     }
 
-    product_file = (coda_grib_product *)malloc(sizeof(coda_grib_product));
-
-    if (product_file == NULL)
+    grib_version = buffer[7];
+    if (grib_version != 1 && grib_version != 2)
     {
-        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                       sizeof(coda_grib_product), __FILE__, __LINE__);
-        coda_close(*product);
+        coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "unsupported GRIB format version (%d) for message %ld",
+                       grib_version, index);
         return -1;
     }
-    product_file->filename = NULL;
-    product_file->file_size = (*product)->file_size;
-    product_file->format = coda_format_grib;
-    product_file->root_type = NULL;
-    product_file->product_definition = NULL;
-    product_file->product_variable_size = NULL;
-    product_file->product_variable = NULL;
-    product_file->mem_size = 0;
-    product_file->mem_ptr = NULL;
 
-    product_file->raw_product = *product;
+    message_union = coda_mem_record_new((coda_type_record *)grib_type[grib_message], NULL);
+    if (grib_version == 1)
+    {
+        /* read message based on GRIB Edition Number 1 specification */
+        message = coda_mem_record_new((coda_type_record *)grib_type[grib1_message], NULL);
+        message_union->field_type[0] = (coda_dynamic_type *)message;
+        type = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)grib_type[grib1_editionNumber], NULL,
+                                                       (coda_product *)product, 1);
+        coda_mem_record_add_field(message, "editionNumber", type, 0);
+        if (read_grib1_message(product, message, file_offset + 8) != 0)
+        {
+            coda_dynamic_type_delete((coda_dynamic_type *)message_union);
+            return -1;
+        }
+    }
+    else
+    {
+        /* read message based on GRIB Edition Number 2 specification */
+        message = coda_mem_record_new((coda_type_record *)grib_type[grib2_message], NULL);
+        message_union->field_type[1] = (coda_dynamic_type *)message;
+        type = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)grib_type[grib2_editionNumber], NULL,
+                                                       (coda_product *)product, 2);
+        coda_mem_record_add_field(message, "editionNumber", type, 0);
+        type = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)grib_type[grib2_discipline], NULL,
+                                                       (coda_product *)product, buffer[6]);
+        coda_mem_record_add_field(message, "discipline", type, 0);
+
+        if (read_grib2_message(product, message, file_offset + 16) != 0)
+        {
+            coda_dynamic_type_delete((coda_dynamic_type *)message_union);
+            return -1;
+        }
+    }
 
-    product_file->filename = strdup((*product)->filename);
-    if (product_file->filename == NULL)
+    root_type->message[index] = (coda_dynamic_type *)message_union;
+
+    return 0;
+}
+
+/* size of the blocks that are read when searching for the start of the next message */
+#define SCAN_BLOCK_SIZE 4096
+
+/* Move file_offset to the first 'G' byte at or after file_offset (which should be the start of the next message).
+ * Returns 0 if a 'G' was found, 1 if the end of the file was reached, and -1 on error.
+ */
+static int find_indicator(coda_grib_product *product, int64_t *file_offset)
+{
+    uint8_t buffer[SCAN_BLOCK_SIZE];
+
+    while (*file_offset < product->file_size - 1)
     {
-        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate filename string) (%s:%u)",
-                       __FILE__, __LINE__);
-        coda_grib_close((coda_product *)product_file);
-        return -1;
+        int64_t length = product->file_size - 1 - *file_offset;
+        uint8_t *indicator;
+
+        if (length > SCAN_BLOCK_SIZE)
+        {
+            length = SCAN_BLOCK_SIZE;
+        }
+        if (read_bytes_in_bounds(product->raw_product, *file_offset, length, buffer) < 0)
+        {
+            return -1;
+        }
+        indicator = memchr(buffer, 'G', (size_t)length);
+        if (indicator != NULL)
+        {
+            *file_offset += indicator - buffer;
+            return 0;
+        }
+        *file_offset += length;
     }
-    product_file->root_type = (coda_dynamic_type *)coda_mem_array_new((coda_type_array *)grib_type[grib_root], NULL);
+
+    return 1;
+}
+
+/* find the start of all messages in the file */
+static int scan_messages(coda_grib_product *product)
+{
+    coda_grib_message_array *root_type = (coda_grib_message_array *)product->root_type;
+    long message_number;
+    uint8_t buffer[16];
+    int64_t message_size;
+    int64_t file_offset = 0;
+    int result;
 
     message_number = 0;
-    while (file_offset < product_file->file_size - 1)
+    while (file_offset < product->file_size - 1)
     {
-        coda_mem_record *message_union;
-        coda_mem_record *message;
         int grib_version;
 
         /* find start of Indicator Section */
-        buffer[0] = '\0';
-        while (file_offset < product_file->file_size - 1 && buffer[0] != 'G')
+        result = find_indicator(product, &file_offset);
+        if (result < 0)
         {
-            if (read_bytes_in_bounds(product_file->raw_product, file_offset, 1, buffer) < 0)
-            {
-                coda_grib_close((coda_product *)product_file);
-                return -1;
-            }
-            file_offset++;
+            return -1;
         }
-        if (file_offset >= product_file->file_size - 1)
+        if (result == 1)
         {
             /* there is only filler data at the end of the file, but no new message */
             break;
         }
-        file_offset--;
 
         /* Section 0: Indicator Section */
-        if (read_bytes(product_file->raw_product, file_offset, 8, buffer) < 0)
+        if (read_bytes(product->raw_product, file_offset, 8, buffer) < 0)
         {
-            coda_grib_close((coda_product *)product_file);
             return -1;
         }
         if (buffer[0] != 'G' || buffer[1] != 'R' || buffer[2] != 'I' || buffer[3] != 'B')
         {
             coda_set_error(CODA_ERROR_PRODUCT, "invalid indicator for message %ld", message_number);
-            coda_grib_close((coda_product *)product_file);
             return -1;
         }
 
         grib_version = buffer[7];
-        if (grib_version != 1 && grib_version != 2)
-        {
-            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "unsupported GRIB format version (%d) for message %ld",
-                           grib_version, message_number);
-            coda_grib_close((coda_product *)product_file);
-            return -1;
-        }
-
-        message_union = coda_mem_record_new((coda_type_record *)grib_type[grib_message], NULL);
         if (grib_version == 1)
         {
-            /* read message based on GRIB Edition Number 1 specification */
             message_size = ((buffer[4] * 256) + buffer[5]) * 256 + buffer[6];
-
-            message = coda_mem_record_new((coda_type_record *)grib_type[grib1_message], NULL);
-            message_union->field_type[0] = (coda_dynamic_type *)message;
-            type = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)grib_type[grib1_editionNumber], NULL,
-                                                           (coda_product *)product_file, 1);
-            coda_mem_record_add_field(message, "editionNumber", type, 0);
-            if (read_grib1_message(product_file, message, file_offset + 8) != 0)
-            {
-                coda_dynamic_type_delete((coda_dynamic_type *)message_union);
-                coda_grib_close((coda_product *)product_file);
-                return -1;
-            }
         }
-        else
+        else if (grib_version == 2)
         {
-            /* read message based on GRIB Edition Number 2 specification */
-            if (read_bytes(product_file->raw_product, file_offset + 8, 8, &message_size) < 0)
+            if (read_bytes(product->raw_product, file_offset + 8, 8, &message_size) < 0)
             {
-                coda_dynamic_type_delete((coda_dynamic_type *)message_union);
-                coda_grib_close((coda_product *)product_file);
                 return -1;
             }
 #ifndef WORDS_BIGENDIAN
             swap_int64(&message_size);
 #endif
-            message = coda_mem_record_new((coda_type_record *)grib_type[grib2_message], NULL);
-            message_union->field_type[1] = (coda_dynamic_type *)message;
-            type = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)grib_type[grib2_editionNumber], NULL,
-                                                           (coda_product *)product_file, 2);
-            coda_mem_record_add_field(message, "editionNumber", type, 0);
-            type = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)grib_type[grib2_discipline], NULL,
-                                                           (coda_product *)product_file, buffer[6]);
-            coda_mem_record_add_field(message, "discipline", type, 0);
-
-            if (read_grib2_message(product_file, message, file_offset + 16) != 0)
-            {
-                coda_dynamic_type_delete((coda_dynamic_type *)message_union);
-                coda_grib_close((coda_product *)product_file);
-                return -1;
-            }
+        }
+        else
+        {
+            coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, "unsupported GRIB format version (%d) for message %ld",
+                           grib_version, message_number);
+            return -1;
+        }
+        if (message_size < 8)
+        {
+            coda_set_error(CODA_ERROR_PRODUCT, "invalid message size for message %ld", message_number);
+            return -1;
         }
 
-        if (coda_mem_array_add_element((coda_mem_array *)product_file->root_type, (coda_dynamic_type *)message_union) !=
-            0)
+        if (coda_grib_message_array_add_message(root_type, file_offset) != 0)
         {
-            coda_dynamic_type_delete((coda_dynamic_type *)message_union);
-            coda_grib_close((coda_product *)product_file);
             return -1;
         }
 
@@ -3236,6 +3363,276 @@ int coda_grib_reopen(coda_product **product)
         message_number++;
     }
 
+    return 0;
+}
+
+static char *get_index_filename(const coda_grib_product *product)
+{
+    char *filename;
+
+    filename = malloc(strlen(product->filename) + 9);
+    if (filename == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(strlen(product->filename) + 9), __FILE__, __LINE__);
+        return NULL;
+    }
+    sprintf(filename, "%s.codaidx", product->filename);
+
+    return filename;
+}
+
+/* size of the blocks at the start and end of the product file that are used for the content check of an index file */
+#define INDEX_CHECK_BLOCK_SIZE 4096
+
+/* the index file consists of the identifier 'CODAIDX2' followed by the size, modification time, and a content check
+ * value of the product file, the number of messages, and the file offset of each message (all stored as big endian
+ * 64-bit integers). The content check value is a 64-bit FNV-1a hash of the first and last block of the product file.
+ */
+static int get_index_header(const coda_grib_product *product, int64_t header[4])
+{
+    uint8_t buffer[2 * INDEX_CHECK_BLOCK_SIZE];
+    struct stat statbuf;
+    uint64_t hash = 14695981039346656037ULL;
+    int64_t length;
+    int64_t i;
+
+    if (stat(product->filename, &statbuf) != 0)
+    {
+        return -1;
+    }
+    length = product->file_size < INDEX_CHECK_BLOCK_SIZE ? product->file_size : INDEX_CHECK_BLOCK_SIZE;
+    if (read_bytes(product->raw_product, 0, length, buffer) < 0 ||
+        read_bytes(product->raw_product, product->file_size - length, length, &buffer[length]) < 0)
+    {
+        coda_errno = 0;
+        return -1;
+    }
+    for (i = 0; i < 2 * length; i++)
+    {
+        hash = (hash ^ buffer[i]) * 1099511628211ULL;
+    }
+    header[0] = product->file_size;
+    header[1] = (int64_t)statbuf.st_mtime;
+    header[2] = (int64_t)hash;
+    header[3] = 0;
+
+    return 0;
+}
+
+/* returns 1 if the first and last message offset of the index refer to a GRIB indicator, 0 otherwise */
+static int verify_index_offsets(coda_grib_product *product)
+{
+    coda_grib_message_array *root_type = (coda_grib_message_array *)product->root_type;
+    uint8_t buffer[4];
+
+    if (root_type->num_elements == 0)
+    {
+        return 1;
+    }
+    if (read_bytes(product->raw_product, root_type->message_offset[0], 4, buffer) < 0 ||
+        memcmp(buffer, "GRIB", 4) != 0)
+    {
+        coda_errno = 0;
+        return 0;
+    }
+    if (read_bytes(product->raw_product, root_type->message_offset[root_type->num_elements - 1], 4, buffer) < 0 ||
+        memcmp(buffer, "GRIB", 4) != 0)
+    {
+        coda_errno = 0;
+        return 0;
+    }
+
+    return 1;
+}
+
+/* returns 1 if the message offsets could be read from the index file, 0 otherwise */
+static int read_index_file(coda_grib_product *product)
+{
+    coda_grib_message_array *root_type = (coda_grib_message_array *)product->root_type;
+    char identifier[8];
+    int64_t header[4];
+    int64_t value[4];
+    char *filename;
+    FILE *f;
+    long i;
+
+    if (get_index_header(product, header) != 0)
+    {
+        return 0;
+    }
+    filename = get_index_filename(product);
+    if (filename == NULL)
+    {
+        coda_errno = 0;
+        return 0;
+    }
+    f = fopen(filename, "rb");
+    free(filename);
+    if (f == NULL)
+    {
+        return 0;
+    }
+    if (fread(identifier, 1, 8, f) != 8 || memcmp(identifier, "CODAIDX2", 8) != 0 || fread(value, 8, 4, f) != 4)
+    {
+        fclose(f);
+        return 0;
+    }
+#ifndef WORDS_BIGENDIAN
+    for (i = 0; i < 4; i++)
+    {
+        swap_int64(&value[i]);
+    }
+#endif
+    if (value[0] != header[0] || value[1] != header[1] || value[2] != header[2] || value[3] < 0)
+    {
+        fclose(f);
+        return 0;
+    }
+    for (i = 0; i < value[3]; i++)
+    {
+        int64_t file_offset;
+
+        if (fread(&file_offset, 8, 1, f) != 1)
+        {
+            break;
+        }
+#ifndef WORDS_BIGENDIAN
+        swap_int64(&file_offset);
+#endif
+        if (file_offset < 0 || file_offset >= product->file_size)
+        {
+            break;
+        }
+        if (coda_grib_message_array_add_message(root_type, file_offset) != 0)
+        {
+            coda_errno = 0;
+            break;
+        }
+    }
+    fclose(f);
+    if (i < value[3] || !verify_index_offsets(product))
+    {
+        /* invalid index file -> remove any offsets that we already added */
+        root_type->num_elements = 0;
+        return 0;
+    }
+
+    return 1;
+}
+
+/* try to store the message offsets in an index file; failures are silently ignored */
+static void write_index_file(const coda_grib_product *product)
+{
+    coda_grib_message_array *root_type = (coda_grib_message_array *)product->root_type;
+    int64_t header[4];
+    char *filename;
+    FILE *f;
+    long i;
+    int result;
+
+    if (get_index_header(product, header) != 0)
+    {
+        return;
+    }
+    header[3] = root_type->num_elements;
+    filename = get_index_filename(product);
+    if (filename == NULL)
+    {
+        coda_errno = 0;
+        return;
+    }
+    f = fopen(filename, "wb");
+    if (f == NULL)
+    {
+        free(filename);
+        return;
+    }
+#ifndef WORDS_BIGENDIAN
+    for (i = 0; i < 4; i++)
+    {
+        swap_int64(&header[i]);
+    }
+#endif
+    result = (fwrite("CODAIDX2", 1, 8, f) == 8 && fwrite(header, 8, 4, f) == 4);
+    for (i = 0; result && i < root_type->num_elements; i++)
+    {
+        int64_t file_offset = root_type->message_offset[i];
+
+#ifndef WORDS_BIGENDIAN
+        swap_int64(&file_offset);
+#endif
+        result = (fwrite(&file_offset, 8, 1, f) == 1);
+    }
+    if (fclose(f) != 0 || !result)
+    {
+        /* don't leave an incomplete index file behind */
+        remove(filename);
+    }
+    free(filename);
+}
+
+int coda_grib_reopen(coda_product **product)
+{
+    coda_grib_product *product_file;
+
+    if (grib_init() != 0)
+    {
+        coda_close(*product);
+        return -1;
+    }
+
+    product_file = (coda_grib_product *)malloc(sizeof(coda_grib_product));
+
+    if (product_file == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       sizeof(coda_grib_product), __FILE__, __LINE__);
+        coda_close(*product);
+        return -1;
+    }
+    product_file->filename = NULL;
+    product_file->file_size = (*product)->file_size;
+    product_file->format = coda_format_grib;
+    product_file->root_type = NULL;
+    product_file->product_definition = NULL;
+    product_file->product_variable_size = NULL;
+    product_file->product_variable = NULL;
+    product_file->mem_size = 0;
+    product_file->mem_ptr = NULL;
+
+    product_file->raw_product = *product;
+
+    product_file->filename = strdup((*product)->filename);
+    if (product_file->filename == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate filename string) (%s:%u)",
+                       __FILE__, __LINE__);
+        coda_grib_close((coda_product *)product_file);
+        return -1;
+    }
+    product_file->root_type = (coda_dynamic_type *)coda_grib_message_array_new((coda_type_array *)
+                                                                               grib_type[grib_root]);
+    if (product_file->root_type == NULL)
+    {
+        coda_grib_close((coda_product *)product_file);
+        return -1;
+    }
+
+    /* we only determine the location of each message here; messages are read when they are first accessed */
+    if (!coda_option_use_grib_index || !read_index_file(product_file))
+    {
+        if (scan_messages(product_file) != 0)
+        {
+            coda_grib_close((coda_product *)product_file);
+            return -1;
+        }
+        if (coda_option_use_grib_index)
+        {
+            write_index_file(product_file);
+        }
+    }
+
     *product = (coda_product *)product_file;
     return 0;
 }
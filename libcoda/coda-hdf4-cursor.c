@@ -35,6 +35,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* maximum size of the block of records that is read at once when reading individual Vdata field elements */
+#define VDATA_FIELD_CACHE_SIZE (1024 * 1024)
+
 static int get_native_type_size(coda_native_type type)
 {
     switch (type)
@@ -137,6 +140,11 @@ int coda_hdf4_cursor_goto_record_field_by_index(coda_cursor *cursor, long index)
                 return -1;
             }
             field_type = ((coda_hdf4_Vgroup *)record_type)->entry[index];
+            /* with lazy loading the fields of a Vdata are only created when the Vdata is first entered */
+            if (coda_hdf4_type_init_fields(cursor->product, (coda_dynamic_type *)field_type) != 0)
+            {
+                return -1;
+            }
             break;
         default:
             assert(0);
@@ -282,6 +290,11 @@ int coda_hdf4_cursor_goto_attributes(coda_cursor *cursor)
     coda_hdf4_type *type;
 
     type = (coda_hdf4_type *)cursor->stack[cursor->n - 1].type;
+    /* with lazy loading the attributes are only read when they are first accessed */
+    if (coda_hdf4_type_init_attributes((coda_hdf4_product *)cursor->product, type) != 0)
+    {
+        return -1;
+    }
     cursor->n++;
     switch (type->tag)
     {
@@ -849,6 +862,74 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
     return 0;
 }
 
+/* HDF4 does not allow reading part of a Vdata field and each VSread has a considerable overhead, so for reading
+ * individual elements we read the field for a whole block of records at once and keep it in a cache */
+static int read_Vdata_field_block(coda_hdf4_Vdata *type, coda_hdf4_Vdata_field *field_type, int32 record_pos)
+{
+    int32 block_num_records;
+    int32 first_record;
+    int32 num_records;
+
+    if (field_type->field_size == 0)
+    {
+        int32 size;
+
+        size = VSsizeof(type->vdata_id, field_type->field_name);
+        if (size <= 0)
+        {
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            return -1;
+        }
+        field_type->field_size = size;
+    }
+    block_num_records = VDATA_FIELD_CACHE_SIZE / field_type->field_size;
+    if (block_num_records < 1)
+    {
+        block_num_records = 1;
+    }
+    if (block_num_records > field_type->num_records)
+    {
+        block_num_records = field_type->num_records;
+    }
+    if (field_type->cache == NULL)
+    {
+        field_type->cache = malloc(block_num_records * field_type->field_size);
+        if (field_type->cache == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)block_num_records * field_type->field_size, __FILE__, __LINE__);
+            return -1;
+        }
+    }
+
+    first_record = (record_pos / block_num_records) * block_num_records;
+    num_records = field_type->num_records - first_record;
+    if (num_records > block_num_records)
+    {
+        num_records = block_num_records;
+    }
+    field_type->cache_num_records = 0;
+    if (VSseek(type->vdata_id, first_record) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    if (VSsetfields(type->vdata_id, field_type->field_name) != 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    if (VSread(type->vdata_id, field_type->cache, num_records, FULL_INTERLACE) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    field_type->cache_first_record = first_record;
+    field_type->cache_num_records = num_records;
+
+    return 0;
+}
+
 static int read_basic_type(const coda_cursor *cursor, void *dst)
 {
     int32 start[MAX_HDF4_VAR_DIMS];
@@ -989,6 +1070,7 @@ static int read_basic_type(const coda_cursor *cursor, void *dst)
             {
                 coda_hdf4_Vdata *type;
                 coda_hdf4_Vdata_field *field_type;
+                int element_size;
                 int record_pos;
                 int order_pos;
 
@@ -997,56 +1079,18 @@ static int read_basic_type(const coda_cursor *cursor, void *dst)
                 field_type = (coda_hdf4_Vdata_field *)cursor->stack[cursor->n - 2].type;
                 order_pos = index % field_type->order;
                 record_pos = index / field_type->order;
-                if (VSseek(type->vdata_id, record_pos) < 0)
-                {
-                    coda_set_error(CODA_ERROR_HDF4, NULL);
-                    return -1;
-                }
-                if (VSsetfields(type->vdata_id, field_type->field_name) != 0)
-                {
-                    coda_set_error(CODA_ERROR_HDF4, NULL);
-                    return -1;
-                }
-                if (field_type->order > 1)
-                {
-                    /* HDF4 does not allow reading part of a vdata field, so we have to first read the full field and
-                     * then return only the data item that was requested */
-                    uint8 *buffer;
-                    int element_size;
-                    int size;
-
-                    size = VSsizeof(type->vdata_id, field_type->field_name);
-                    if (size < 0)
-                    {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
-                        return -1;
-                    }
-                    buffer = malloc(size);
-                    if (buffer == NULL)
-                    {
-                        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                                       (long)size, __FILE__, __LINE__);
-                        return -1;
-                    }
-                    if (VSread(type->vdata_id, buffer, 1, FULL_INTERLACE) < 0)
-                    {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
-                        free(buffer);
-                        return -1;
-                    }
-                    /* the size of a field element is the field size divided by the order of the field */
-                    element_size = size / field_type->order;
-                    memcpy(dst, &buffer[order_pos * element_size], element_size);
-                    free(buffer);
-                }
-                else
+                if (record_pos < field_type->cache_first_record ||
+                    record_pos >= field_type->cache_first_record + field_type->cache_num_records)
                 {
-                    if (VSread(type->vdata_id, (uint8 *)dst, 1, FULL_INTERLACE) < 0)
+                    if (read_Vdata_field_block(type, field_type, record_pos) != 0)
                     {
-                        coda_set_error(CODA_ERROR_HDF4, NULL);
                         return -1;
                     }
                 }
+                /* the size of a field element is the field size divided by the order of the field */
+                element_size = field_type->field_size / field_type->order;
+                memcpy(dst, &field_type->cache[(record_pos - field_type->cache_first_record) * field_type->field_size +
+                                               order_pos * element_size], element_size);
             }
             break;
         default:
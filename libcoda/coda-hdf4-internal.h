@@ -131,8 +131,9 @@ typedef struct coda_hdf4_GRImage_struct
     int32 data_type;
     int32 interlace_mode;
     int32 dim_sizes[2];
+    int32 num_attributes;
     coda_hdf4_type *basic_type;
-    coda_hdf4_attributes *attributes;
+    coda_hdf4_attributes *attributes;   /* NULL until first accessed when lazy loading is enabled */
 } coda_hdf4_GRImage;
 
 typedef struct coda_hdf4_SDS_struct
@@ -148,8 +149,9 @@ typedef struct coda_hdf4_SDS_struct
     int32 rank;
     int32 dimsizes[MAX_HDF4_VAR_DIMS];
     int32 data_type;
+    int32 num_attributes;
     coda_hdf4_type *basic_type;
-    coda_hdf4_attributes *attributes;
+    coda_hdf4_attributes *attributes;   /* NULL until first accessed when lazy loading is enabled */
 } coda_hdf4_SDS;
 
 typedef struct coda_hdf4_Vdata_struct
@@ -164,7 +166,8 @@ typedef struct coda_hdf4_Vdata_struct
     char vdata_name[MAX_HDF4_NAME_LENGTH + 1];
     char classname[MAX_HDF4_NAME_LENGTH + 1];
     struct coda_hdf4_Vdata_field_struct **field;
-    coda_hdf4_attributes *attributes;
+    coda_hdf4_attributes *attributes;   /* NULL until first accessed when lazy loading is enabled */
+    int fields_initialized;     /* fields are only added when the Vdata is first entered if lazy loading is enabled */
 } coda_hdf4_Vdata;
 
 typedef struct coda_hdf4_Vdata_field_struct
@@ -179,6 +182,10 @@ typedef struct coda_hdf4_Vdata_field_struct
     int32 data_type;
     coda_hdf4_type *basic_type;
     coda_hdf4_attributes *attributes;
+    int32 field_size;   /* byte size of the field for a single record (0 if not yet determined) */
+    int32 cache_first_record;   /* first record of the block of records that is in the cache */
+    int32 cache_num_records;    /* number of records in the cache */
+    uint8 *cache;       /* field data for a block of records (to avoid a VSread for each individual record) */
 } coda_hdf4_Vdata_field;
 
 typedef struct coda_hdf4_Vgroup_struct
@@ -194,7 +201,7 @@ typedef struct coda_hdf4_Vgroup_struct
     char classname[MAX_HDF4_NAME_LENGTH + 1];
     int32 version;
     struct coda_hdf4_type_struct **entry;
-    coda_hdf4_attributes *attributes;
+    coda_hdf4_attributes *attributes;   /* NULL until first accessed when lazy loading is enabled */
 } coda_hdf4_Vgroup;
 
 struct coda_hdf4_product_struct
@@ -238,6 +245,7 @@ coda_hdf4_GRImage *coda_hdf4_GRImage_new(coda_hdf4_product *product, int32 index
 coda_hdf4_SDS *coda_hdf4_SDS_new(coda_hdf4_product *product, int32 sds_index);
 coda_hdf4_Vdata *coda_hdf4_Vdata_new(coda_hdf4_product *product, int32 vdata_ref);
 coda_hdf4_Vgroup *coda_hdf4_Vgroup_new(coda_hdf4_product *product, int32 vgroup_ref);
+int coda_hdf4_type_init_attributes(coda_hdf4_product *product, coda_hdf4_type *type);
 int coda_hdf4_create_root(coda_hdf4_product *product);
 
 #endif
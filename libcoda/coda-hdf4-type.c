@@ -117,6 +117,10 @@ void coda_hdf4_type_delete(coda_dynamic_type *type)
         case tag_hdf4_Vdata_field:
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_Vdata_field *)type)->basic_type);
             coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf4_Vdata_field *)type)->attributes);
+            if (((coda_hdf4_Vdata_field *)type)->cache != NULL)
+            {
+                free(((coda_hdf4_Vdata_field *)type)->cache);
+            }
             break;
         case tag_hdf4_Vgroup:
             if (((coda_hdf4_Vgroup *)type)->entry != NULL)
@@ -198,6 +202,150 @@ static int get_conversion_from_attributes(const coda_hdf4_product *product, coda
     return 0;
 }
 
+/* will leave 'value' unmodified if the attribute does not exist or is not a single integer/real value */
+static int get_object_attribute_value(coda_hdf4_type *type, const char *name, double *value)
+{
+    char attr_name[MAX_HDF4_NAME_LENGTH + 1];
+    int32 attr_index;
+    int32 data_type;
+    int32 count;
+    union
+    {
+        int8_t as_int8;
+        uint8_t as_uint8;
+        int16_t as_int16;
+        uint16_t as_uint16;
+        int32_t as_int32;
+        uint32_t as_uint32;
+        int64_t as_int64;
+        uint64_t as_uint64;
+        float as_float;
+        double as_double;
+    } data;
+
+    if (type->tag == tag_hdf4_GRImage)
+    {
+        int32 ri_id = ((coda_hdf4_GRImage *)type)->ri_id;
+
+        attr_index = GRfindattr(ri_id, name);
+        if (attr_index == -1)
+        {
+            return 0;
+        }
+        if (GRattrinfo(ri_id, attr_index, attr_name, &data_type, &count) != 0)
+        {
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            return -1;
+        }
+        if (count != 1 || data_type == DFNT_CHAR)
+        {
+            return 0;
+        }
+        if (GRgetattr(ri_id, attr_index, &data) != 0)
+        {
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            return -1;
+        }
+    }
+    else
+    {
+        int32 sds_id = ((coda_hdf4_SDS *)type)->sds_id;
+
+        assert(type->tag == tag_hdf4_SDS);
+        attr_index = SDfindattr(sds_id, name);
+        if (attr_index == -1)
+        {
+            return 0;
+        }
+        if (SDattrinfo(sds_id, attr_index, attr_name, &data_type, &count) != 0)
+        {
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            return -1;
+        }
+        if (count != 1 || data_type == DFNT_CHAR)
+        {
+            return 0;
+        }
+        if (SDreadattr(sds_id, attr_index, &data) != 0)
+        {
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            return -1;
+        }
+    }
+
+    switch (data_type)
+    {
+        case DFNT_INT8:
+            *value = (double)data.as_int8;
+            break;
+        case DFNT_UCHAR:
+        case DFNT_UINT8:
+            *value = (double)data.as_uint8;
+            break;
+        case DFNT_INT16:
+            *value = (double)data.as_int16;
+            break;
+        case DFNT_UINT16:
+            *value = (double)data.as_uint16;
+            break;
+        case DFNT_INT32:
+            *value = (double)data.as_int32;
+            break;
+        case DFNT_UINT32:
+            *value = (double)data.as_uint32;
+            break;
+        case DFNT_INT64:
+            *value = (double)data.as_int64;
+            break;
+        case DFNT_UINT64:
+            *value = (double)data.as_uint64;
+            break;
+        case DFNT_FLOAT32:
+            *value = (double)data.as_float;
+            break;
+        case DFNT_FLOAT64:
+            *value = data.as_double;
+            break;
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+/* same as get_conversion_from_attributes(), but reads the attribute values directly from the GRImage/SDS
+ * (used when lazy loading is enabled and the attributes record has not been created yet) */
+static int get_conversion_from_object(coda_hdf4_type *type, coda_conversion **conversion)
+{
+    double scale_factor = 1.0;
+    double add_offset = 0.0;
+    double invalid_value = coda_NaN();
+
+    if (get_object_attribute_value(type, "scale_factor", &scale_factor) != 0)
+    {
+        return -1;
+    }
+    if (get_object_attribute_value(type, "add_offset", &add_offset) != 0)
+    {
+        return -1;
+    }
+    if (get_object_attribute_value(type, "_FillValue", &invalid_value) != 0)
+    {
+        return -1;
+    }
+    if (scale_factor == 1.0 && add_offset == 0.0 && coda_isNaN(invalid_value))
+    {
+        *conversion = NULL;
+        return 0;
+    }
+    *conversion = coda_conversion_new(scale_factor, 1.0, add_offset, invalid_value);
+    if (*conversion == NULL)
+    {
+        return -1;
+    }
+    return 0;
+}
+
 static coda_hdf4_type *basic_type_new(int32 data_type, coda_conversion *conversion)
 {
     coda_hdf4_type *type;
@@ -1340,11 +1488,70 @@ static coda_hdf4_file_attributes *attributes_for_root(coda_hdf4_product *product
     return type;
 }
 
+int coda_hdf4_type_init_attributes(coda_hdf4_product *product, coda_hdf4_type *type)
+{
+    coda_hdf4_attributes **attributes;
+
+    switch (type->tag)
+    {
+        case tag_hdf4_GRImage:
+            attributes = &((coda_hdf4_GRImage *)type)->attributes;
+            break;
+        case tag_hdf4_SDS:
+            attributes = &((coda_hdf4_SDS *)type)->attributes;
+            break;
+        case tag_hdf4_Vdata:
+            attributes = &((coda_hdf4_Vdata *)type)->attributes;
+            break;
+        case tag_hdf4_Vgroup:
+            attributes = &((coda_hdf4_Vgroup *)type)->attributes;
+            break;
+        default:
+            /* the attributes of all other types are always created together with the type */
+            return 0;
+    }
+    if (*attributes != NULL)
+    {
+        return 0;
+    }
+
+    switch (type->tag)
+    {
+        case tag_hdf4_GRImage:
+            *attributes = attributes_for_GRImage(product, ((coda_hdf4_GRImage *)type)->ri_id,
+                                                 ((coda_hdf4_GRImage *)type)->num_attributes);
+            break;
+        case tag_hdf4_SDS:
+            *attributes = attributes_for_SDS(product, ((coda_hdf4_SDS *)type)->sds_id,
+                                             ((coda_hdf4_SDS *)type)->num_attributes);
+            break;
+        case tag_hdf4_Vdata:
+            *attributes = attributes_for_Vdata(product, ((coda_hdf4_Vdata *)type)->vdata_id,
+                                               ((coda_hdf4_Vdata *)type)->ref);
+            break;
+        default:
+            assert(type->tag == tag_hdf4_Vgroup);
+            *attributes = attributes_for_Vgroup(product, ((coda_hdf4_Vgroup *)type)->vgroup_id);
+            break;
+    }
+    if (*attributes == NULL)
+    {
+        return -1;
+    }
+    if (coda_type_set_attributes(type->definition, (*attributes)->definition) != 0)
+    {
+        coda_hdf4_type_delete((coda_dynamic_type *)*attributes);
+        *attributes = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
 coda_hdf4_GRImage *coda_hdf4_GRImage_new(coda_hdf4_product *product, int32 index)
 {
     coda_conversion *conversion = NULL;
     coda_hdf4_GRImage *type;
-    int32 num_attributes;
 
     type = (coda_hdf4_GRImage *)malloc(sizeof(coda_hdf4_GRImage));
     if (type == NULL)
@@ -1360,6 +1567,7 @@ coda_hdf4_GRImage *coda_hdf4_GRImage_new(coda_hdf4_product *product, int32 index
     type->ref = -1;
     type->ri_id = -1;
     type->index = index;
+    type->num_attributes = 0;
     type->basic_type = NULL;
     type->attributes = NULL;
 
@@ -1394,7 +1602,7 @@ coda_hdf4_GRImage *coda_hdf4_GRImage_new(coda_hdf4_product *product, int32 index
         return NULL;
     }
     if (GRgetiminfo(type->ri_id, type->gri_name, &type->ncomp, &type->data_type, &type->interlace_mode, type->dim_sizes,
-                    &num_attributes) != 0)
+                    &type->num_attributes) != 0)
     {
         coda_set_error(CODA_ERROR_HDF4, NULL);
         coda_hdf4_type_delete((coda_dynamic_type *)type);
@@ -1420,22 +1628,27 @@ coda_hdf4_GRImage *coda_hdf4_GRImage_new(coda_hdf4_product *product, int32 index
         }
     }
 
-    type->attributes = attributes_for_GRImage(product, type->ri_id, num_attributes);
-    if (type->attributes == NULL)
+    if (coda_option_use_hdf4_lazy_loading)
     {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
-    }
-    if (coda_type_set_attributes((coda_type *)type->definition, type->attributes->definition) != 0)
-    {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
+        /* only read the attributes that define the conversion; the attributes record is created on first access */
+        if (get_conversion_from_object((coda_hdf4_type *)type, &conversion) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
     }
-
-    if (get_conversion_from_attributes(product, type->attributes, &conversion) != 0)
+    else
     {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
+        if (coda_hdf4_type_init_attributes(product, (coda_hdf4_type *)type) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
+        if (get_conversion_from_attributes(product, type->attributes, &conversion) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
     }
 
     type->basic_type = basic_type_new(type->data_type, conversion);
@@ -1459,7 +1672,6 @@ coda_hdf4_SDS *coda_hdf4_SDS_new(coda_hdf4_product *product, int32 sds_index)
 {
     coda_conversion *conversion = NULL;
     coda_hdf4_SDS *type;
-    int32 num_attributes;
     long i;
 
     type = (coda_hdf4_SDS *)malloc(sizeof(coda_hdf4_SDS));
@@ -1476,6 +1688,7 @@ coda_hdf4_SDS *coda_hdf4_SDS_new(coda_hdf4_product *product, int32 sds_index)
     type->ref = -1;
     type->sds_id = -1;
     type->index = sds_index;
+    type->num_attributes = 0;
     type->basic_type = NULL;
     type->attributes = NULL;
 
@@ -1505,7 +1718,8 @@ coda_hdf4_SDS *coda_hdf4_SDS_new(coda_hdf4_product *product, int32 sds_index)
         }
     }
 
-    if (SDgetinfo(type->sds_id, type->sds_name, &type->rank, type->dimsizes, &type->data_type, &num_attributes) != 0)
+    if (SDgetinfo(type->sds_id, type->sds_name, &type->rank, type->dimsizes, &type->data_type,
+                  &type->num_attributes) != 0)
     {
         coda_set_error(CODA_ERROR_HDF4, NULL);
         coda_hdf4_type_delete((coda_dynamic_type *)type);
@@ -1521,22 +1735,27 @@ coda_hdf4_SDS *coda_hdf4_SDS_new(coda_hdf4_product *product, int32 sds_index)
         }
     }
 
-    type->attributes = attributes_for_SDS(product, type->sds_id, num_attributes);
-    if (type->attributes == NULL)
-    {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
-    }
-    if (coda_type_set_attributes((coda_type *)type->definition, type->attributes->definition) != 0)
+    if (coda_option_use_hdf4_lazy_loading)
     {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
+        /* only read the attributes that define the conversion; the attributes record is created on first access */
+        if (get_conversion_from_object((coda_hdf4_type *)type, &conversion) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
     }
-
-    if (get_conversion_from_attributes(product, type->attributes, &conversion) != 0)
+    else
     {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
+        if (coda_hdf4_type_init_attributes(product, (coda_hdf4_type *)type) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
+        if (get_conversion_from_attributes(product, type->attributes, &conversion) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
     }
 
     type->basic_type = basic_type_new(type->data_type, conversion);
@@ -1575,6 +1794,10 @@ static coda_hdf4_Vdata_field *Vdata_field_new(coda_hdf4_product *product, int32
     type->tag = tag_hdf4_Vdata_field;
     type->basic_type = NULL;
     type->attributes = NULL;
+    type->field_size = 0;
+    type->cache_first_record = 0;
+    type->cache_num_records = 0;
+    type->cache = NULL;
 
     type->definition = coda_type_array_new(product->format);
     if (type->definition == NULL)
@@ -1656,13 +1879,74 @@ static coda_hdf4_Vdata_field *Vdata_field_new(coda_hdf4_product *product, int32
     return type;
 }
 
-coda_hdf4_Vdata *coda_hdf4_Vdata_new(coda_hdf4_product *product, int32 vdata_ref)
+int coda_hdf4_type_init_fields(coda_product *product, coda_dynamic_type *type)
 {
-    coda_hdf4_Vdata *type;
+    coda_hdf4_Vdata *vdata;
     int32 num_records;
-    long num_fields;
+    int32 num_fields;
     long i;
 
+    if (((coda_hdf4_type *)type)->tag != tag_hdf4_Vdata)
+    {
+        /* only Vdata are initialized lazily */
+        return 0;
+    }
+    vdata = (coda_hdf4_Vdata *)type;
+    if (vdata->fields_initialized)
+    {
+        return 0;
+    }
+    /* make sure we only try this once (even if initialization fails) */
+    vdata->fields_initialized = 1;
+
+    num_fields = VFnfields(vdata->vdata_id);
+    if (num_fields == -1)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    num_records = VSelts(vdata->vdata_id);
+    if (num_records == -1)
+    {
+        coda_set_error(CODA_ERROR_HDF4, NULL);
+        return -1;
+    }
+    vdata->field = malloc(num_fields * sizeof(coda_hdf4_Vdata_field *));
+    if (vdata->field == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       num_fields * sizeof(coda_hdf4_Vdata_field *), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_fields; i++)
+    {
+        vdata->field[i] = NULL;
+    }
+
+    for (i = 0; i < num_fields; i++)
+    {
+        vdata->field[i] = Vdata_field_new((coda_hdf4_product *)product, vdata->vdata_id, i, num_records);
+        if (vdata->field[i] == NULL)
+        {
+            return -1;
+        }
+        if (coda_type_record_create_field(vdata->definition, vdata->field[i]->field_name,
+                                          (coda_type *)vdata->field[i]->definition) != 0)
+        {
+            /* the field is not part of the record definition, so coda_hdf4_type_delete() would not release it */
+            coda_hdf4_type_delete((coda_dynamic_type *)vdata->field[i]);
+            vdata->field[i] = NULL;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+coda_hdf4_Vdata *coda_hdf4_Vdata_new(coda_hdf4_product *product, int32 vdata_ref)
+{
+    coda_hdf4_Vdata *type;
+
     type = (coda_hdf4_Vdata *)malloc(sizeof(coda_hdf4_Vdata));
     if (type == NULL)
     {
@@ -1678,6 +1962,7 @@ coda_hdf4_Vdata *coda_hdf4_Vdata_new(coda_hdf4_product *product, int32 vdata_ref
     type->vdata_id = -1;
     type->field = NULL;
     type->attributes = NULL;
+    type->fields_initialized = 0;
 
     type->definition = coda_type_record_new(product->format);
     if (type->definition == NULL)
@@ -1725,52 +2010,38 @@ coda_hdf4_Vdata *coda_hdf4_Vdata_new(coda_hdf4_product *product, int32 vdata_ref
                   strcasecmp(type->classname, DIM_VALS01) == 0 || strcasecmp(type->classname, _HDF_CDF) == 0 ||
                   strcasecmp(type->classname, DATA0) == 0 || strcasecmp(type->classname, ATTR_FIELD_NAME) == 0 ||
                   strncmp(type->classname, "_HDF_CHK_TBL_", 13) == 0);
-
-    num_fields = VFnfields(type->vdata_id);
-    num_records = VSelts(type->vdata_id);
-    type->field = malloc(num_fields * sizeof(coda_hdf4_Vdata_field *));
-    if (type->field == NULL)
+    if (type->hide)
     {
-        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                       num_fields * sizeof(coda_hdf4_Vdata_field *), __FILE__, __LINE__);
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
+        /* hidden Vdata are never accessible via the CODA type tree, so we don't need to create the fields and
+         * attributes and can release the Vdata handle right away */
+        if (VSdetach(type->vdata_id) != 0)
+        {
+            type->vdata_id = -1;
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
+        type->vdata_id = -1;
+        return type;
     }
-    for (i = 0; i < num_fields; i++)
+
+    if (coda_option_use_hdf4_lazy_loading)
     {
-        type->field[i] = NULL;
+        /* the fields are created when the Vdata is first entered and the attributes when they are first accessed */
+        return type;
     }
 
-    type->attributes = attributes_for_Vdata(product, type->vdata_id, type->ref);
-    if (type->attributes == NULL)
+    if (coda_hdf4_type_init_attributes(product, (coda_hdf4_type *)type) != 0)
     {
         coda_hdf4_type_delete((coda_dynamic_type *)type);
         return NULL;
     }
-    if (coda_type_set_attributes((coda_type *)type->definition, type->attributes->definition) != 0)
+    if (coda_hdf4_type_init_fields((coda_product *)product, (coda_dynamic_type *)type) != 0)
     {
         coda_hdf4_type_delete((coda_dynamic_type *)type);
         return NULL;
     }
 
-    /* from here on we use delete_hdf4Vdata for the cleanup of T when an error condition occurs */
-
-    for (i = 0; i < num_fields; i++)
-    {
-        type->field[i] = Vdata_field_new(product, type->vdata_id, i, num_records);
-        if (type->field[i] == NULL)
-        {
-            coda_hdf4_type_delete((coda_dynamic_type *)type);
-            return NULL;
-        }
-        if (coda_type_record_create_field(type->definition, type->field[i]->field_name,
-                                          (coda_type *)type->field[i]->definition) != 0)
-        {
-            coda_hdf4_type_delete((coda_dynamic_type *)type);
-            return NULL;
-        }
-    }
-
     return type;
 }
 
@@ -1845,19 +2116,30 @@ coda_hdf4_Vgroup *coda_hdf4_Vgroup_new(coda_hdf4_product *product, int32 vgroup_
                   strcasecmp(type->classname, _HDF_VARIABLE) == 0 || strcasecmp(type->classname, _HDF_DIMENSION) == 0 ||
                   strcasecmp(type->classname, _HDF_UDIMENSION) == 0 || strcasecmp(type->classname, _HDF_CDF) == 0 ||
                   strcasecmp(type->classname, DATA0) == 0 || strcasecmp(type->classname, ATTR_FIELD_NAME) == 0);
+    if (type->hide)
+    {
+        /* hidden Vgroups are never accessible via the CODA type tree, so we don't need to create the attributes and
+         * can release the Vgroup handle right away */
+        if (Vdetach(type->vgroup_id) != 0)
+        {
+            type->vgroup_id = -1;
+            coda_set_error(CODA_ERROR_HDF4, NULL);
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
+        type->vgroup_id = -1;
+        return type;
+    }
 
     /* The 'entry' array is initialized in init_hdf4Vgroups() */
 
-    type->attributes = attributes_for_Vgroup(product, type->vgroup_id);
-    if (type->attributes == NULL)
-    {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
-    }
-    if (coda_type_set_attributes((coda_type *)type->definition, type->attributes->definition) != 0)
+    if (!coda_option_use_hdf4_lazy_loading)
     {
-        coda_hdf4_type_delete((coda_dynamic_type *)type);
-        return NULL;
+        if (coda_hdf4_type_init_attributes(product, (coda_hdf4_type *)type) != 0)
+        {
+            coda_hdf4_type_delete((coda_dynamic_type *)type);
+            return NULL;
+        }
     }
 
     return type;
@@ -187,6 +187,11 @@ static int init_Vgroups(coda_hdf4_product *product)
         int32 num_entries;
 
         type = product->vgroup[i];
+        if (type->hide)
+        {
+            /* hidden Vgroups are not attached and their entries are never shown */
+            continue;
+        }
         num_entries = Vntagrefs(type->vgroup_id);
         if (num_entries < 0)
         {
@@ -194,7 +199,7 @@ static int init_Vgroups(coda_hdf4_product *product)
             return -1;
         }
 
-        if (num_entries > 0 && !type->hide)
+        if (num_entries > 0)
         {
             int32 *tags;
             int32 *refs;
@@ -40,6 +40,7 @@ int coda_hdf4_reopen(coda_product **product);
 int coda_hdf4_close(coda_product *product);
 
 void coda_hdf4_type_delete(coda_dynamic_type *type);
+int coda_hdf4_type_init_fields(coda_product *product, coda_dynamic_type *type);
 
 int coda_hdf4_cursor_set_product(coda_cursor *cursor, coda_product *product);
 int coda_hdf4_cursor_goto_record_field_by_index(coda_cursor *cursor, long index);
@@ -87,6 +87,241 @@ static void get_hdf5_type_and_size(coda_native_type read_type, hid_t *type_id, i
     }
 }
 
+/* maximum amount of memory (in bytes) that is used for caching compound data of a single dataset */
+#define DATASET_CACHE_SIZE (1024 * 1024)
+/* maximum number of variable length strings that is cached for a single dataset */
+#define DATASET_CACHE_NUM_STRINGS 4096
+
+static int init_dataset_cache_type(coda_hdf5_dataset *dataset)
+{
+    if (dataset->base_type->tag == tag_hdf5_compound_datatype)
+    {
+        coda_hdf5_compound_data_type *compound_type = (coda_hdf5_compound_data_type *)dataset->base_type;
+        long num_members = compound_type->definition->num_fields;
+        size_t offset = 0;
+        long i;
+
+        /* the cached elements contain all supported members of the compound, packed in file representation */
+        if (dataset->cache_member_offset != NULL)
+        {
+            free(dataset->cache_member_offset);
+        }
+        dataset->cache_member_offset = malloc(num_members * sizeof(size_t));
+        if (dataset->cache_member_offset == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           num_members * sizeof(size_t), __FILE__, __LINE__);
+            return -1;
+        }
+        for (i = 0; i < num_members; i++)
+        {
+            dataset->cache_member_offset[i] = offset;
+            offset += H5Tget_size(compound_type->member_type[i]);
+        }
+        dataset->cache_type_id = H5Tcreate(H5T_COMPOUND, offset > 0 ? offset : 1);
+        if (dataset->cache_type_id < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            return -1;
+        }
+        for (i = 0; i < num_members; i++)
+        {
+            hid_t member_id;
+            char *name;
+
+            member_id = H5Tget_member_type(compound_type->member_type[i], 0);
+            if (member_id < 0)
+            {
+                coda_set_error(CODA_ERROR_HDF5, NULL);
+                return -1;
+            }
+            name = H5Tget_member_name(compound_type->member_type[i], 0);
+            if (name == NULL)
+            {
+                coda_set_error(CODA_ERROR_HDF5, NULL);
+                H5Tclose(member_id);
+                return -1;
+            }
+            if (H5Tinsert(dataset->cache_type_id, name, dataset->cache_member_offset[i], member_id) < 0)
+            {
+                coda_set_error(CODA_ERROR_HDF5, NULL);
+                free(name);
+                H5Tclose(member_id);
+                return -1;
+            }
+            free(name);
+            H5Tclose(member_id);
+        }
+    }
+    else
+    {
+        /* variable length strings are cached as an array of 'char *' */
+        dataset->cache_type_id = H5Tcopy(dataset->base_type->datatype_id);
+        if (dataset->cache_type_id < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* Returns a pointer to the cached data of element 'index' of a dataset.
+ * If the element is not in the cache, a block of elements that starts at 'index' is read with a single H5Dread().
+ * The block consists of a range of indices along the first dimension for which a full 'row' still fits in the cache.
+ */
+static int get_cached_element(coda_hdf5_dataset *dataset, long index, uint8_t **element)
+{
+    hsize_t start[CODA_MAX_NUM_DIMS];
+    hsize_t count[CODA_MAX_NUM_DIMS];
+    hsize_t length;
+    hid_t mem_space_id;
+    size_t element_size;
+    long max_elements;
+    long inner_size;
+    int num_dims;
+    int i;
+
+    if (dataset->cache_type_id < 0)
+    {
+        if (init_dataset_cache_type(dataset) != 0)
+        {
+            if (dataset->cache_type_id >= 0)
+            {
+                H5Tclose(dataset->cache_type_id);
+                dataset->cache_type_id = -1;
+            }
+            return -1;
+        }
+    }
+    element_size = H5Tget_size(dataset->cache_type_id);
+
+    if (dataset->cache != NULL && index >= dataset->cache_offset &&
+        index < dataset->cache_offset + dataset->cache_length)
+    {
+        *element = &dataset->cache[(index - dataset->cache_offset) * element_size];
+        return 0;
+    }
+    coda_hdf5_dataset_clear_cache(dataset);
+
+    num_dims = dataset->definition->num_dims;
+    if (dataset->base_type->tag == tag_hdf5_compound_datatype)
+    {
+        max_elements = (long)(DATASET_CACHE_SIZE / element_size);
+        if (max_elements < 1)
+        {
+            max_elements = 1;
+        }
+    }
+    else
+    {
+        max_elements = DATASET_CACHE_NUM_STRINGS;
+    }
+
+    /* find the outermost dimension 'i' for which the inner dimensions still fit in the cache */
+    inner_size = 1;
+    for (i = num_dims - 1; i >= 0; i--)
+    {
+        if (inner_size * dataset->definition->dim[i] > max_elements)
+        {
+            break;
+        }
+        inner_size *= dataset->definition->dim[i];
+    }
+    if (i < 0)
+    {
+        /* the full dataset fits in the cache */
+        dataset->cache_offset = 0;
+        dataset->cache_length = (num_dims > 0 ? inner_size : 1);
+    }
+    else
+    {
+        long array_index = index;
+        int j;
+
+        for (j = num_dims - 1; j >= 0; j--)
+        {
+            if (j > i)
+            {
+                start[j] = 0;
+                count[j] = dataset->definition->dim[j];
+            }
+            else if (j == i)
+            {
+                start[j] = array_index % dataset->definition->dim[j];
+                count[j] = max_elements / inner_size;
+                if ((long)(start[j] + count[j]) > dataset->definition->dim[j])
+                {
+                    count[j] = dataset->definition->dim[j] - start[j];
+                }
+            }
+            else
+            {
+                start[j] = array_index % dataset->definition->dim[j];
+                count[j] = 1;
+            }
+            array_index = array_index / dataset->definition->dim[j];
+        }
+        dataset->cache_offset = index - index % inner_size;
+        dataset->cache_length = (long)count[i] * inner_size;
+    }
+
+    dataset->cache = malloc(dataset->cache_length * element_size);
+    if (dataset->cache == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       dataset->cache_length * element_size, __FILE__, __LINE__);
+        dataset->cache_length = 0;
+        return -1;
+    }
+
+    if (i >= 0)
+    {
+        if (H5Sselect_hyperslab(dataset->dataspace_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            free(dataset->cache);
+            dataset->cache = NULL;
+            dataset->cache_length = 0;
+            return -1;
+        }
+    }
+    length = (hsize_t)dataset->cache_length;
+    mem_space_id = H5Screate_simple(1, &length, NULL);
+    if (mem_space_id < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Sselect_all(dataset->dataspace_id);
+        free(dataset->cache);
+        dataset->cache = NULL;
+        dataset->cache_length = 0;
+        return -1;
+    }
+    if (H5Dread(dataset->dataset_id, dataset->cache_type_id, mem_space_id, dataset->dataspace_id, H5P_DEFAULT,
+                dataset->cache) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Sclose(mem_space_id);
+        H5Sselect_all(dataset->dataspace_id);
+        free(dataset->cache);
+        dataset->cache = NULL;
+        dataset->cache_length = 0;
+        return -1;
+    }
+    H5Sclose(mem_space_id);
+    if (H5Sselect_all(dataset->dataspace_id) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        coda_hdf5_dataset_clear_cache(dataset);
+        return -1;
+    }
+
+    *element = &dataset->cache[(index - dataset->cache_offset) * element_size];
+
+    return 0;
+}
+
 int coda_hdf5_cursor_set_product(coda_cursor *cursor, coda_product *product)
 {
     cursor->product = product;
@@ -123,6 +358,15 @@ int coda_hdf5_cursor_goto_record_field_by_index(coda_cursor *cursor, long index)
                 return -1;
             }
             field_type = (coda_dynamic_type *)((coda_hdf5_group *)record_type)->object[index];
+            if (((coda_hdf5_type *)field_type)->tag == tag_hdf5_group)
+            {
+                /* members of a group are only initialized when the group is first entered */
+                if (coda_hdf5_group_init_members((coda_hdf5_product *)cursor->product,
+                                                 (coda_hdf5_group *)field_type) != 0)
+                {
+                    return -1;
+                }
+            }
             break;
         default:
             assert(0);
@@ -275,6 +519,14 @@ int coda_hdf5_cursor_goto_attributes(coda_cursor *cursor)
     coda_hdf5_type *type;
 
     type = (coda_hdf5_type *)cursor->stack[cursor->n - 1].type;
+    if (type->tag == tag_hdf5_group || type->tag == tag_hdf5_dataset)
+    {
+        /* attributes are only read when they are first accessed */
+        if (coda_hdf5_object_init_attributes((coda_hdf5_product *)cursor->product, (coda_hdf5_object *)type) != 0)
+        {
+            return -1;
+        }
+    }
     cursor->n++;
     switch (type->tag)
     {
@@ -328,28 +580,21 @@ int coda_hdf5_cursor_get_string_length(const coda_cursor *cursor, long *length)
     if (base_type->is_variable_string)
     {
         coda_hdf5_dataset *dataset;
-        long array_index;
-        hsize_t size;
 
         /* in CODA, variable strings only exist when the parent is a dataset (attributes are cached in memory) */
         dataset = (coda_hdf5_dataset *)cursor->stack[cursor->n - 2].type;
         assert(dataset->tag == tag_hdf5_dataset);
-        array_index = cursor->stack[cursor->n - 1].index;
         if (dataset->definition->num_dims > 0)
         {
-            hsize_t coord[CODA_MAX_NUM_DIMS];
-            int i;
+            uint8_t *element;
+            char *str;
 
-            for (i = dataset->definition->num_dims - 1; i >= 0; i--)
-            {
-                coord[i] = array_index % dataset->definition->dim[i];
-                array_index = array_index / dataset->definition->dim[i];
-            }
-            if (H5Sselect_elements(dataset->dataspace_id, H5S_SELECT_SET, 1, (const hsize_t *)coord) < 0)
+            if (get_cached_element(dataset, cursor->stack[cursor->n - 1].index, &element) != 0)
             {
-                coda_set_error(CODA_ERROR_HDF5, NULL);
                 return -1;
             }
+            str = *(char **)element;
+            *length = (str == NULL ? 0 : (long)strlen(str));
         }
         else
         {
@@ -377,28 +622,7 @@ int coda_hdf5_cursor_get_string_length(const coda_cursor *cursor, long *length)
                 H5Sclose(mem_space_id);
                 return -1;
             }
-            return 0;
         }
-
-        if (H5Dvlen_get_buf_size(dataset->dataset_id, base_type->datatype_id, dataset->dataspace_id, &size) < 0)
-        {
-            coda_set_error(CODA_ERROR_HDF5, NULL);
-            return -1;
-        }
-
-        if (H5Sselect_all(dataset->dataspace_id) < 0)
-        {
-            coda_set_error(CODA_ERROR_HDF5, NULL);
-            return -1;
-        }
-
-        /* if the data type uses 'H5T_STR_NULLTERM', we need to subtract 1 to get the actual string length */
-        if (size > 0 && H5Tget_strpad(base_type->datatype_id) == H5T_STR_NULLTERM)
-        {
-            size--;
-        }
-
-        *length = (long)size;
     }
     else
     {
@@ -629,15 +853,86 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
     return 0;
 }
 
+/* convert the 'size' bytes of raw data in 'buffer' to the read type of 'base_type' and store the result in 'dst'
+ * the buffer will be modified and is free()d by this function
+ */
+static int convert_basic_value(coda_hdf5_basic_data_type *base_type, char *buffer, long size, void *dst, long dst_size)
+{
+    if (base_type->definition->read_type == coda_native_type_string)
+    {
+        long num_chars;
+
+        /* limit the number of returned characters */
+        if (size > dst_size - 1)
+        {
+            num_chars = dst_size - 1;
+        }
+        else
+        {
+            num_chars = size;
+        }
+        memcpy(dst, buffer, num_chars);
+        ((char *)dst)[num_chars] = '\0';
+    }
+    else
+    {
+        hid_t from_type;
+        hid_t datatype_to;
+        int new_size;
+
+        if (H5Tget_class(base_type->datatype_id) == H5T_ENUM)
+        {
+            /* convert the enumeration data to an integer value */
+            from_type = H5Tget_super(base_type->datatype_id);
+            if (from_type < 0)
+            {
+                coda_set_error(CODA_ERROR_HDF5, NULL);
+                free(buffer);
+                return -1;
+            }
+        }
+        else
+        {
+            from_type = H5Tcopy(base_type->datatype_id);
+        }
+        get_hdf5_type_and_size(base_type->definition->read_type, &datatype_to, &new_size);
+        if (new_size > size)
+        {
+            /* use 'dst' for the conversion buffer */
+            memcpy(dst, buffer, size);
+            if (H5Tconvert(from_type, datatype_to, 1, dst, NULL, H5P_DEFAULT) < 0)
+            {
+                coda_set_error(CODA_ERROR_HDF5, NULL);
+                H5Tclose(from_type);
+                free(buffer);
+                return -1;
+            }
+        }
+        else
+        {
+            /* use 'buffer' for the conversion buffer */
+            if (H5Tconvert(from_type, datatype_to, 1, buffer, NULL, H5P_DEFAULT) < 0)
+            {
+                coda_set_error(CODA_ERROR_HDF5, NULL);
+                H5Tclose(from_type);
+                free(buffer);
+                return -1;
+            }
+            memcpy(dst, buffer, new_size);
+        }
+        H5Tclose(from_type);
+    }
+    free(buffer);
+
+    return 0;
+}
+
 static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
 {
     coda_hdf5_basic_data_type *base_type;
-    coda_hdf5_compound_data_type *compound_type = NULL;
     coda_hdf5_dataset *dataset;
     hid_t mem_space_id;
-    hid_t datatype_to;
     char *buffer = NULL;
-    char *buffer_offset;        /* position in buffer where our value is stored */
     int is_compound_member;
     int array_depth;
     long array_index;
@@ -653,16 +948,12 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
     {
         assert(cursor->n > 2);
         compound_index = cursor->stack[cursor->n - 1].index;
-        compound_type = (coda_hdf5_compound_data_type *)cursor->stack[cursor->n - 2].type;
         /* the parent of the compound data type should be the dataset or attribute */
         array_depth = cursor->n - 3;
-        datatype_to = compound_type->member_type[compound_index];
-        /* note that datatype_to already has the filter to read the right element from the compound */
     }
     else
     {
         array_depth = cursor->n - 2;
-        datatype_to = base_type->datatype_id;
     }
     assert(((coda_hdf5_type *)cursor->stack[array_depth].type)->tag == tag_hdf5_dataset);
 
@@ -670,11 +961,47 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
 
     if (!base_type->is_variable_string)
     {
-        size = (long)H5Tget_size(datatype_to);
+        size = (long)H5Tget_size(base_type->datatype_id);
     }
 
     dataset = (coda_hdf5_dataset *)cursor->stack[array_depth].type;
 
+    if (is_compound_member || (base_type->is_variable_string && dataset->definition->num_dims > 0))
+    {
+        uint8_t *element;
+        char *value;
+
+        /* compound members and variable length strings are read in blocks via the dataset cache */
+        if (get_cached_element(dataset, array_index, &element) != 0)
+        {
+            return -1;
+        }
+        if (is_compound_member)
+        {
+            value = (char *)&element[dataset->cache_member_offset[compound_index]];
+        }
+        else
+        {
+            value = *(char **)element;
+            size = (value == NULL ? 0 : (long)strlen(value));
+        }
+
+        /* make a copy, since the value conversion is performed in place */
+        buffer = malloc(size > 0 ? size : 1);
+        if (buffer == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (long)size, __FILE__, __LINE__);
+            return -1;
+        }
+        if (size > 0)
+        {
+            memcpy(buffer, value, size);
+        }
+
+        return convert_basic_value(base_type, buffer, size, dst, dst_size);
+    }
+
     if (dataset->definition->num_dims > 0)
     {
         hsize_t coord[CODA_MAX_NUM_DIMS];
@@ -703,7 +1030,8 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
             coda_set_error(CODA_ERROR_HDF5, NULL);
             return -1;
         }
-        if (H5Dread(dataset->dataset_id, datatype_to, mem_space_id, dataset->dataspace_id, H5P_DEFAULT, &buffer) < 0)
+        if (H5Dread(dataset->dataset_id, base_type->datatype_id, mem_space_id, dataset->dataspace_id, H5P_DEFAULT,
+                    &buffer) < 0)
         {
             coda_set_error(CODA_ERROR_HDF5, NULL);
             H5Sclose(mem_space_id);
@@ -723,7 +1051,7 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
         memcpy(dst, buffer, num_chars);
         ((char *)dst)[num_chars] = '\0';
 
-        if (H5Dvlen_reclaim(datatype_to, mem_space_id, H5P_DEFAULT, &buffer) < 0)
+        if (H5Dvlen_reclaim(base_type->datatype_id, mem_space_id, H5P_DEFAULT, &buffer) < 0)
         {
             coda_set_error(CODA_ERROR_HDF5, NULL);
             H5Sclose(mem_space_id);
@@ -732,25 +1060,6 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
         return 0;
     }
 
-    if (base_type->is_variable_string)
-    {
-        hsize_t buffer_size;
-
-        if (H5Dvlen_get_buf_size(dataset->dataset_id, base_type->datatype_id, dataset->dataspace_id, &buffer_size) < 0)
-        {
-            coda_set_error(CODA_ERROR_HDF5, NULL);
-            return -1;
-        }
-
-        /* if the data type uses 'H5T_STR_NULLTERM', we need to subtract 1 to get the actual string length */
-        if (buffer_size > 0 && H5Tget_strpad(base_type->datatype_id) == H5T_STR_NULLTERM)
-        {
-            buffer_size--;
-        }
-
-        size = (long)buffer_size;
-    }
-
     buffer = malloc(size);
     if (buffer == NULL)
     {
@@ -766,35 +1075,13 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
         free(buffer);
         return -1;
     }
-    if (base_type->is_variable_string)
+    if (H5Dread(dataset->dataset_id, base_type->datatype_id, mem_space_id, dataset->dataspace_id, H5P_DEFAULT,
+                buffer) < 0)
     {
-        char *vlen_ptr;
-
-        if (H5Dread(dataset->dataset_id, datatype_to, mem_space_id, dataset->dataspace_id, H5P_DEFAULT, &vlen_ptr) < 0)
-        {
-            coda_set_error(CODA_ERROR_HDF5, NULL);
-            H5Sclose(mem_space_id);
-            free(buffer);
-            return -1;
-        }
-        memcpy(buffer, vlen_ptr, size);
-        if (H5Dvlen_reclaim(datatype_to, mem_space_id, H5P_DEFAULT, &vlen_ptr) < 0)
-        {
-            coda_set_error(CODA_ERROR_HDF5, NULL);
-            H5Sclose(mem_space_id);
-            free(buffer);
-            return -1;
-        }
-    }
-    else
-    {
-        if (H5Dread(dataset->dataset_id, datatype_to, mem_space_id, dataset->dataspace_id, H5P_DEFAULT, buffer) < 0)
-        {
-            coda_set_error(CODA_ERROR_HDF5, NULL);
-            H5Sclose(mem_space_id);
-            free(buffer);
-            return -1;
-        }
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Sclose(mem_space_id);
+        free(buffer);
+        return -1;
     }
     H5Sclose(mem_space_id);
     if (H5Sselect_all(dataset->dataspace_id) < 0)
@@ -804,76 +1091,7 @@ static int read_basic_type(const coda_cursor *cursor, void *dst, long dst_size)
         return -1;
     }
 
-    buffer_offset = buffer;
-
-    /* convert buffer and store result in dst */
-
-    if (base_type->definition->read_type == coda_native_type_string)
-    {
-        long num_chars;
-
-        /* limit the number of returned characters */
-        if (size > dst_size - 1)
-        {
-            num_chars = dst_size - 1;
-        }
-        else
-        {
-            num_chars = size;
-        }
-        memcpy(dst, buffer_offset, num_chars);
-        ((char *)dst)[num_chars] = '\0';
-    }
-    else
-    {
-        hid_t from_type;
-        int new_size;
-
-        if (H5Tget_class(base_type->datatype_id) == H5T_ENUM)
-        {
-            /* convert the enumeration data to an integer value */
-            from_type = H5Tget_super(base_type->datatype_id);
-            if (from_type < 0)
-            {
-                coda_set_error(CODA_ERROR_HDF5, NULL);
-                free(buffer);
-                return -1;
-            }
-        }
-        else
-        {
-            from_type = H5Tcopy(base_type->datatype_id);
-        }
-        get_hdf5_type_and_size(base_type->definition->read_type, &datatype_to, &new_size);
-        if (new_size > size)
-        {
-            /* use 'dst' for the conversion buffer */
-            memcpy(dst, buffer_offset, size);
-            if (H5Tconvert(from_type, datatype_to, 1, dst, NULL, H5P_DEFAULT) < 0)
-            {
-                coda_set_error(CODA_ERROR_HDF5, NULL);
-                H5Tclose(from_type);
-                free(buffer);
-                return -1;
-            }
-        }
-        else
-        {
-            /* use 'buffer' for the conversion buffer */
-            if (H5Tconvert(from_type, datatype_to, 1, buffer_offset, NULL, H5P_DEFAULT) < 0)
-            {
-                coda_set_error(CODA_ERROR_HDF5, NULL);
-                H5Tclose(from_type);
-                free(buffer);
-                return -1;
-            }
-            memcpy(dst, buffer_offset, new_size);
-        }
-        H5Tclose(from_type);
-    }
-    free(buffer);
-
-    return 0;
+    return convert_basic_value(base_type, buffer, size, dst, dst_size);
 }
 
 int coda_hdf5_cursor_read_int8(const coda_cursor *cursor, int8_t *dst)
@@ -116,6 +116,8 @@ typedef struct coda_hdf5_group_struct
     hid_t group_id;
     coda_hdf5_object **object;
     coda_mem_record *attributes;
+    int members_initialized;    /* members are only added when the group is first accessed */
+    int attributes_initialized; /* attributes are only read when they are first accessed */
 } coda_hdf5_group;
 
 typedef struct coda_hdf5_dataset_struct
@@ -129,6 +131,14 @@ typedef struct coda_hdf5_dataset_struct
     hid_t dataspace_id;
     coda_hdf5_data_type *base_type;
     coda_mem_record *attributes;
+    int attributes_initialized; /* attributes are only read when they are first accessed */
+
+    /* cache of a block of elements; only used for compound and variable length string data */
+    hid_t cache_type_id;        /* memory type of the cached elements (-1 if not created yet) */
+    size_t *cache_member_offset;        /* offset of each compound member within a cached element */
+    uint8_t *cache;             /* elements [cache_offset, cache_offset + cache_length) */
+    long cache_offset;
+    long cache_length;
 } coda_hdf5_dataset;
 
 struct coda_hdf5_product_struct
@@ -152,6 +162,9 @@ struct coda_hdf5_product_struct
 typedef struct coda_hdf5_product_struct coda_hdf5_product;
 
 int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *path, coda_hdf5_object **object);
+int coda_hdf5_group_init_members(coda_hdf5_product *product, coda_hdf5_group *group);
+int coda_hdf5_object_init_attributes(coda_hdf5_product *product, coda_hdf5_object *object);
 int coda_hdf5_basic_type_set_conversion(coda_hdf5_data_type *type, coda_conversion *conversion);
+void coda_hdf5_dataset_clear_cache(coda_hdf5_dataset *dataset);
 
 #endif
@@ -37,6 +37,37 @@
 
 #include "coda-hdf5-internal.h"
 
+/* upper limit for the automatically determined size of the chunk cache of a dataset */
+#define MAX_AUTO_CHUNK_CACHE_SIZE (64 * 1024 * 1024)
+/* upper limit for the automatically determined number of slots in the chunk cache of a dataset */
+#define MAX_AUTO_CHUNK_CACHE_NUM_SLOTS 1000000
+
+void coda_hdf5_dataset_clear_cache(coda_hdf5_dataset *dataset)
+{
+    if (dataset->cache == NULL)
+    {
+        return;
+    }
+    if (dataset->base_type->tag == tag_hdf5_basic_datatype &&
+        ((coda_hdf5_basic_data_type *)dataset->base_type)->is_variable_string)
+    {
+        hsize_t length = (hsize_t)dataset->cache_length;
+        hid_t mem_space_id;
+
+        /* release the strings that were allocated by the HDF5 library */
+        mem_space_id = H5Screate_simple(1, &length, NULL);
+        if (mem_space_id >= 0)
+        {
+            H5Dvlen_reclaim(dataset->cache_type_id, mem_space_id, H5P_DEFAULT, dataset->cache);
+            H5Sclose(mem_space_id);
+        }
+    }
+    free(dataset->cache);
+    dataset->cache = NULL;
+    dataset->cache_offset = 0;
+    dataset->cache_length = 0;
+}
+
 void coda_hdf5_type_delete(coda_dynamic_type *type)
 {
     long i;
@@ -97,6 +128,15 @@ void coda_hdf5_type_delete(coda_dynamic_type *type)
             H5Gclose(((coda_hdf5_group *)type)->group_id);
             break;
         case tag_hdf5_dataset:
+            coda_hdf5_dataset_clear_cache((coda_hdf5_dataset *)type);
+            if (((coda_hdf5_dataset *)type)->cache_type_id >= 0)
+            {
+                H5Tclose(((coda_hdf5_dataset *)type)->cache_type_id);
+            }
+            if (((coda_hdf5_dataset *)type)->cache_member_offset != NULL)
+            {
+                free(((coda_hdf5_dataset *)type)->cache_member_offset);
+            }
             if (((coda_hdf5_dataset *)type)->attributes != NULL)
             {
                 coda_dynamic_type_delete((coda_dynamic_type *)((coda_hdf5_dataset *)type)->attributes);
@@ -1028,13 +1068,10 @@ static int new_hdf5Attribute(coda_product *product, hid_t attr_id, const char *n
     return 0;
 }
 
-static coda_mem_record *new_hdf5AttributeRecord(coda_product *product, hid_t obj_id, coda_conversion *conversion)
+static coda_mem_record *new_hdf5AttributeRecord(void)
 {
     coda_type_record *definition;
     coda_mem_record *attrs;
-    long num_attributes;
-    long i;
-    int result;
 
     definition = coda_type_record_new(coda_format_hdf5);
     if (definition == NULL)
@@ -1043,17 +1080,21 @@ static coda_mem_record *new_hdf5AttributeRecord(coda_product *product, hid_t obj
     }
     attrs = coda_mem_record_new(definition, NULL);
     coda_type_release((coda_type *)definition);
-    if (attrs == NULL)
-    {
-        return NULL;
-    }
+
+    return attrs;
+}
+
+static int read_hdf5Attributes(coda_product *product, hid_t obj_id, coda_mem_record *attrs)
+{
+    long num_attributes;
+    long i;
+    int result;
 
     num_attributes = H5Aget_num_attrs(obj_id);
     if (num_attributes < 0)
     {
         coda_set_error(CODA_ERROR_HDF5, NULL);
-        coda_dynamic_type_delete((coda_dynamic_type *)attrs);
-        return NULL;
+        return -1;
     }
 
     /* initialize attributes */
@@ -1068,17 +1109,15 @@ static coda_mem_record *new_hdf5AttributeRecord(coda_product *product, hid_t obj
         if (attr_id < 0)
         {
             coda_set_error(CODA_ERROR_HDF5, NULL);
-            coda_dynamic_type_delete((coda_dynamic_type *)attrs);
-            return NULL;
+            return -1;
         }
 
         length = (int)H5Aget_name(attr_id, 0, NULL);
         if (length < 0)
         {
             coda_set_error(CODA_ERROR_HDF5, NULL);
-            coda_dynamic_type_delete((coda_dynamic_type *)attrs);
             H5Aclose(attr_id);
-            return NULL;
+            return -1;
         }
         if (length == 0)
         {
@@ -1091,27 +1130,23 @@ static coda_mem_record *new_hdf5AttributeRecord(coda_product *product, hid_t obj
         {
             coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
                            (long)length + 1, __FILE__, __LINE__);
-            coda_dynamic_type_delete((coda_dynamic_type *)attrs);
             H5Aclose(attr_id);
-            return NULL;
+            return -1;
         }
         if (H5Aget_name(attr_id, length + 1, name) < 0)
         {
             coda_set_error(CODA_ERROR_HDF5, NULL);
-            coda_dynamic_type_delete((coda_dynamic_type *)attrs);
             free(name);
             H5Aclose(attr_id);
-            return NULL;
+            return -1;
         }
 
-        result = new_hdf5Attribute(product, attr_id, name, conversion, &attribute);
+        result = new_hdf5Attribute(product, attr_id, name, NULL, &attribute);
         H5Aclose(attr_id);
         if (result < 0)
         {
-            /* attr_id is closed by new_hdf5Attributes() */
-            coda_dynamic_type_delete((coda_dynamic_type *)attrs);
             free(name);
-            return NULL;
+            return -1;
         }
         if (result == 1)
         {
@@ -1123,23 +1158,327 @@ static coda_mem_record *new_hdf5AttributeRecord(coda_product *product, hid_t obj
         if (coda_mem_record_add_field(attrs, name, attribute, 1) != 0)
         {
             coda_dynamic_type_delete((coda_dynamic_type *)attribute);
-            coda_dynamic_type_delete((coda_dynamic_type *)attrs);
             free(name);
-            return NULL;
+            return -1;
         }
 
         free(name);
     }
 
-    return attrs;
+    return 0;
+}
+
+/* only read the attributes that determine the conversion of a dataset (the other attributes are read on demand) */
+static int read_hdf5AttributeConversion(coda_product *product, hid_t obj_id, coda_conversion *conversion)
+{
+    const char *name[] = { "scale_factor", "add_offset", "missing_value", "_FillValue" };
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        coda_dynamic_type *attribute = NULL;
+        hid_t attr_id;
+        htri_t exists;
+        int result;
+
+        exists = H5Aexists(obj_id, name[i]);
+        if (exists < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            return -1;
+        }
+        if (!exists)
+        {
+            continue;
+        }
+        attr_id = H5Aopen(obj_id, name[i], H5P_DEFAULT);
+        if (attr_id < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            return -1;
+        }
+        result = new_hdf5Attribute(product, attr_id, name[i], conversion, &attribute);
+        H5Aclose(attr_id);
+        if (result < 0)
+        {
+            return -1;
+        }
+        if (result == 0)
+        {
+            coda_dynamic_type_delete(attribute);
+        }
+    }
+
+    return 0;
+}
+
+int coda_hdf5_object_init_attributes(coda_hdf5_product *product, coda_hdf5_object *object)
+{
+    if (object->tag == tag_hdf5_group)
+    {
+        coda_hdf5_group *group = (coda_hdf5_group *)object;
+
+        if (!group->attributes_initialized)
+        {
+            /* make sure we only try this once (even if reading fails) */
+            group->attributes_initialized = 1;
+            return read_hdf5Attributes((coda_product *)product, group->group_id, group->attributes);
+        }
+    }
+    else
+    {
+        coda_hdf5_dataset *dataset = (coda_hdf5_dataset *)object;
+
+        assert(object->tag == tag_hdf5_dataset);
+        if (!dataset->attributes_initialized)
+        {
+            /* make sure we only try this once (even if reading fails) */
+            dataset->attributes_initialized = 1;
+            return read_hdf5Attributes((coda_product *)product, dataset->dataset_id, dataset->attributes);
+        }
+    }
+
+    return 0;
+}
+
+typedef struct group_iterate_info_struct
+{
+    coda_hdf5_product *product;
+    coda_hdf5_group *group;
+    int error;  /* set if a CODA error was raised from within the iteration callback */
+} group_iterate_info;
+
+static herr_t init_group_member(hid_t group_id, const char *name, const H5L_info_t *link_info, void *op_data)
+{
+    group_iterate_info *info = (group_iterate_info *)op_data;
+    coda_hdf5_group *group = info->group;
+    long index = group->definition->num_fields;
+    int result;
+
+    if (link_info->type != H5L_TYPE_HARD)
+    {
+        /* we don't support soft links and external links */
+        return 0;
+    }
+
+    result = coda_hdf5_create_tree(info->product, group_id, name, &group->object[index]);
+    if (result == -1)
+    {
+        info->error = 1;
+        return -1;
+    }
+    if (result == 1)
+    {
+        /* skip this object */
+        return 0;
+    }
+    if (coda_type_record_create_field(group->definition, name, group->object[index]->definition) != 0)
+    {
+        info->error = 1;
+        return -1;
+    }
+
+    return 0;
+}
+
+int coda_hdf5_group_init_members(coda_hdf5_product *product, coda_hdf5_group *group)
+{
+    group_iterate_info info;
+    H5G_info_t group_info;
+    hsize_t idx = 0;
+    hsize_t i;
+
+    if (group->members_initialized)
+    {
+        return 0;
+    }
+    /* make sure we only try this once (even if initialization fails) */
+    group->members_initialized = 1;
+
+    if (H5Gget_info(group->group_id, &group_info) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        return -1;
+    }
+    if (group_info.nlinks == 0)
+    {
+        return 0;
+    }
+
+    group->object = malloc((size_t)group_info.nlinks * sizeof(coda_hdf5_object *));
+    if (group->object == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)group_info.nlinks * sizeof(coda_hdf5_object *), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < group_info.nlinks; i++)
+    {
+        group->object[i] = NULL;
+    }
+
+    info.product = product;
+    info.group = group;
+    info.error = 0;
+    if (H5Literate(group->group_id, H5_INDEX_NAME, H5_ITER_INC, &idx, init_group_member, &info) < 0)
+    {
+        if (!info.error)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+        }
+        return -1;
+    }
+
+    return 0;
+}
+
+static size_t next_prime(size_t n)
+{
+    size_t i;
+
+    if (n <= 2)
+    {
+        return 2;
+    }
+    if (n % 2 == 0)
+    {
+        n++;
+    }
+    for (;;)
+    {
+        for (i = 3; i * i <= n; i += 2)
+        {
+            if (n % i == 0)
+            {
+                break;
+            }
+        }
+        if (i * i > n)
+        {
+            return n;
+        }
+        n += 2;
+    }
+}
+
+/* Reopen a chunked dataset with a chunk cache that is large enough to hold all chunks that cover a single index of
+ * the first dimension. This prevents chunks from being decompressed over and over again when the dataset is
+ * traversed in C order (which is how CODA traverses arrays).
+ */
+static int set_dataset_chunk_cache(hid_t loc_id, const char *path, coda_hdf5_dataset *dataset, int num_dims,
+                                   const hsize_t *dim)
+{
+    hsize_t chunk_dim[CODA_MAX_NUM_DIMS];
+    hid_t plist_id;
+    hid_t datatype_id;
+    size_t element_size;
+    size_t num_slots;
+    size_t num_bytes;
+    double chunk_size;
+    double num_chunks;
+    double w0;
+    int i;
+
+    plist_id = H5Dget_create_plist(dataset->dataset_id);
+    if (plist_id < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        return -1;
+    }
+    if (H5Pget_layout(plist_id) != H5D_CHUNKED || H5Pget_chunk(plist_id, CODA_MAX_NUM_DIMS, chunk_dim) != num_dims)
+    {
+        /* there is no need to change the chunk cache */
+        H5Pclose(plist_id);
+        return 0;
+    }
+    H5Pclose(plist_id);
+
+    datatype_id = H5Dget_type(dataset->dataset_id);
+    if (datatype_id < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        return -1;
+    }
+    element_size = H5Tget_size(datatype_id);
+    H5Tclose(datatype_id);
+
+    chunk_size = (double)element_size;
+    num_chunks = 1;
+    for (i = 0; i < num_dims; i++)
+    {
+        chunk_size *= (double)chunk_dim[i];
+        if (i > 0)
+        {
+            num_chunks *= (double)((dim[i] + chunk_dim[i] - 1) / chunk_dim[i]);
+        }
+    }
+    if (chunk_size <= 0)
+    {
+        return 0;
+    }
+    if (num_chunks * chunk_size > MAX_AUTO_CHUNK_CACHE_SIZE)
+    {
+        num_chunks = (double)(long)(MAX_AUTO_CHUNK_CACHE_SIZE / chunk_size);
+        if (num_chunks < 1)
+        {
+            num_chunks = 1;
+        }
+    }
+
+    plist_id = H5Dget_access_plist(dataset->dataset_id);
+    if (plist_id < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        return -1;
+    }
+    if (H5Pget_chunk_cache(plist_id, &num_slots, &num_bytes, &w0) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Pclose(plist_id);
+        return -1;
+    }
+    if (num_chunks * chunk_size <= (double)num_bytes)
+    {
+        /* the default chunk cache is already large enough */
+        H5Pclose(plist_id);
+        return 0;
+    }
+    num_bytes = (size_t)(num_chunks * chunk_size);
+    if (coda_option_hdf5_chunk_cache_num_slots > 0)
+    {
+        num_slots = (size_t)coda_option_hdf5_chunk_cache_num_slots;
+    }
+    else
+    {
+        /* the HDF5 documentation advises to use a prime number of about 100 times the number of cached chunks */
+        num_slots = next_prime(num_chunks * 100 > MAX_AUTO_CHUNK_CACHE_NUM_SLOTS ? MAX_AUTO_CHUNK_CACHE_NUM_SLOTS :
+                               (size_t)(num_chunks * 100));
+    }
+    if (H5Pset_chunk_cache(plist_id, num_slots, num_bytes, coda_option_hdf5_chunk_cache_preemption) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Pclose(plist_id);
+        return -1;
+    }
+
+    /* the chunk cache settings of a dataset can only be provided when opening the dataset */
+    /* (and the dataset needs to be closed first, since HDF5 otherwise reuses the existing cache) */
+    H5Dclose(dataset->dataset_id);
+    dataset->dataset_id = H5Dopen2(loc_id, path, plist_id);
+    H5Pclose(plist_id);
+    if (dataset->dataset_id < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        return -1;
+    }
+
+    return 0;
 }
 
 /* returns: -1 = error, 0 = ok, 1 = ignore object ('type' is not set) */
 int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *path, coda_hdf5_object **object)
 {
     H5G_stat_t statbuf;
-    hsize_t num_objects = 0;
-    herr_t status;
     long i;
     int result;
 
@@ -1180,6 +1519,8 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
                 group->tag = tag_hdf5_group;
                 group->object = NULL;
                 group->attributes = NULL;
+                group->members_initialized = 0;
+                group->attributes_initialized = 0;
                 group->group_id = H5Gopen(loc_id, path);
                 if (group->group_id < 0)
                 {
@@ -1194,28 +1535,9 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
                     coda_hdf5_type_delete((coda_dynamic_type *)group);
                     return -1;
                 }
-                status = H5Gget_num_objs(group->group_id, &num_objects);
-                if (status < 0)
-                {
-                    coda_set_error(CODA_ERROR_HDF5, NULL);
-                    coda_hdf5_type_delete((coda_dynamic_type *)group);
-                    return -1;
-                }
-
-                group->object = malloc((size_t)num_objects * sizeof(coda_hdf5_object *));
-                if (group->object == NULL)
-                {
-                    coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                                   (long)num_objects * sizeof(coda_hdf5_object *), __FILE__, __LINE__);
-                    coda_hdf5_type_delete((coda_dynamic_type *)group);
-                    return -1;
-                }
-                for (i = 0; i < (long)num_objects; i++)
-                {
-                    group->object[i] = NULL;
-                }
 
-                group->attributes = new_hdf5AttributeRecord((coda_product *)product, group->group_id, NULL);
+                /* group members and attributes are only initialized when they are first accessed */
+                group->attributes = new_hdf5AttributeRecord();
                 if (group->attributes == NULL)
                 {
                     coda_hdf5_type_delete((coda_dynamic_type *)group);
@@ -1249,6 +1571,12 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
                 dataset->tag = tag_hdf5_dataset;
                 dataset->base_type = NULL;
                 dataset->attributes = NULL;
+                dataset->attributes_initialized = 0;
+                dataset->cache_type_id = -1;
+                dataset->cache_member_offset = NULL;
+                dataset->cache = NULL;
+                dataset->cache_offset = 0;
+                dataset->cache_length = 0;
 
                 dataset->dataset_id = H5Dopen(loc_id, path);
                 if (dataset->dataset_id < 0)
@@ -1329,6 +1657,14 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
                     coda_hdf5_type_delete((coda_dynamic_type *)dataset);
                     return -1;
                 }
+                if (coda_option_hdf5_chunk_cache_size == -1)
+                {
+                    if (set_dataset_chunk_cache(loc_id, path, dataset, num_dims, dim) != 0)
+                    {
+                        coda_hdf5_type_delete((coda_dynamic_type *)dataset);
+                        return -1;
+                    }
+                }
 
                 if (dataset->base_type->tag == tag_hdf5_basic_datatype)
                 {
@@ -1343,7 +1679,8 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
                         }
                     }
                 }
-                dataset->attributes = new_hdf5AttributeRecord((coda_product *)product, dataset->dataset_id, conversion);
+                /* attributes are only read when they are first accessed (except for those defining a conversion) */
+                dataset->attributes = new_hdf5AttributeRecord();
                 if (dataset->attributes == NULL)
                 {
                     coda_hdf5_type_delete((coda_dynamic_type *)dataset);
@@ -1356,6 +1693,13 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
                 /* check if we need to use a conversion */
                 if (conversion != NULL)
                 {
+                    if (read_hdf5AttributeConversion((coda_product *)product, dataset->dataset_id, conversion) != 0)
+                    {
+                        coda_hdf5_type_delete((coda_dynamic_type *)dataset);
+                        coda_conversion_delete(conversion);
+                        return -1;
+                    }
+
                     /* don't create conversions for integer data if we only have an 'invalid_value' attribute */
                     if (conversion->numerator != 1.0 || conversion->add_offset != 0.0 ||
                         (!coda_isNaN(conversion->invalid_value) &&
@@ -1415,67 +1759,19 @@ int coda_hdf5_create_tree(coda_hdf5_product *product, hid_t loc_id, const char *
     product->num_objects++;
     product->object[product->num_objects - 1] = *object;
 
-    if (statbuf.type == H5G_GROUP)
+    if (!coda_option_use_hdf5_lazy_loading)
     {
-        coda_hdf5_group *group;
-        hsize_t index;
-
-        group = (coda_hdf5_group *)*object;
-
-        /* initialize group members */
-        index = 0;
-        for (i = 0; i < (long)num_objects; i++)
+        /* initialize the full tree */
+        if ((*object)->tag == tag_hdf5_group)
         {
-            char *name;
-            int length;
-
-            length = (int)H5Gget_objname_by_idx(group->group_id, i, NULL, 0);
-            if (length < 0)
-            {
-                coda_set_error(CODA_ERROR_HDF5, NULL);
-                return -1;
-            }
-            if (length == 0)
+            if (coda_hdf5_group_init_members(product, (coda_hdf5_group *)*object) != 0)
             {
-                /* we ignore objects that can not be referenced using a path with names */
-                continue;
-            }
-
-            name = malloc(length + 1);
-            if (name == NULL)
-            {
-                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
-                               (long)length + 1, __FILE__, __LINE__);
                 return -1;
             }
-            if (H5Gget_objname_by_idx(group->group_id, i, name, length + 1) < 0)
-            {
-                coda_set_error(CODA_ERROR_HDF5, NULL);
-                free(name);
-                return -1;
-            }
-
-            result = coda_hdf5_create_tree(product, group->group_id, name, &group->object[index]);
-            if (result == -1)
-            {
-                free(name);
-                return -1;
-            }
-            if (result == 1)
-            {
-                /* skip this object */
-                free(name);
-                continue;
-            }
-            if (coda_type_record_create_field(group->definition, name, group->object[index]->definition) != 0)
-            {
-                free(name);
-                return -1;
-            }
-            free(name);
-
-            /* increase number of unignored objects */
-            index++;
+        }
+        if (coda_hdf5_object_init_attributes(product, *object) != 0)
+        {
+            return -1;
         }
     }
 
@@ -42,8 +42,93 @@ int coda_hdf5_init(void)
     return 0;
 }
 
+static hid_t create_file_access_plist(int use_page_buffer)
+{
+    hid_t fapl_id;
+    size_t num_slots;
+    size_t num_bytes;
+    double w0;
+    int mdc_nelmts;
+
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    if (fapl_id < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        return -1;
+    }
+
+    /* default raw data chunk cache for all datasets in the file */
+    if (H5Pget_cache(fapl_id, &mdc_nelmts, &num_slots, &num_bytes, &w0) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Pclose(fapl_id);
+        return -1;
+    }
+    if (coda_option_hdf5_chunk_cache_size > 0)
+    {
+        num_bytes = (size_t)coda_option_hdf5_chunk_cache_size;
+    }
+    if (coda_option_hdf5_chunk_cache_num_slots > 0)
+    {
+        num_slots = (size_t)coda_option_hdf5_chunk_cache_num_slots;
+    }
+    w0 = coda_option_hdf5_chunk_cache_preemption;
+    if (H5Pset_cache(fapl_id, mdc_nelmts, num_slots, num_bytes, w0) < 0)
+    {
+        coda_set_error(CODA_ERROR_HDF5, NULL);
+        H5Pclose(fapl_id);
+        return -1;
+    }
+
+    if (coda_option_hdf5_metadata_cache_size > 0)
+    {
+        H5AC_cache_config_t config;
+
+        config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+        if (H5Pget_mdc_config(fapl_id, &config) < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            H5Pclose(fapl_id);
+            return -1;
+        }
+        config.set_initial_size = 1;
+        config.initial_size = (size_t)coda_option_hdf5_metadata_cache_size;
+        if (config.max_size < config.initial_size)
+        {
+            config.max_size = config.initial_size;
+        }
+        if (config.min_size > config.initial_size)
+        {
+            config.min_size = config.initial_size;
+        }
+        if (H5Pset_mdc_config(fapl_id, &config) < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            H5Pclose(fapl_id);
+            return -1;
+        }
+    }
+
+#if H5_VERSION_GE(1, 10, 1)
+    if (use_page_buffer && coda_option_hdf5_page_buffer_size > 0)
+    {
+        if (H5Pset_page_buffer_size(fapl_id, (size_t)coda_option_hdf5_page_buffer_size, 0, 0) < 0)
+        {
+            coda_set_error(CODA_ERROR_HDF5, NULL);
+            H5Pclose(fapl_id);
+            return -1;
+        }
+    }
+#else
+    (void)use_page_buffer;
+#endif
+
+    return fapl_id;
+}
+
 int coda_hdf5_reopen(coda_product **product)
 {
+    hid_t fapl_id;
     coda_hdf5_product *product_file;
     int result;
 
@@ -80,7 +165,26 @@ int coda_hdf5_reopen(coda_product **product)
 
     coda_close(*product);
 
-    product_file->file_id = H5Fopen(product_file->filename, H5F_ACC_RDONLY, H5P_DEFAULT);
+    fapl_id = create_file_access_plist(1);
+    if (fapl_id < 0)
+    {
+        coda_hdf5_close((coda_product *)product_file);
+        return -1;
+    }
+    product_file->file_id = H5Fopen(product_file->filename, H5F_ACC_RDONLY, fapl_id);
+    H5Pclose(fapl_id);
+    if (product_file->file_id < 0 && coda_option_hdf5_page_buffer_size > 0)
+    {
+        /* a page buffer can only be used for files that were created with paged aggregation */
+        fapl_id = create_file_access_plist(0);
+        if (fapl_id < 0)
+        {
+            coda_hdf5_close((coda_product *)product_file);
+            return -1;
+        }
+        product_file->file_id = H5Fopen(product_file->filename, H5F_ACC_RDONLY, fapl_id);
+        H5Pclose(fapl_id);
+    }
     if (product_file->file_id < 0)
     {
         coda_set_error(CODA_ERROR_HDF5, NULL);
@@ -96,6 +200,11 @@ int coda_hdf5_reopen(coda_product **product)
     }
     /* the root type is a vgroup and it should not be possible to ignore the root vgroup */
     assert(result != 1);
+    if (coda_hdf5_group_init_members(product_file, (coda_hdf5_group *)product_file->root_type) != 0)
+    {
+        coda_hdf5_close((coda_product *)product_file);
+        return -1;
+    }
 
     *product = (coda_product *)product_file;
 
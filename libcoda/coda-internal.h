@@ -111,11 +111,22 @@ extern THREAD_LOCAL const char *libcoda_version;
 extern THREAD_LOCAL int coda_errno;
 
 extern THREAD_LOCAL int coda_option_bypass_special_types;
+extern THREAD_LOCAL long coda_option_cdf_cache_size;
+extern THREAD_LOCAL long coda_option_hdf5_chunk_cache_size;
+extern THREAD_LOCAL long coda_option_hdf5_chunk_cache_num_slots;
+extern THREAD_LOCAL double coda_option_hdf5_chunk_cache_preemption;
+extern THREAD_LOCAL long coda_option_hdf5_metadata_cache_size;
+extern THREAD_LOCAL long coda_option_hdf5_page_buffer_size;
 extern THREAD_LOCAL int coda_option_perform_boundary_checks;
 extern THREAD_LOCAL int coda_option_perform_conversions;
+extern THREAD_LOCAL int coda_option_profile_expressions;
 extern THREAD_LOCAL int coda_option_read_all_definitions;
 extern THREAD_LOCAL int coda_option_use_fast_size_expressions;
+extern THREAD_LOCAL int coda_option_use_grib_index;
+extern THREAD_LOCAL int coda_option_use_hdf4_lazy_loading;
+extern THREAD_LOCAL int coda_option_use_hdf5_lazy_loading;
 extern THREAD_LOCAL int coda_option_use_mmap;
+extern THREAD_LOCAL int coda_option_use_xml_lazy_loading;
 
 #define coda_get_type_for_dynamic_type(dynamic_type) (((coda_dynamic_type *)dynamic_type)->backend < first_dynamic_backend_id ? (coda_type *)dynamic_type : ((coda_dynamic_type *)dynamic_type)->definition)
 
@@ -156,5 +167,6 @@ int coda_dayofyear_to_month_day(int year, int day_of_year, int *month, int *day_
 int coda_month_to_integer(const char month[3]);
 int coda_leap_second_table_init(void);
 void coda_leap_second_table_done(void);
+void coda_time_format_cache_done(void);
 
 #endif
@@ -36,11 +36,35 @@
 #include "coda-read-array.h"
 #include "coda-read-partial-array.h"
 #include "coda-transpose-array.h"
+#include "coda-xml.h"
+#ifdef HAVE_HDF4
+#include "coda-hdf4.h"
+#endif
 
 #include <assert.h>
 #include <string.h>
 #include <stdlib.h>
 
+/* replace a lazy placeholder by the actual type (this loads the part of the product that the placeholder refers to) */
+static int load_lazy_type(coda_cursor *cursor, coda_dynamic_type **type)
+{
+    if (*type != NULL && (*type)->backend == coda_backend_memory && ((coda_mem_type *)*type)->tag == tag_mem_lazy)
+    {
+        /* placeholders are only created by the xml backend */
+        assert(cursor->product->format == coda_format_xml);
+        return coda_xml_load_element(cursor->product, type);
+    }
+#ifdef HAVE_HDF4
+    if (*type != NULL && (*type)->backend == coda_backend_hdf4)
+    {
+        /* the root record of an HDF4 product can contain Vdata whose fields are not created yet */
+        return coda_hdf4_type_init_fields(cursor->product, *type);
+    }
+#endif
+
+    return 0;
+}
+
 void coda_mem_cursor_update_offset(coda_cursor *cursor)
 {
     if (((coda_mem_type *)cursor->stack[cursor->n - 1].type)->tag == tag_mem_data)
@@ -61,6 +85,10 @@ int coda_mem_cursor_goto_record_field_by_index(coda_cursor *cursor, long index)
                            ((coda_mem_record *)type)->num_fields);
             return -1;
         }
+        if (load_lazy_type(cursor, &((coda_mem_record *)type)->field_type[index]) != 0)
+        {
+            return -1;
+        }
         cursor->n++;
         if (((coda_mem_record *)type)->field_type[index] != NULL)
         {
@@ -94,6 +122,10 @@ int coda_mem_cursor_goto_next_record_field(coda_cursor *cursor)
                            ((coda_mem_record *)type)->num_fields);
             return -1;
         }
+        if (load_lazy_type(cursor, &((coda_mem_record *)type)->field_type[index]) != 0)
+        {
+            return -1;
+        }
         if (((coda_mem_record *)type)->field_type[index] != NULL)
         {
             cursor->stack[cursor->n - 1].type = ((coda_mem_record *)type)->field_type[index];
@@ -158,6 +190,10 @@ int coda_mem_cursor_goto_array_element(coda_cursor *cursor, int num_subs, const
                 return -1;
             }
         }
+        if (load_lazy_type(cursor, &((coda_mem_array *)type)->element[subs[0]]) != 0)
+        {
+            return -1;
+        }
         cursor->n++;
         cursor->stack[cursor->n - 1].type = ((coda_mem_array *)type)->element[subs[0]];
         cursor->stack[cursor->n - 1].index = subs[0];
@@ -186,6 +222,10 @@ int coda_mem_cursor_goto_array_element_by_index(coda_cursor *cursor, long index)
                 return -1;
             }
         }
+        if (load_lazy_type(cursor, &((coda_mem_array *)type)->element[index]) != 0)
+        {
+            return -1;
+        }
         cursor->n++;
         cursor->stack[cursor->n - 1].type = ((coda_mem_array *)type)->element[index];
         cursor->stack[cursor->n - 1].index = index;
@@ -212,6 +252,10 @@ int coda_mem_cursor_goto_next_array_element(coda_cursor *cursor)
                            ((coda_mem_array *)type)->num_elements);
             return -1;
         }
+        if (load_lazy_type(cursor, &((coda_mem_array *)type)->element[index]) != 0)
+        {
+            return -1;
+        }
         if (((coda_mem_array *)type)->element[index] != NULL)
         {
             cursor->stack[cursor->n - 1].type = ((coda_mem_array *)type)->element[index];
@@ -310,6 +354,12 @@ int coda_mem_cursor_get_bit_size(const coda_cursor *cursor, int64_t *bit_size)
                 return -1;
             }
         }
+        else if (type->definition->type_class == coda_record_class && type->definition->bit_size < 0)
+        {
+            /* the size of a variable sized record is given by its data block (this allows the availability of
+             * optional fields at the end of the record to depend on the size of the data block) */
+            *bit_size = 8 * ((coda_mem_data *)type)->length;
+        }
         else if (coda_bin_cursor_get_bit_size(cursor, bit_size) != 0)
         {
             return -1;
@@ -348,6 +398,9 @@ int coda_mem_cursor_get_num_elements(const coda_cursor *cursor, long *num_elemen
         case tag_mem_special:
             *num_elements = 1;
             break;
+        case tag_mem_lazy:
+            assert(0);
+            exit(1);
     }
     return 0;
 }
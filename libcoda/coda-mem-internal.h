@@ -43,7 +43,8 @@ typedef enum mem_type_tag_enum
     tag_mem_record,
     tag_mem_array,
     tag_mem_data,
-    tag_mem_special
+    tag_mem_special,
+    tag_mem_lazy
 } mem_type_tag;
 
 typedef struct coda_mem_type_struct
@@ -93,6 +94,16 @@ typedef struct coda_mem_special_struct
     coda_dynamic_type *base_type;
 } coda_mem_special;
 
+/* placeholder for a part of the product that is only loaded once a cursor moves to it */
+typedef struct coda_mem_lazy_struct
+{
+    coda_backend backend;
+    coda_type *definition;
+    mem_type_tag tag;
+    coda_dynamic_type *attributes;
+    long id;    /* backend specific reference to the data that still needs to be loaded */
+} coda_mem_lazy;
+
 int coda_mem_type_update(coda_dynamic_type **type, coda_type *definition);
 
 int coda_mem_type_add_attribute(coda_mem_type *type, const char *real_name, coda_dynamic_type *attribute_type,
@@ -146,4 +157,6 @@ coda_mem_special *coda_mem_time_new(coda_type_special *definition, coda_dynamic_
                                     coda_dynamic_type *base_type);
 coda_mem_special *coda_mem_no_data_new(coda_format format);
 
+coda_mem_lazy *coda_mem_lazy_new(coda_type *definition, long id);
+
 #endif
@@ -78,6 +78,8 @@ void coda_mem_type_delete(coda_dynamic_type *type)
                 coda_dynamic_type_delete(((coda_mem_special *)type)->base_type);
             }
             break;
+        case tag_mem_lazy:
+            break;
     }
     if (((coda_mem_type *)type)->attributes != NULL)
     {
@@ -107,6 +109,12 @@ int coda_mem_type_update(coda_dynamic_type **type, coda_type *definition)
 
     assert((*type)->backend == coda_backend_memory);
 
+    if (((coda_mem_type *)*type)->tag == tag_mem_lazy)
+    {
+        /* the type will be created using the definition that it has at the moment that it gets loaded */
+        return 0;
+    }
+
     if ((*type)->definition != definition)
     {
         if (definition->type_class == coda_array_class && (*type)->definition->type_class != coda_array_class)
@@ -230,6 +238,9 @@ int coda_mem_type_update(coda_dynamic_type **type, coda_type *definition)
                 return -1;
             }
             break;
+        case tag_mem_lazy:
+            assert(0);
+            exit(1);
     }
 
     if (mem_type->attributes == NULL && mem_type->definition->attributes != NULL)
@@ -1042,3 +1053,29 @@ coda_mem_special *coda_mem_no_data_new(coda_format format)
 
     return type;
 }
+
+coda_mem_lazy *coda_mem_lazy_new(coda_type *definition, long id)
+{
+    coda_mem_lazy *type;
+
+    if (definition == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "definition argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return NULL;
+    }
+    type = (coda_mem_lazy *)malloc(sizeof(coda_mem_lazy));
+    if (type == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)sizeof(coda_mem_lazy), __FILE__, __LINE__);
+        return NULL;
+    }
+    type->backend = coda_backend_memory;
+    type->definition = definition;
+    definition->retain_count++;
+    type->tag = tag_mem_lazy;
+    type->attributes = NULL;
+    type->id = id;
+
+    return type;
+}
@@ -201,59 +201,33 @@ int coda_netcdf_cursor_get_array_dim(const coda_cursor *cursor, int *num_dims, l
     return coda_type_get_array_dim(cursor->stack[cursor->n - 1].type->definition, num_dims, dim);
 }
 
-static int read_array(const coda_cursor *cursor, void *dst)
+/* size of the buffer that is used to read multiple records at once */
+#define RECORD_BUFFER_SIZE 1048576
+
+#ifndef WORDS_BIGENDIAN
+static void swap_values(void *dst, long num_values, int bit_size)
 {
-    coda_netcdf_array *type;
-    coda_netcdf_product *product;
-    long block_size;
     long i;
 
-    type = (coda_netcdf_array *)cursor->stack[cursor->n - 1].type;
-    product = (coda_netcdf_product *)cursor->product;
-
-    block_size = (long)(type->definition->num_elements * (type->base_type->definition->bit_size >> 3));
-    if (type->base_type->record_var)
-    {
-        long num_blocks = type->definition->dim[0];
-
-        block_size /= num_blocks;
-        for (i = 0; i < num_blocks; i++)
-        {
-            if (read_bytes(product->raw_product, type->base_type->offset + i * product->record_size, block_size,
-                           &((uint8_t *)dst)[i * block_size]) != 0)
-            {
-                return -1;
-            }
-        }
-    }
-    else
-    {
-        if (read_bytes(product->raw_product, type->base_type->offset, block_size, (uint8_t *)dst) != 0)
-        {
-            return -1;
-        }
-    }
-
-#ifndef WORDS_BIGENDIAN
-    switch (type->base_type->definition->bit_size)
+    switch (bit_size)
     {
         case 8:
             /* no endianness conversion needed */
             break;
         case 16:
-            for (i = 0; i < type->definition->num_elements; i++)
+            for (i = 0; i < num_values; i++)
             {
                 swap2(&((int16_t *)dst)[i]);
             }
             break;
         case 32:
-            for (i = 0; i < type->definition->num_elements; i++)
+            for (i = 0; i < num_values; i++)
             {
                 swap4(&((int32_t *)dst)[i]);
             }
             break;
         case 64:
-            for (i = 0; i < type->definition->num_elements; i++)
+            for (i = 0; i < num_values; i++)
             {
                 swap8(&((int64_t *)dst)[i]);
             }
@@ -262,6 +236,138 @@ static int read_array(const coda_cursor *cursor, void *dst)
             assert(0);
             exit(1);
     }
+}
+#endif
+
+/* For each of the 'num_slices' slices, read 'slice_size[k]' bytes starting at file offset 'offset[k]' from each of
+ * 'num_records' consecutive records and store the slices contiguously in dst[k].
+ * The record section is walked only once: unless the product is memory mapped, multiple records are read with a
+ * single sequential read (covering all requested slices), after which the slices are copied out of the record buffer.
+ * This avoids a separate (small) read for each slice of each record.
+ */
+static int read_record_slices(coda_netcdf_product *product, int num_slices, const int64_t *offset,
+                              const long *slice_size, long num_records, uint8_t **dst)
+{
+    long records_per_read;
+    int64_t start_offset;
+    long span;
+    uint8_t *buffer;
+    long i;
+    int k;
+
+    if (num_slices == 0 || num_records == 0)
+    {
+        return 0;
+    }
+
+    /* determine the part of a record that covers all slices */
+    start_offset = offset[0];
+    for (k = 1; k < num_slices; k++)
+    {
+        if (offset[k] < start_offset)
+        {
+            start_offset = offset[k];
+        }
+    }
+    span = 0;
+    for (k = 0; k < num_slices; k++)
+    {
+        if ((long)(offset[k] - start_offset) + slice_size[k] > span)
+        {
+            span = (long)(offset[k] - start_offset) + slice_size[k];
+        }
+    }
+
+    records_per_read = RECORD_BUFFER_SIZE / product->record_size;
+    if (product->raw_product->mem_ptr != NULL || records_per_read < 2 || num_records < 2)
+    {
+        for (i = 0; i < num_records; i++)
+        {
+            for (k = 0; k < num_slices; k++)
+            {
+                if (read_bytes(product->raw_product, offset[k] + (int64_t)i * product->record_size, slice_size[k],
+                               &dst[k][i * slice_size[k]]) != 0)
+                {
+                    return -1;
+                }
+            }
+        }
+        return 0;
+    }
+
+    if (records_per_read > num_records)
+    {
+        records_per_read = num_records;
+    }
+    buffer = malloc((size_t)(records_per_read - 1) * product->record_size + span);
+    if (buffer == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)((records_per_read - 1) * product->record_size + span), __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_records; i += records_per_read)
+    {
+        long num_read = num_records - i < records_per_read ? num_records - i : records_per_read;
+        long j;
+
+        /* we only read up to the end of the slices in the last record (the last record may not be padded) */
+        if (read_bytes(product->raw_product, start_offset + (int64_t)i * product->record_size,
+                       (int64_t)(num_read - 1) * product->record_size + span, buffer) != 0)
+        {
+            free(buffer);
+            return -1;
+        }
+        for (j = 0; j < num_read; j++)
+        {
+            const uint8_t *record = &buffer[j * product->record_size];
+
+            for (k = 0; k < num_slices; k++)
+            {
+                memcpy(&dst[k][(i + j) * slice_size[k]], &record[offset[k] - start_offset], slice_size[k]);
+            }
+        }
+    }
+    free(buffer);
+
+    return 0;
+}
+
+static int read_array(const coda_cursor *cursor, void *dst)
+{
+    coda_netcdf_array *type;
+    coda_netcdf_product *product;
+    long block_size;
+
+    type = (coda_netcdf_array *)cursor->stack[cursor->n - 1].type;
+    product = (coda_netcdf_product *)cursor->product;
+
+    if (type->definition->num_elements == 0)
+    {
+        return 0;
+    }
+
+    block_size = (long)(type->definition->num_elements * (type->base_type->definition->bit_size >> 3));
+    if (type->base_type->record_var)
+    {
+        long num_blocks = type->definition->dim[0];
+        long slice_size = block_size / num_blocks;
+
+        if (read_record_slices(product, 1, &type->base_type->offset, &slice_size, num_blocks, (uint8_t **)&dst) != 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        if (read_bytes(product->raw_product, type->base_type->offset, block_size, (uint8_t *)dst) != 0)
+        {
+            return -1;
+        }
+    }
+
+#ifndef WORDS_BIGENDIAN
+    swap_values(dst, type->definition->num_elements, (int)type->base_type->definition->bit_size);
 #endif
 
     return 0;
@@ -272,43 +378,72 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
     coda_netcdf_array *type;
     coda_netcdf_product *product;
     long value_size;
-    long i;
 
     type = (coda_netcdf_array *)cursor->stack[cursor->n - 1].type;
     product = (coda_netcdf_product *)cursor->product;
 
+    if (length <= 0)
+    {
+        return 0;
+    }
+
     value_size = (long)(type->base_type->definition->bit_size >> 3);
     if (type->base_type->record_var)
     {
-        long num_blocks = type->definition->dim[0];
-        long num_values_per_block;
-        int64_t target_offset;
+        long num_values_per_block = type->definition->num_elements / type->definition->dim[0];
+        long first_block = offset / num_values_per_block;
+        long last_block = (offset + length - 1) / num_values_per_block;
+        long local_offset = offset - first_block * num_values_per_block;        /* value offset within record */
+        uint8_t *target = (uint8_t *)dst;
 
-        num_values_per_block = type->definition->num_elements / num_blocks;
-        target_offset = 0;
+        if (local_offset > 0 || first_block == last_block)
+        {
+            /* (partial) first record */
+            long local_length = num_values_per_block - local_offset;
 
-        for (i = 0; i < num_blocks; i++)
+            if (local_length > length)
+            {
+                local_length = length;
+            }
+            if (read_bytes(product->raw_product, type->base_type->offset +
+                           (int64_t)first_block * product->record_size + local_offset * value_size,
+                           local_length * value_size, target) != 0)
+            {
+                return -1;
+            }
+            target += local_length * value_size;
+            first_block++;
+        }
+        if (first_block <= last_block)
         {
-            int64_t local_offset = 0;   /* byte offset within record */
-            int64_t local_size = num_values_per_block * value_size;     /* amount of bytes to read */
+            /* full records (the last record is read separately if it is only partially needed) */
+            long num_full_blocks = last_block - first_block;
+            long last_length = offset + length - last_block * num_values_per_block;
 
-            if (offset + length < (i + 1) * num_values_per_block)
+            if (last_length == num_values_per_block)
             {
-                local_size = (offset + length - i * num_values_per_block) * value_size;
+                num_full_blocks++;
             }
-            if (offset > i * num_values_per_block)
+            if (num_full_blocks > 0)
             {
-                local_offset = (offset - i * num_values_per_block) * value_size;
-                local_size -= local_offset;
+                int64_t slice_offset = type->base_type->offset + (int64_t)first_block * product->record_size;
+                long slice_size = num_values_per_block * value_size;
+
+                if (read_record_slices(product, 1, &slice_offset, &slice_size, num_full_blocks, &target) != 0)
+                {
+                    return -1;
+                }
+                target += num_full_blocks * num_values_per_block * value_size;
             }
-            if (read_bytes(product->raw_product, type->base_type->offset + i * product->record_size + local_offset,
-                           local_size, &((uint8_t *)dst)[target_offset]) != 0)
+            if (last_length < num_values_per_block)
             {
-                return -1;
+                if (read_bytes(product->raw_product, type->base_type->offset +
+                               (int64_t)last_block * product->record_size, last_length * value_size, target) != 0)
+                {
+                    return -1;
+                }
             }
-            target_offset += local_size;
         }
-
     }
     else
     {
@@ -320,33 +455,7 @@ static int read_partial_array(const coda_cursor *cursor, long offset, long lengt
     }
 
 #ifndef WORDS_BIGENDIAN
-    switch (type->base_type->definition->bit_size)
-    {
-        case 8:
-            /* no endianness conversion needed */
-            break;
-        case 16:
-            for (i = 0; i < type->definition->num_elements; i++)
-            {
-                swap2(&((int16_t *)dst)[i]);
-            }
-            break;
-        case 32:
-            for (i = 0; i < type->definition->num_elements; i++)
-            {
-                swap4(&((int32_t *)dst)[i]);
-            }
-            break;
-        case 64:
-            for (i = 0; i < type->definition->num_elements; i++)
-            {
-                swap8(&((int64_t *)dst)[i]);
-            }
-            break;
-        default:
-            assert(0);
-            exit(1);
-    }
+    swap_values(dst, length, (int)type->base_type->definition->bit_size);
 #endif
 
     return 0;
@@ -527,3 +636,170 @@ int coda_netcdf_cursor_read_char_partial_array(const coda_cursor *cursor, long o
 {
     return read_partial_array(cursor, offset, length, dst);
 }
+
+/** \addtogroup coda_product
+ * @{
+ */
+
+/** Read the full content of multiple record variables of a netCDF product in a single pass.
+ * In a netCDF classic product the values of all record variables (i.e. variables that have the unlimited dimension
+ * as first dimension) are interleaved per record. Reading the record variables one by one (e.g. using
+ * coda_cursor_read_double_array()) therefore requires a pass over the full record section of the file for each
+ * variable. This function reads all requested record variables together, using a single sequential pass over the
+ * record section, which makes the extraction of all data of a product much faster.
+ * The variables are identified by their field name in the root record of the product.
+ * For each variable, \a dst should contain a pointer to a buffer that can hold all values of the variable (in C array
+ * ordering). The values will be stored using the native type of the variable (i.e. int8_t, int16_t, int32_t, float,
+ * double, or char, as given by the read type of the array base type) without applying any conversions (such as
+ * scale_factor/add_offset). This corresponds to using coda_cursor_read_<type>_array() for each variable with
+ * conversions disabled (see coda_set_option_perform_conversions()).
+ * Variables of which the values are read as strings are not supported.
+ * \param product Pointer to a product file handle of a netCDF product.
+ * \param num_variables Number of record variables to read.
+ * \param name Array with the names of the record variables.
+ * \param dst Array with, for each variable, a pointer to the buffer where the values will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_netcdf_read_record_variables(coda_product *product, int num_variables, const char **name,
+                                                  void **dst)
+{
+    coda_netcdf_product *netcdf_product;
+    coda_mem_record *root_type;
+    coda_netcdf_array **variable;
+    int64_t *offset;
+    long *slice_size;
+    long num_records = 0;
+    int i;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (product->format != coda_format_netcdf)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product is not a netcdf product (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (num_variables < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "num_variables argument is negative (%s:%u)", __FILE__,
+                       __LINE__);
+        return -1;
+    }
+    if (num_variables == 0)
+    {
+        return 0;
+    }
+    if (name == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "name argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    netcdf_product = (coda_netcdf_product *)product;
+    root_type = (coda_mem_record *)product->root_type;
+
+    variable = malloc(num_variables * sizeof(coda_netcdf_array *));
+    if (variable == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(num_variables * sizeof(coda_netcdf_array *)), __FILE__, __LINE__);
+        return -1;
+    }
+    offset = malloc(num_variables * sizeof(int64_t));
+    if (offset == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(num_variables * sizeof(int64_t)), __FILE__, __LINE__);
+        free(variable);
+        return -1;
+    }
+    slice_size = malloc(num_variables * sizeof(long));
+    if (slice_size == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(num_variables * sizeof(long)), __FILE__, __LINE__);
+        free(offset);
+        free(variable);
+        return -1;
+    }
+
+    for (i = 0; i < num_variables; i++)
+    {
+        coda_netcdf_array *type;
+        long index;
+
+        if (name[i] == NULL || dst[i] == NULL)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "name or dst entry %d is NULL (%s:%u)", i, __FILE__,
+                           __LINE__);
+            break;
+        }
+        if (coda_type_get_record_field_index_from_name((coda_type *)root_type->definition, name[i], &index) != 0)
+        {
+            break;
+        }
+        type = (coda_netcdf_array *)root_type->field_type[index];
+        if (type->definition->type_class != coda_array_class || !type->base_type->record_var)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "variable '%s' is not a record variable", name[i]);
+            break;
+        }
+        if (type->base_type->definition->read_type == coda_native_type_string)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "reading of string data is not supported for variable "
+                           "'%s'", name[i]);
+            break;
+        }
+        variable[i] = type;
+        offset[i] = type->base_type->offset;
+        /* all record variables share the same (unlimited) first dimension */
+        num_records = type->definition->dim[0];
+        if (num_records > 0)
+        {
+            slice_size[i] = (long)((type->definition->num_elements / num_records) *
+                                   (type->base_type->definition->bit_size >> 3));
+        }
+        else
+        {
+            slice_size[i] = 0;
+        }
+    }
+    if (i < num_variables)
+    {
+        free(slice_size);
+        free(offset);
+        free(variable);
+        return -1;
+    }
+
+    if (read_record_slices(netcdf_product, num_variables, offset, slice_size, num_records, (uint8_t **)dst) != 0)
+    {
+        free(slice_size);
+        free(offset);
+        free(variable);
+        return -1;
+    }
+
+#ifndef WORDS_BIGENDIAN
+    for (i = 0; i < num_variables; i++)
+    {
+        swap_values(dst[i], variable[i]->definition->num_elements, (int)variable[i]->base_type->definition->bit_size);
+    }
+#endif
+
+    free(slice_size);
+    free(offset);
+    free(variable);
+
+    return 0;
+}
+
+/** @} */
@@ -433,6 +433,11 @@ static int set_definition(coda_product **product, coda_product_definition *defin
             coda_set_error(CODA_ERROR_UNSUPPORTED_PRODUCT, NULL);
             return -1;
         }
+        if ((*product)->format == coda_format_xml)
+        {
+            /* make sure the product is fully loaded if lazy loading was used for the product recognition */
+            return coda_xml_reopen_without_definition(product);
+        }
         /* if definition == NULL we have nothing to do */
         return 0;
     }
@@ -95,6 +95,7 @@ enum
     rinex_obs_epoch_flag,
     rinex_receiver_clock_offset,
     rinex_satellite_number,
+    rinex_obs_satellite_number,
     rinex_observation,
     rinex_lli,
     rinex_signal_strength,
@@ -214,13 +215,14 @@ typedef struct satellite_info_struct
     coda_type_record *sat_obs_definition;       /* definition for /record[]/<sys>[] */
     coda_type_array *sat_obs_array_definition;  /* definition for /record[]/<sys> */
     coda_mem_array *sat_obs_array;      /* actual data for /record[]/<sys> */
+    uint8_t *sat_obs_data;      /* buffer for the packed data of a /record[]/<sys>[] element */
     /* Navigation specific */
     coda_mem_array *records;    /* actual data for /<sys> */
 } satellite_info;
 
 typedef struct ingest_info_struct
 {
-    FILE *f;
+    coda_ascii_line_scanner scanner;
     coda_product *product;
     coda_mem_record *header;    /* actual data for /header */
     satellite_info gps;
@@ -258,6 +260,10 @@ static void satellite_info_cleanup(satellite_info *info)
         }
         free(info->observable);
     }
+    if (info->sat_obs_data != NULL)
+    {
+        free(info->sat_obs_data);
+    }
     if (info->sat_obs_definition != NULL)
     {
         coda_type_release((coda_type *)info->sat_obs_definition);
@@ -278,10 +284,7 @@ static void satellite_info_cleanup(satellite_info *info)
 
 static void ingest_info_cleanup(ingest_info *info)
 {
-    if (info->f != NULL)
-    {
-        fclose(info->f);
-    }
+    coda_ascii_line_scanner_done(&info->scanner);
     if (info->header != NULL)
     {
         coda_dynamic_type_delete((coda_dynamic_type *)info->header);
@@ -323,12 +326,13 @@ static void satellite_info_init(satellite_info *info)
     info->sat_obs_definition = NULL;
     info->sat_obs_array_definition = NULL;
     info->sat_obs_array = NULL;
+    info->sat_obs_data = NULL;
     info->records = NULL;
 }
 
-static void ingest_info_init(ingest_info *info)
+static void ingest_info_init(ingest_info *info, coda_product *raw_product)
 {
-    info->f = NULL;
+    coda_ascii_line_scanner_init(&info->scanner, raw_product);
     info->header = NULL;
     satellite_info_init(&info->gps);
     satellite_info_init(&info->glonass);
@@ -628,7 +632,17 @@ static int rinex_init(void)
     coda_type_set_description(rinex_type[rinex_satellite_number],
                               "Satellite number (for the applicable satellite system)");
 
-    rinex_type[rinex_observation] = (coda_type *)coda_type_number_new(coda_format_rinex, coda_real_class);
+    /* the observation values per satellite are stored as a single packed binary record (see
+     * read_observation_record_for_satellite()), so all types within that record need to be binary types
+     */
+    rinex_type[rinex_obs_satellite_number] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
+    coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_obs_satellite_number], endianness);
+    coda_type_set_read_type(rinex_type[rinex_obs_satellite_number], coda_native_type_uint8);
+    coda_type_set_bit_size(rinex_type[rinex_obs_satellite_number], 8);
+    coda_type_set_description(rinex_type[rinex_obs_satellite_number],
+                              "Satellite number (for the applicable satellite system)");
+
+    rinex_type[rinex_observation] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_observation], endianness);
     coda_type_set_bit_size(rinex_type[rinex_observation], 64);
     coda_type_set_description(rinex_type[rinex_observation],
@@ -636,7 +650,7 @@ static int rinex_init(void)
                               "written as 0.0 or blanks. Phase values overflowing the fixed format have to be clipped "
                               "into the valid interval (e.g add or subtract 10**9), set LLI indicator.");
 
-    rinex_type[rinex_lli] = (coda_type *)coda_type_number_new(coda_format_rinex, coda_integer_class);
+    rinex_type[rinex_lli] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_lli], endianness);
     coda_type_set_read_type(rinex_type[rinex_lli], coda_native_type_uint8);
     coda_type_set_bit_size(rinex_type[rinex_lli], 8);
@@ -646,7 +660,7 @@ static int rinex_init(void)
                               "not capable of handling half cycles should skip this observation. Valid for the current "
                               "epoch only.");
 
-    rinex_type[rinex_signal_strength] = (coda_type *)coda_type_number_new(coda_format_rinex, coda_integer_class);
+    rinex_type[rinex_signal_strength] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)rinex_type[rinex_signal_strength], endianness);
     coda_type_set_read_type(rinex_type[rinex_signal_strength], coda_native_type_uint8);
     coda_type_set_bit_size(rinex_type[rinex_signal_strength], 8);
@@ -654,7 +668,7 @@ static int rinex_init(void)
                               "1: minimum possible signal strength. 5: average S/N ratio. "
                               "9: maximum possible signal strength. 0 or blank: not known, don't care");
 
-    rinex_type[rinex_observation_record] = (coda_type *)coda_type_record_new(coda_format_rinex);
+    rinex_type[rinex_observation_record] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("observation");
     coda_type_record_field_set_type(field, rinex_type[rinex_observation]);
     coda_type_record_add_field((coda_type_record *)rinex_type[rinex_observation_record], field);
@@ -1720,38 +1734,37 @@ static void rtrim(char *str)
     }
 }
 
-static int get_line(FILE *f, char *line)
+/* get the next line without copying it; the line is not zero terminated and only valid until the next call */
+static long get_line(ingest_info *info, const char **line)
 {
-    long length;
+    long linelength;
 
-    if (fgets(line, MAX_LINE_LENGTH, f) == NULL)
-    {
-        if (ferror(f))
-        {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
-            return -1;
-        }
-        /* end of file -> return empty line  */
-        line[0] = '\0';
-        return 0;
-    }
-    length = (long)strlen(line);
+    info->linenumber++;
+    linelength = coda_ascii_line_scanner_get_line(&info->scanner, line);
+    info->offset = (long)info->scanner.offset;
+
+    return linelength;
+}
 
-    /* remove 'linefeed' character if available */
-    if (length > 0 && line[length - 1] == '\n')
+/* get a zero terminated copy of the next line (line should be able to hold MAX_LINE_LENGTH characters) */
+static long get_header_line(ingest_info *info, char *line)
+{
+    const char *data;
+    long linelength;
+
+    linelength = get_line(info, &data);
+    if (linelength < 0)
     {
-        line[length - 1] = '\0';
-        length--;
+        return -1;
     }
-
-    /* remove 'carriage return' character if available */
-    if (length > 0 && line[length - 1] == '\r')
+    if (linelength > MAX_LINE_LENGTH - 1)
     {
-        line[length - 1] = '\0';
-        length--;
+        linelength = MAX_LINE_LENGTH - 1;
     }
+    memcpy(line, data, linelength);
+    line[linelength] = '\0';
 
-    return length;
+    return linelength;
 }
 
 static int read_main_header(ingest_info *info)
@@ -1760,9 +1773,7 @@ static int read_main_header(ingest_info *info)
     char line[MAX_LINE_LENGTH];
     long linelength;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1884,9 +1895,9 @@ static int handle_observation_definition(ingest_info *info, char *line)
                        "(line: %ld, byte offset: %ld)", line[0], info->linenumber, info->offset);
         return -1;
     }
-    sat_info->sat_obs_definition = coda_type_record_new(coda_format_rinex);
+    sat_info->sat_obs_definition = coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("number");
-    coda_type_record_field_set_type(field, rinex_type[rinex_satellite_number]);
+    coda_type_record_field_set_type(field, rinex_type[rinex_obs_satellite_number]);
     coda_type_record_add_field(sat_info->sat_obs_definition, field);
 
     if (coda_ascii_parse_int64(&line[3], 3, &num_types, 0) < 0)
@@ -1915,6 +1926,16 @@ static int handle_observation_definition(ingest_info *info, char *line)
     {
         sat_info->observable[i] = NULL;
     }
+    /* satellite number + (observation, lli, signal strength) per observable */
+    sat_info->sat_obs_data = malloc((size_t)(1 + num_types * 10));
+    if (sat_info->sat_obs_data == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(1 + num_types * 10), __FILE__, __LINE__);
+        coda_dynamic_type_delete((coda_dynamic_type *)sys);
+        coda_dynamic_type_delete((coda_dynamic_type *)descriptor_array);
+        return -1;
+    }
 
     for (i = 0; i < num_types; i++)
     {
@@ -1926,9 +1947,7 @@ static int handle_observation_definition(ingest_info *info, char *line)
             long expected_line_length = 6 + 13 * 4;
 
             /* read next line */
-            info->offset = ftell(info->f);
-            info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_header_line(info, line);
             if (linelength < 0)
             {
                 coda_dynamic_type_delete((coda_dynamic_type *)sys);
@@ -1993,9 +2012,7 @@ static int read_observation_header(ingest_info *info)
 
     info->sys_array = coda_mem_array_new((coda_type_array *)rinex_type[rinex_sys_array], NULL);
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -2349,9 +2366,7 @@ static int read_observation_header(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_header_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -2361,25 +2376,22 @@ static int read_observation_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "sys", (coda_dynamic_type *)info->sys_array, 0);
     info->sys_array = NULL;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
     return 0;
 }
 
 static int read_observation_record_for_satellite(ingest_info *info)
 {
     satellite_info *sat_info;
-    coda_mem_record *sat_obs;
-    coda_dynamic_type *value;
-    char line[MAX_LINE_LENGTH];
+    coda_dynamic_type *sat_obs;
+    uint8_t *data;
+    long data_length;
+    const char *line;
     long linelength;
     char str[17];
     int number;
     int i;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, &line);
     if (linelength < 0)
     {
         return -1;
@@ -2413,91 +2425,84 @@ static int read_observation_record_for_satellite(ingest_info *info)
     }
     assert(sat_info->sat_obs_definition != NULL);
 
-    if (linelength >= 3 + sat_info->num_observables * 16 - 2)
-    {
-        /* append truncated 'blank' values back again to ease processing */
-        while (linelength < 3 + sat_info->num_observables * 16)
-        {
-            line[linelength] = ' ';
-            linelength++;
-        }
-    }
-
-    if (linelength < 3 + sat_info->num_observables * 16)
+    /* the 'blank' lli and signal strength values of the last observable may have been truncated */
+    if (linelength < 3 + sat_info->num_observables * 16 - 2)
     {
         coda_set_error(CODA_ERROR_FILE_READ, "epoch line length (%ld) too short (line: %ld, byte offset: %ld)",
                        linelength, info->linenumber, info->offset);
         return -1;
     }
 
-    sat_obs = coda_mem_record_new(sat_info->sat_obs_definition, NULL);
-
+    /* all values for this satellite are stored as a single block of packed binary data instead of as separate
+     * memory nodes per value; the layout of the block is given by sat_obs_definition
+     */
     memcpy(str, &line[1], 2);
     str[2] = '\0';
     if (sscanf(str, "%2d", &number) != 1)
     {
-        coda_dynamic_type_delete((coda_dynamic_type *)sat_obs);
         coda_set_error(CODA_ERROR_FILE_READ, "invalid satellite number (line: %ld, byte offset: %ld)",
                        info->linenumber, info->offset + 1);
         return -1;
     }
-    value = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)rinex_type[rinex_satellite_number], NULL,
-                                                    info->product, (uint8_t)number);
-    coda_mem_record_add_field(sat_obs, "number", value, 0);
+    data = sat_info->sat_obs_data;
+    data[0] = (uint8_t)number;
+    data_length = 1;
 
     for (i = 0; i < sat_info->num_observables; i++)
     {
-        uint8_t lli;
-        uint8_t signal_strength;
         double observation;
-        coda_mem_record *observation_record;
+        long length = linelength - (3 + i * 16);
 
-        memcpy(str, &line[3 + i * 16], 16);
-        lli = (str[14] >= '0' && str[14] <= '9' ? str[14] - '0' : 0);
-        signal_strength = (str[15] >= '0' && str[15] <= '9' ? str[15] - '0' : 0);
-        str[14] = '\0';
-        if (sscanf(str, "%lf", &observation) != 1)
+        if (length > 16)
+        {
+            length = 16;
+        }
+        memcpy(str, &line[3 + i * 16], length);
+        if (length < 16)
+        {
+            memset(&str[length], ' ', 16 - length);
+        }
+        data[data_length + 8] = (str[14] >= '0' && str[14] <= '9' ? str[14] - '0' : 0);
+        data[data_length + 9] = (str[15] >= '0' && str[15] <= '9' ? str[15] - '0' : 0);
+        if (memcmp(str, "              ", 14) == 0)
         {
-            if (strcmp(str, "              ") != 0)
-            {
-                coda_dynamic_type_delete((coda_dynamic_type *)sat_obs);
-                coda_set_error(CODA_ERROR_FILE_READ, "invalid observation value (line: %ld, byte offset: %ld)",
-                               info->linenumber, info->offset + 3 + i * 16);
-                return -1;
-            }
             /* if we have all blanks, use a 'missing value' of 0 */
             observation = 0.0;
         }
-
-        observation_record = coda_mem_record_new((coda_type_record *)rinex_type[rinex_observation_record], NULL);
-        value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)rinex_type[rinex_observation], NULL,
-                                                         info->product, observation);
-        coda_mem_record_add_field(observation_record, "observation", value, 0);
-        value = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)rinex_type[rinex_lli], NULL, info->product,
-                                                        (uint8_t)lli);
-        coda_mem_record_add_field(observation_record, "lli", value, 0);
-        value = (coda_dynamic_type *)coda_mem_uint8_new((coda_type_number *)rinex_type[rinex_signal_strength], NULL,
-                                                        info->product, (uint8_t)signal_strength);
-        coda_mem_record_add_field(observation_record, "signal_strength", value, 0);
-        coda_mem_record_add_field(sat_obs, sat_info->observable[i], (coda_dynamic_type *)observation_record, 0);
+        else if (coda_ascii_parse_double(str, 14, &observation, 1) < 0)
+        {
+            coda_set_error(CODA_ERROR_FILE_READ, "invalid observation value (line: %ld, byte offset: %ld)",
+                           info->linenumber, info->offset + 3 + i * 16);
+            return -1;
+        }
+        memcpy(&data[data_length], &observation, sizeof(double));
+        data_length += 10;
     }
 
-    coda_mem_array_add_element(sat_info->sat_obs_array, (coda_dynamic_type *)sat_obs);
+    sat_obs = (coda_dynamic_type *)coda_mem_data_new((coda_type *)sat_info->sat_obs_definition, NULL, info->product,
+                                                     data_length, data);
+    if (sat_obs == NULL)
+    {
+        return -1;
+    }
+    if (coda_mem_array_add_element(sat_info->sat_obs_array, sat_obs) != 0)
+    {
+        coda_dynamic_type_delete(sat_obs);
+        return -1;
+    }
 
     return 0;
 }
 
 static int read_observation_records(ingest_info *info)
 {
-    char line[MAX_LINE_LENGTH];
+    const char *line;
     long linelength;
     double double_value;
     char str[61];
     int i;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, &line);
     if (linelength < 0)
     {
         return -1;
@@ -2588,9 +2593,7 @@ static int read_observation_records(ingest_info *info)
             /* we skip the remaining part of this record if epoch flag != 0 */
             for (i = 0; i < num_satellites; i++)
             {
-                info->offset = ftell(info->f);
-                info->linenumber++;
-                linelength = get_line(info->f, line);
+                linelength = get_line(info, &line);
                 if (linelength < 0)
                 {
                     return -1;
@@ -2633,9 +2636,7 @@ static int read_observation_records(ingest_info *info)
         coda_mem_array_add_element(info->records, (coda_dynamic_type *)info->epoch_record);
         info->epoch_record = NULL;
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, &line);
         if (linelength < 0)
         {
             return -1;
@@ -2660,9 +2661,7 @@ static int read_navigation_header(ingest_info *info)
     rtype = rinex_type[rinex_time_system_corr_array];
     info->time_system_corr_array = coda_mem_array_new((coda_type_array *)rtype, NULL);
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -2849,9 +2848,7 @@ static int read_navigation_header(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_header_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -2863,12 +2860,10 @@ static int read_navigation_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "time_system_corr", (coda_dynamic_type *)info->time_system_corr_array, 0);
     info->time_system_corr_array = NULL;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
     return 0;
 }
 
-static int read_navigation_record_values(ingest_info *info, char *line, int num_values, double *value)
+static int read_navigation_record_values(ingest_info *info, const char *line, int num_values, double *value)
 {
     int i;
 
@@ -2882,9 +2877,7 @@ static int read_navigation_record_values(ingest_info *info, char *line, int num_
             long linelength;
 
             /* read next line */
-            info->offset = ftell(info->f);
-            info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, &line);
             if (linelength < 0)
             {
                 return -1;
@@ -2912,13 +2905,11 @@ static int read_navigation_record_values(ingest_info *info, char *line, int num_
 
 static int read_navigation_records(ingest_info *info)
 {
-    char line[MAX_LINE_LENGTH];
+    const char *line;
     long linelength;
     char str[61];
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, &line);
     if (linelength < 0)
     {
         return -1;
@@ -2934,7 +2925,7 @@ static int read_navigation_records(ingest_info *info)
         double record_value[31];
         char satellite_system;
 
-        if (linelength < 23)
+        if (linelength < 4 + 4 * 19)
         {
             coda_set_error(CODA_ERROR_FILE_READ, "record line length (%ld) too short (line: %ld, byte offset: %ld)",
                            linelength, info->linenumber, info->offset);
@@ -3366,9 +3357,7 @@ static int read_navigation_records(ingest_info *info)
             coda_mem_array_add_element(info->sbas.records, (coda_dynamic_type *)record);
         }
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, &line);
         if (linelength < 0)
         {
             return -1;
@@ -3389,9 +3378,7 @@ static int read_clock_header(ingest_info *info)
 
     info->sys_array = coda_mem_array_new((coda_type_array *)rinex_type[rinex_sys_array], NULL);
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -3513,9 +3500,7 @@ static int read_clock_header(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_header_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -3525,21 +3510,17 @@ static int read_clock_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "sys", (coda_dynamic_type *)info->sys_array, 0);
     info->sys_array = NULL;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
     return 0;
 }
 
 static int read_clock_records(ingest_info *info)
 {
-    char line[MAX_LINE_LENGTH];
+    const char *line;
     long linelength;
     double double_value;
     char str[61];
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, &line);
     if (linelength < 0)
     {
         return -1;
@@ -3552,7 +3533,7 @@ static int read_clock_records(ingest_info *info)
         char epoch_string[28];
         int num_values;
 
-        if (linelength < 40)
+        if (linelength < 59)
         {
             coda_set_error(CODA_ERROR_FILE_READ, "record line length (%ld) too short (line: %ld, byte offset: %ld)",
                            linelength, info->linenumber, info->offset);
@@ -3623,9 +3604,7 @@ static int read_clock_records(ingest_info *info)
         if (num_values > 2)
         {
             /* read next line */
-            info->offset = ftell(info->f);
-            info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, &line);
             if (linelength < 0)
             {
                 return -1;
@@ -3685,9 +3664,7 @@ static int read_clock_records(ingest_info *info)
         coda_mem_array_add_element(info->records, (coda_dynamic_type *)info->epoch_record);
         info->epoch_record = NULL;
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, &line);
         if (linelength < 0)
         {
             return -1;
@@ -3697,7 +3674,7 @@ static int read_clock_records(ingest_info *info)
     return 0;
 }
 
-static int read_file(coda_product *product)
+static int read_file(coda_product *product, coda_product *raw_product)
 {
     coda_type_array *records_definition;
     coda_type_record_field *field;
@@ -3705,16 +3682,9 @@ static int read_file(coda_product *product)
     coda_mem_record *root_type = NULL;
     ingest_info info;
 
-    ingest_info_init(&info);
+    ingest_info_init(&info, raw_product);
     info.product = product;
 
-    info.f = fopen(product->filename, "r");
-    if (info.f == NULL)
-    {
-        coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s", product->filename);
-        return -1;
-    }
-
     if (read_main_header(&info) != 0)
     {
         ingest_info_cleanup(&info);
@@ -3896,15 +3866,15 @@ int coda_rinex_reopen(coda_product **product)
         return -1;
     }
 
-    coda_close(*product);
-
-    /* create root type */
-    if (read_file(product_file) != 0)
+    /* create root type (reading the file content via the still opened raw product) */
+    if (read_file(product_file, *product) != 0)
     {
         coda_close(product_file);
+        coda_close(*product);
         return -1;
     }
 
+    coda_close(*product);
     *product = (coda_product *)product_file;
 
     return 0;
@@ -3937,3 +3907,204 @@ int coda_rinex_cursor_set_product(coda_cursor *cursor, coda_product *product)
 
     return 0;
 }
+
+/** \addtogroup coda_product
+ * @{
+ */
+
+/** Read the values of a single satellite for all epochs of a RINEX observation product.
+ * This function retrieves, for a single satellite, a value of one observable from the /record[]/<system>[] entries of
+ * all epochs (i.e. all /record[] elements) in one call. This gives the same result as moving a cursor to the entry of
+ * the satellite in each epoch and reading the value, but is much faster.
+ * The \a path should be the path to a numeric value relative to a /record[]/<system>[] element, i.e.
+ * "<observable>/observation", "<observable>/lli", or "<observable>/signal_strength" (for instance "C1C/observation").
+ * The \a dst array should have room for as many values as there are elements in /record. For epochs where there is
+ * no entry for the satellite the value in \a dst will be set to NaN.
+ * \param product Pointer to a product file handle of a RINEX observation product.
+ * \param satellite The 3 character satellite id consisting of the satellite system and the satellite number as used
+ * in the RINEX file (e.g. "G05").
+ * \param path Path to a value relative to a /record[]/<system>[] element.
+ * \param dst Pointer to the array where the values will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_rinex_read_satellite_series(coda_product *product, const char *satellite, const char *path,
+                                                 double *dst)
+{
+    coda_mem_record *root_type;
+    coda_mem_array *records;
+    coda_type_record *definition;
+    coda_type_record_field *field = NULL;
+    const char *fieldname;
+    const char *name;
+    long system_field_index;
+    long field_index;
+    long offset;
+    long cached_index = 0;
+    long i;
+    int number;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (product->format != coda_format_rinex)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product is not a rinex product (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    root_type = (coda_mem_record *)product->root_type;
+    if (root_type->field_type[0]->definition != rinex_type[rinex_obs_header])
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product is not a rinex observation product (%s:%u)", __FILE__,
+                       __LINE__);
+        return -1;
+    }
+    if (satellite == NULL || strlen(satellite) != 3 || satellite[1] < '0' || satellite[1] > '9' ||
+        satellite[2] < '0' || satellite[2] > '9')
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "satellite argument should be a string of 3 characters "
+                       "(e.g. 'G05') (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    switch (satellite[0])
+    {
+        case 'G':
+            fieldname = "gps";
+            break;
+        case 'R':
+            fieldname = "glonass";
+            break;
+        case 'E':
+            fieldname = "galileo";
+            break;
+        case 'S':
+            fieldname = "sbas";
+            break;
+        default:
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid satellite system '%c' for satellite argument",
+                           satellite[0]);
+            return -1;
+    }
+    number = (satellite[1] - '0') * 10 + (satellite[2] - '0');
+
+    records = (coda_mem_array *)root_type->field_type[1];
+    definition = (coda_type_record *)((coda_type_array *)records->definition)->base_type;
+    if (coda_type_get_record_field_index_from_name((coda_type *)definition, fieldname, &system_field_index) != 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product does not contain observations for satellite system "
+                       "'%c'", satellite[0]);
+        return -1;
+    }
+    definition = (coda_type_record *)((coda_type_array *)definition->field[system_field_index]->type)->base_type;
+
+    /* determine the location of the value within the packed data of a /record[]/<system>[] element */
+    offset = 0;
+    name = path;
+    while (*name != '\0')
+    {
+        char component[64];
+        long length = 0;
+
+        if (field != NULL)
+        {
+            if (field->type->type_class != coda_record_class)
+            {
+                coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (value is not a record)", path);
+                return -1;
+            }
+            definition = (coda_type_record *)field->type;
+        }
+        while (name[length] != '\0' && name[length] != '/')
+        {
+            length++;
+        }
+        if (length == 0 || length >= (long)sizeof(component))
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s'", path);
+            return -1;
+        }
+        memcpy(component, name, length);
+        component[length] = '\0';
+        if (coda_type_get_record_field_index_from_name((coda_type *)definition, component, &field_index) != 0)
+        {
+            return -1;
+        }
+        field = definition->field[field_index];
+        assert(field->bit_offset >= 0);
+        offset += (long)(field->bit_offset >> 3);
+        name = &name[length];
+        if (*name == '/')
+        {
+            name++;
+        }
+    }
+    if (field == NULL || (field->type->type_class != coda_integer_class && field->type->type_class != coda_real_class))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (value is not numeric)", path);
+        return -1;
+    }
+
+    for (i = 0; i < records->num_elements; i++)
+    {
+        coda_mem_array *entries;
+        coda_mem_data *entry = NULL;
+        const uint8_t *data;
+        long j;
+
+        dst[i] = coda_NaN();
+        entries = (coda_mem_array *)((coda_mem_record *)records->element[i])->field_type[system_field_index];
+        if (entries == NULL)
+        {
+            continue;
+        }
+
+        /* satellites are normally listed in the same order in each epoch, so try the previous position first */
+        for (j = 0; j < entries->num_elements; j++)
+        {
+            coda_mem_data *element = (coda_mem_data *)entries->element[(cached_index + j) % entries->num_elements];
+
+            if (product->mem_ptr[element->offset] == number)
+            {
+                entry = element;
+                cached_index = (cached_index + j) % entries->num_elements;
+                break;
+            }
+        }
+        if (entry == NULL)
+        {
+            continue;
+        }
+
+        data = &product->mem_ptr[entry->offset + offset];
+        switch (field->type->read_type)
+        {
+            case coda_native_type_uint8:
+                dst[i] = (double)data[0];
+                break;
+            case coda_native_type_double:
+                memcpy(&dst[i], data, 8);
+                break;
+            default:
+                assert(0);
+                exit(1);
+        }
+    }
+
+    return 0;
+}
+
+/** @} */
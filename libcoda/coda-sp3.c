@@ -42,6 +42,12 @@
 
 #define MAX_LINE_LENGTH 1000
 
+/* size in bytes of the packed data of a pos_clk/vel_rate element without and with the correlation values */
+#define SP3_POS_CLK_SIZE 44
+#define SP3_POS_CLK_MAX_SIZE 78
+#define SP3_VEL_RATE_SIZE 40
+#define SP3_VEL_RATE_MAX_SIZE 72
+
 enum
 {
     sp3_pos_vel,
@@ -133,16 +139,17 @@ static THREAD_LOCAL coda_type **sp3_type = NULL;
 
 typedef struct ingest_info_struct
 {
-    FILE *f;
+    coda_ascii_line_scanner scanner;
     coda_product *product;
     coda_mem_record *header;    /* actual data for /header */
     coda_mem_array *records;    /* actual data for /record */
     coda_mem_record *record;    /* actual data for /record[] */
     coda_mem_array *pos_clk_array;      /* actual data for /record[]/pos_clk */
-    coda_mem_record *pos_clk;   /* actual data for /record[]/pos_clk[] */
+    uint8_t pos_clk_data[SP3_POS_CLK_MAX_SIZE]; /* packed data for /record[]/pos_clk[] */
+    long pos_clk_length;        /* length of pos_clk_data (0 if there is no pending pos_clk element) */
     coda_mem_array *vel_rate_array;     /* actual data for /record[]/vel_rate */
-    coda_mem_record *vel_rate;  /* actual data for /record[]/vel_rate[] */
-    coda_mem_record *corr;      /* actual data for /record[]/...[]/corr */
+    uint8_t vel_rate_data[SP3_VEL_RATE_MAX_SIZE];       /* packed data for /record[]/vel_rate[] */
+    long vel_rate_length;       /* length of vel_rate_data (0 if there is no pending vel_rate element) */
     int num_satellites;
     char posvel;
     long linenumber;
@@ -151,10 +158,7 @@ typedef struct ingest_info_struct
 
 static void ingest_info_cleanup(ingest_info *info)
 {
-    if (info->f != NULL)
-    {
-        fclose(info->f);
-    }
+    coda_ascii_line_scanner_done(&info->scanner);
     if (info->header != NULL)
     {
         coda_dynamic_type_delete((coda_dynamic_type *)info->header);
@@ -171,35 +175,22 @@ static void ingest_info_cleanup(ingest_info *info)
     {
         coda_dynamic_type_delete((coda_dynamic_type *)info->pos_clk_array);
     }
-    if (info->pos_clk != NULL)
-    {
-        coda_dynamic_type_delete((coda_dynamic_type *)info->pos_clk);
-    }
     if (info->vel_rate_array != NULL)
     {
         coda_dynamic_type_delete((coda_dynamic_type *)info->vel_rate_array);
     }
-    if (info->vel_rate != NULL)
-    {
-        coda_dynamic_type_delete((coda_dynamic_type *)info->vel_rate);
-    }
-    if (info->corr != NULL)
-    {
-        coda_dynamic_type_delete((coda_dynamic_type *)info->corr);
-    }
 }
 
-static void ingest_info_init(ingest_info *info)
+static void ingest_info_init(ingest_info *info, coda_product *raw_product)
 {
-    info->f = NULL;
+    coda_ascii_line_scanner_init(&info->scanner, raw_product);
     info->header = NULL;
     info->records = NULL;
     info->record = NULL;
     info->pos_clk_array = NULL;
-    info->pos_clk = NULL;
+    info->pos_clk_length = 0;
     info->vel_rate_array = NULL;
-    info->vel_rate = NULL;
-    info->corr = NULL;
+    info->vel_rate_length = 0;
     info->num_satellites = 0;
     info->linenumber = 0;
     info->offset = 0;
@@ -343,245 +334,245 @@ static int sp3_init(void)
     coda_type_time_set_base_type((coda_type_special *)sp3_type[sp3_epoch], sp3_type[sp3_epoch_string]);
     coda_type_set_description(sp3_type[sp3_epoch], "Epoch Start");
 
-    sp3_type[sp3_vehicle_id] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_vehicle_id] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_vehicle_id], 3);
     coda_type_set_description(sp3_type[sp3_vehicle_id], "Vehicle Id");
 
-    sp3_type[sp3_P_x_coordinate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_x_coordinate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_x_coordinate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_x_coordinate], 64);
     coda_type_set_description(sp3_type[sp3_P_x_coordinate], "x coordinate");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_x_coordinate], "km");
 
-    sp3_type[sp3_P_y_coordinate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_y_coordinate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_y_coordinate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_y_coordinate], 64);
     coda_type_set_description(sp3_type[sp3_P_y_coordinate], "y coordinate");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_y_coordinate], "km");
 
-    sp3_type[sp3_P_z_coordinate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_z_coordinate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_z_coordinate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_z_coordinate], 64);
     coda_type_set_description(sp3_type[sp3_P_z_coordinate], "z coordinate");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_z_coordinate], "km");
 
-    sp3_type[sp3_P_clock] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_P_clock] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_clock], endianness);
     coda_type_set_bit_size(sp3_type[sp3_P_clock], 64);
     coda_type_set_description(sp3_type[sp3_P_clock], "clock");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_P_clock], "1e-6 s");
 
-    sp3_type[sp3_P_x_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_x_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_x_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_x_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_P_x_sdev], 8);
     coda_type_set_description(sp3_type[sp3_P_x_sdev], "x sdev (b**n mm)");
 
-    sp3_type[sp3_P_y_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_y_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_y_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_y_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_P_y_sdev], 8);
     coda_type_set_description(sp3_type[sp3_P_y_sdev], "y sdev (b**n mm)");
 
-    sp3_type[sp3_P_z_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_z_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_z_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_z_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_P_z_sdev], 8);
     coda_type_set_description(sp3_type[sp3_P_z_sdev], "z sdev (b**n mm)");
 
-    sp3_type[sp3_P_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_P_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_P_clock_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_P_clock_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_P_clock_sdev], 16);
     coda_type_set_description(sp3_type[sp3_P_clock_sdev], "clock sdev (b**n psec)");
 
-    sp3_type[sp3_P_clock_event_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_clock_event_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_clock_event_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_clock_event_flag], "Clock Event Flag");
 
-    sp3_type[sp3_P_clock_pred_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_clock_pred_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_clock_pred_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_clock_pred_flag], "Clock Pred. Flag");
 
-    sp3_type[sp3_P_maneuver_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_maneuver_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_maneuver_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_maneuver_flag], "Maneuver Flag");
 
-    sp3_type[sp3_P_orbit_pred_flag] = (coda_type *)coda_type_text_new(coda_format_sp3);
+    sp3_type[sp3_P_orbit_pred_flag] = (coda_type *)coda_type_text_new(coda_format_binary);
     coda_type_set_byte_size(sp3_type[sp3_P_orbit_pred_flag], 1);
     coda_type_set_description(sp3_type[sp3_P_orbit_pred_flag], "Orbit Pred. Flag");
 
-    sp3_type[sp3_EP_x_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_x_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_x_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_x_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EP_x_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EP_x_sdev], "x sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_x_sdev], "mm");
 
-    sp3_type[sp3_EP_y_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_y_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_y_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_y_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EP_y_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EP_y_sdev], "y sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_y_sdev], "mm");
 
-    sp3_type[sp3_EP_z_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_z_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_z_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_z_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EP_z_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EP_z_sdev], "z sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_z_sdev], "mm");
 
-    sp3_type[sp3_EP_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_clock_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_clock_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_clock_sdev], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_clock_sdev], 32);
     coda_type_set_description(sp3_type[sp3_EP_clock_sdev], "clock sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EP_clock_sdev], "ps");
 
-    sp3_type[sp3_EP_xy_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_xy_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_xy_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_xy_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_xy_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_xy_corr], "xy correlation");
 
-    sp3_type[sp3_EP_xz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_xz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_xz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_xz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_xz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_xz_corr], "xz correlation");
 
-    sp3_type[sp3_EP_xc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_xc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_xc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_xc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_xc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_xc_corr], "xc correlation");
 
-    sp3_type[sp3_EP_yz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_yz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_yz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_yz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_yz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_yz_corr], "yz correlation");
 
-    sp3_type[sp3_EP_yc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_yc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_yc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_yc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_yc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_yc_corr], "yc correlation");
 
-    sp3_type[sp3_EP_zc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EP_zc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EP_zc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EP_zc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EP_zc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EP_zc_corr], "zc correlation");
 
-    sp3_type[sp3_V_x_velocity] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_x_velocity] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_x_velocity], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_x_velocity], 64);
     coda_type_set_description(sp3_type[sp3_V_x_velocity], "x velocity");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_x_velocity], "dm/s");
 
-    sp3_type[sp3_V_y_velocity] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_y_velocity] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_y_velocity], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_y_velocity], 64);
     coda_type_set_description(sp3_type[sp3_V_y_velocity], "y velocity");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_y_velocity], "dm/s");
 
-    sp3_type[sp3_V_z_velocity] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_z_velocity] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_z_velocity], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_z_velocity], 64);
     coda_type_set_description(sp3_type[sp3_V_z_velocity], "z velocity");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_z_velocity], "dm/s");
 
-    sp3_type[sp3_V_clock_rate] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_real_class);
+    sp3_type[sp3_V_clock_rate] = (coda_type *)coda_type_number_new(coda_format_binary, coda_real_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_clock_rate], endianness);
     coda_type_set_bit_size(sp3_type[sp3_V_clock_rate], 64);
     coda_type_set_description(sp3_type[sp3_V_clock_rate], "clock rate change");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_V_clock_rate], "1e-10 s/s");
 
-    sp3_type[sp3_V_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_xvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_xvel_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_V_xvel_sdev], 8);
     coda_type_set_description(sp3_type[sp3_V_xvel_sdev], "xvel sdev (b**n 1e-4 mm/sec)");
 
-    sp3_type[sp3_V_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_yvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_yvel_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_V_yvel_sdev], 8);
     coda_type_set_description(sp3_type[sp3_V_yvel_sdev], "yvel sdev (b**n 1e-4 mm/sec)");
 
-    sp3_type[sp3_V_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_zvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_zvel_sdev], coda_native_type_int8);
     coda_type_set_bit_size(sp3_type[sp3_V_zvel_sdev], 8);
     coda_type_set_description(sp3_type[sp3_V_zvel_sdev], "zvel sdev (b**n 1e-4 mm/sec)");
 
-    sp3_type[sp3_V_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_V_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_V_clkrate_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_V_clkrate_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_V_clkrate_sdev], 16);
     coda_type_set_description(sp3_type[sp3_V_clkrate_sdev], "clock rate sdev (b**n 1e-4 psec/sec)");
 
-    sp3_type[sp3_EV_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xvel_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_xvel_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_xvel_sdev], "xvel sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_xvel_sdev], "1e-4 mm/s)");
 
-    sp3_type[sp3_EV_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_yvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_yvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_yvel_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_yvel_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_yvel_sdev], "yvel sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_yvel_sdev], "1e-4 mm/s)");
 
-    sp3_type[sp3_EV_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_zvel_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_zvel_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_zvel_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_zvel_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_zvel_sdev], "zvel sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_zvel_sdev], "1e-4 mm/s)");
 
-    sp3_type[sp3_EV_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_clkrate_sdev] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_clkrate_sdev], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_clkrate_sdev], coda_native_type_int16);
     coda_type_set_bit_size(sp3_type[sp3_EV_clkrate_sdev], 16);
     coda_type_set_description(sp3_type[sp3_EV_clkrate_sdev], "clock rate sdev");
     coda_type_number_set_unit((coda_type_number *)sp3_type[sp3_EV_clkrate_sdev], "1e-4 ps/s");
 
-    sp3_type[sp3_EV_xy_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xy_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xy_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xy_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_xy_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_xy_corr], "xy correlation");
 
-    sp3_type[sp3_EV_xz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_xz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_xz_corr], "xz correlation");
 
-    sp3_type[sp3_EV_xc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_xc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_xc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_xc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_xc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_xc_corr], "xc correlation");
 
-    sp3_type[sp3_EV_yz_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_yz_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_yz_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_yz_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_yz_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_yz_corr], "yz correlation");
 
-    sp3_type[sp3_EV_yc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_yc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_yc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_yc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_yc_corr], 32);
     coda_type_set_description(sp3_type[sp3_EV_yc_corr], "yc correlation");
 
-    sp3_type[sp3_EV_zc_corr] = (coda_type *)coda_type_number_new(coda_format_sp3, coda_integer_class);
+    sp3_type[sp3_EV_zc_corr] = (coda_type *)coda_type_number_new(coda_format_binary, coda_integer_class);
     coda_type_number_set_endianness((coda_type_number *)sp3_type[sp3_EV_zc_corr], endianness);
     coda_type_set_read_type(sp3_type[sp3_EV_zc_corr], coda_native_type_int32);
     coda_type_set_bit_size(sp3_type[sp3_EV_zc_corr], 32);
@@ -654,7 +645,7 @@ static int sp3_init(void)
     coda_type_record_field_set_type(field, sp3_type[sp3_base_clk_rate]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_header], field);
 
-    sp3_type[sp3_P_corr] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_P_corr] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("x_sdev");
     coda_type_record_field_set_type(field, sp3_type[sp3_EP_x_sdev]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_P_corr], field);
@@ -686,7 +677,7 @@ static int sp3_init(void)
     coda_type_record_field_set_type(field, sp3_type[sp3_EP_zc_corr]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_P_corr], field);
 
-    sp3_type[sp3_pos_clk] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_pos_clk] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("vehicle_id");
     coda_type_record_field_set_type(field, sp3_type[sp3_vehicle_id]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
@@ -728,14 +719,17 @@ static int sp3_init(void)
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
     field = coda_type_record_field_new("corr");
     coda_type_record_field_set_type(field, sp3_type[sp3_P_corr]);
-    coda_type_record_field_set_optional(field);
+    /* the correlation values are only present in the packed data if an EP record was provided */
+    expr = NULL;
+    coda_expression_from_string("bytesize(.) > 44", &expr);
+    coda_type_record_field_set_available_expression(field, expr);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_pos_clk], field);
 
     sp3_type[sp3_pos_clk_array] = (coda_type *)coda_type_array_new(coda_format_sp3);
     coda_type_array_add_variable_dimension((coda_type_array *)sp3_type[sp3_pos_clk_array], NULL);
     coda_type_array_set_base_type((coda_type_array *)sp3_type[sp3_pos_clk_array], sp3_type[sp3_pos_clk]);
 
-    sp3_type[sp3_V_corr] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_V_corr] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("xvel_sdev");
     coda_type_record_field_set_type(field, sp3_type[sp3_EV_xvel_sdev]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_V_corr], field);
@@ -767,7 +761,7 @@ static int sp3_init(void)
     coda_type_record_field_set_type(field, sp3_type[sp3_EV_zc_corr]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_V_corr], field);
 
-    sp3_type[sp3_vel_rate] = (coda_type *)coda_type_record_new(coda_format_sp3);
+    sp3_type[sp3_vel_rate] = (coda_type *)coda_type_record_new(coda_format_binary);
     field = coda_type_record_field_new("vehicle_id");
     coda_type_record_field_set_type(field, sp3_type[sp3_vehicle_id]);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
@@ -797,7 +791,10 @@ static int sp3_init(void)
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
     field = coda_type_record_field_new("corr");
     coda_type_record_field_set_type(field, sp3_type[sp3_V_corr]);
-    coda_type_record_field_set_optional(field);
+    /* the correlation values are only present in the packed data if an EV record was provided */
+    expr = NULL;
+    coda_expression_from_string("bytesize(.) > 40", &expr);
+    coda_type_record_field_set_available_expression(field, expr);
     coda_type_record_add_field((coda_type_record *)sp3_type[sp3_vel_rate], field);
 
     sp3_type[sp3_vel_rate_array] = (coda_type *)coda_type_array_new(coda_format_sp3);
@@ -851,38 +848,37 @@ void coda_sp3_done(void)
     sp3_type = NULL;
 }
 
-static int get_line(FILE *f, char *line)
+/* get the next line without copying it; the line is not zero terminated and only valid until the next call */
+static long get_line(ingest_info *info, const char **line)
 {
-    long length;
+    long linelength;
 
-    if (fgets(line, MAX_LINE_LENGTH, f) == NULL)
-    {
-        if (ferror(f))
-        {
-            coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
-            return -1;
-        }
-        /* end of file -> return empty line  */
-        line[0] = '\0';
-        return 0;
-    }
-    length = (long)strlen(line);
+    info->linenumber++;
+    linelength = coda_ascii_line_scanner_get_line(&info->scanner, line);
+    info->offset = (long)info->scanner.offset;
+
+    return linelength;
+}
+
+/* get a zero terminated copy of the next line (line should be able to hold MAX_LINE_LENGTH characters) */
+static long get_header_line(ingest_info *info, char *line)
+{
+    const char *data;
+    long linelength;
 
-    /* remove 'linefeed' character if available */
-    if (length > 0 && line[length - 1] == '\n')
+    linelength = get_line(info, &data);
+    if (linelength < 0)
     {
-        line[length - 1] = '\0';
-        length--;
+        return -1;
     }
-
-    /* remove 'carriage return' character if available */
-    if (length > 0 && line[length - 1] == '\r')
+    if (linelength > MAX_LINE_LENGTH - 1)
     {
-        line[length - 1] = '\0';
-        length--;
+        linelength = MAX_LINE_LENGTH - 1;
     }
+    memcpy(line, data, linelength);
+    line[linelength] = '\0';
 
-    return length;
+    return linelength;
 }
 
 static int read_header(ingest_info *info)
@@ -898,9 +894,7 @@ static int read_header(ingest_info *info)
     int i;
 
     /* First Line */
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -958,9 +952,7 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "agency", value, 0);
 
     /* Line Two */
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1024,9 +1016,7 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "frac_day", value, 0);
 
     /* Line Three to Seven */
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1060,9 +1050,7 @@ static int read_header(ingest_info *info)
         if (i % 17 == 0 && i > 0)
         {
             /* read next line */
-            info->offset = ftell(info->f);
-            info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_header_line(info, line);
             if (linelength < 0)
             {
                 coda_dynamic_type_delete(array);
@@ -1101,9 +1089,7 @@ static int read_header(ingest_info *info)
         if (i % 17 == 0)
         {
             /* read next line */
-            info->offset = ftell(info->f);
-            info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_header_line(info, line);
             if (linelength < 0)
             {
                 coda_dynamic_type_delete(array);
@@ -1140,9 +1126,7 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "sat_accuracy", array, 0);
 
     /* Line Thirteen */
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1173,9 +1157,7 @@ static int read_header(ingest_info *info)
     coda_mem_record_add_field(info->header, "time_system", value, 0);
 
     /* Line Fourteen */
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1194,9 +1176,7 @@ static int read_header(ingest_info *info)
     }
 
     /* Line Fifteen */
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_header_line(info, line);
     if (linelength < 0)
     {
         return -1;
@@ -1235,9 +1215,7 @@ static int read_header(ingest_info *info)
     /* Line Sixteen to Twenty two */
     for (i = 0; i < 7; i++)
     {
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_header_line(info, line);
         if (linelength < 0)
         {
             return -1;
@@ -1247,24 +1225,73 @@ static int read_header(ingest_info *info)
     return 0;
 }
 
+/* the pos_clk and vel_rate elements are stored as blocks of packed binary data (using native byte order) that are
+ * described by the binary sp3_pos_clk and sp3_vel_rate record definitions
+ */
+static void pack_int8(uint8_t *data, long *length, int8_t value)
+{
+    data[*length] = (uint8_t)value;
+    *length += 1;
+}
+
+static void pack_int16(uint8_t *data, long *length, int16_t value)
+{
+    memcpy(&data[*length], &value, 2);
+    *length += 2;
+}
+
+static void pack_int32(uint8_t *data, long *length, int32_t value)
+{
+    memcpy(&data[*length], &value, 4);
+    *length += 4;
+}
+
+static void pack_double(uint8_t *data, long *length, double value)
+{
+    memcpy(&data[*length], &value, 8);
+    *length += 8;
+}
+
+static void pack_text(uint8_t *data, long *length, const char *str, long str_length)
+{
+    memcpy(&data[*length], str, str_length);
+    *length += str_length;
+}
+
+static int add_packed_element(ingest_info *info, coda_mem_array *array, const uint8_t *data, long length)
+{
+    coda_dynamic_type *element;
+
+    element = (coda_dynamic_type *)coda_mem_data_new(array->definition->base_type, NULL, info->product, length, data);
+    if (element == NULL)
+    {
+        return -1;
+    }
+    if (coda_mem_array_add_element(array, element) != 0)
+    {
+        coda_dynamic_type_delete(element);
+        return -1;
+    }
+
+    return 0;
+}
+
 static int read_records(ingest_info *info)
 {
     coda_dynamic_type *base_type;
     coda_dynamic_type *value;
-    char line[MAX_LINE_LENGTH];
+    const char *line;
     double double_value;
     int64_t int_value;
     char str[61];
     long linelength;
 
-    info->offset = ftell(info->f);
-    info->linenumber++;
-    linelength = get_line(info->f, line);
+    linelength = get_line(info, &line);
     if (linelength < 0)
     {
         return -1;
     }
-    while (memcmp(line, "EOF", 3) != 0)
+    while (linelength < 3 || memcmp(line, "EOF", 3) != 0)
     {
         if (line[0] == '*')
         {
@@ -1307,7 +1334,7 @@ static int read_records(ingest_info *info)
                                "(line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                 return -1;
             }
-            info->pos_clk = coda_mem_record_new((coda_type_record *)sp3_type[sp3_pos_clk], NULL);
+            info->pos_clk_length = 0;
 
             if (linelength < 60)
             {
@@ -1318,45 +1345,35 @@ static int read_records(ingest_info *info)
 
             memcpy(str, &line[1], 3);
             str[3] = '\0';
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_vehicle_id], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "vehicle_id", value, 0);
+            pack_text(info->pos_clk_data, &info->pos_clk_length, str, 3);
 
             if (coda_ascii_parse_double(&line[4], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_x_coordinate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "x_coordinate", value, 0);
+            pack_double(info->pos_clk_data, &info->pos_clk_length, double_value);
 
             if (coda_ascii_parse_double(&line[18], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 18);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_y_coordinate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "y_coordinate", value, 0);
+            pack_double(info->pos_clk_data, &info->pos_clk_length, double_value);
 
             if (coda_ascii_parse_double(&line[32], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 32);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_z_coordinate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "z_coordinate", value, 0);
+            pack_double(info->pos_clk_data, &info->pos_clk_length, double_value);
 
             if (coda_ascii_parse_double(&line[46], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 46);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_P_clock], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->pos_clk, "clock", value, 0);
+            pack_double(info->pos_clk_data, &info->pos_clk_length, double_value);
 
             if (linelength < 64 || memcmp(&line[61], "  ", 2) == 0)
             {
@@ -1367,9 +1384,7 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 61);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_P_x_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "x_sdev", value, 0);
+            pack_int8(info->pos_clk_data, &info->pos_clk_length, int_value);
 
             if (linelength < 66 || memcmp(&line[64], "  ", 2) == 0)
             {
@@ -1380,9 +1395,7 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 64);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_P_y_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "y_sdev", value, 0);
+            pack_int8(info->pos_clk_data, &info->pos_clk_length, int_value);
 
             if (linelength < 69 || memcmp(&line[67], "  ", 2) == 0)
             {
@@ -1393,9 +1406,7 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 67);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_P_z_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "z_sdev", value, 0);
+            pack_int8(info->pos_clk_data, &info->pos_clk_length, int_value);
 
             if (linelength < 73 || memcmp(&line[70], "   ", 3) == 0)
             {
@@ -1406,30 +1417,21 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 70);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_P_clock_sdev], NULL,
-                                                            info->product, (int16_t)int_value);
-            coda_mem_record_add_field(info->pos_clk, "clock_sdev", value, 0);
+            pack_int16(info->pos_clk_data, &info->pos_clk_length, int_value);
 
             str[0] = linelength < 75 ? ' ' : line[74];
             str[1] = '\0';
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_clock_event_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "clock_event_flag", value, 0);
+            pack_text(info->pos_clk_data, &info->pos_clk_length, str, 1);
 
             str[0] = linelength < 76 ? ' ' : line[75];
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_clock_pred_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "clock_pred_flag", value, 0);
+            pack_text(info->pos_clk_data, &info->pos_clk_length, str, 1);
 
             str[0] = linelength < 79 ? ' ' : line[78];
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_maneuver_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "maneuver_flag", value, 0);
+            pack_text(info->pos_clk_data, &info->pos_clk_length, str, 1);
 
             str[0] = linelength < 80 ? ' ' : line[79];
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_P_orbit_pred_flag], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->pos_clk, "orbit_pred_flag", value, 0);
+            pack_text(info->pos_clk_data, &info->pos_clk_length, str, 1);
+            assert(info->pos_clk_length == SP3_POS_CLK_SIZE);
         }
         else if (line[0] == 'V')
         {
@@ -1445,7 +1447,7 @@ static int read_records(ingest_info *info)
                                "(line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                 return -1;
             }
-            info->vel_rate = coda_mem_record_new((coda_type_record *)sp3_type[sp3_vel_rate], NULL);
+            info->vel_rate_length = 0;
 
             if (linelength < 60)
             {
@@ -1456,45 +1458,35 @@ static int read_records(ingest_info *info)
 
             memcpy(str, &line[1], 3);
             str[3] = '\0';
-            value = (coda_dynamic_type *)coda_mem_string_new((coda_type_text *)sp3_type[sp3_vehicle_id], NULL,
-                                                             info->product, str);
-            coda_mem_record_add_field(info->vel_rate, "vehicle_id", value, 0);
+            pack_text(info->vel_rate_data, &info->vel_rate_length, str, 3);
 
             if (coda_ascii_parse_double(&line[4], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_x_velocity], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "x_velocity", value, 0);
+            pack_double(info->vel_rate_data, &info->vel_rate_length, double_value);
 
             if (coda_ascii_parse_double(&line[18], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 18);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_y_velocity], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "y_velocity", value, 0);
+            pack_double(info->vel_rate_data, &info->vel_rate_length, double_value);
 
             if (coda_ascii_parse_double(&line[32], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 32);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_z_velocity], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "z_velocity", value, 0);
+            pack_double(info->vel_rate_data, &info->vel_rate_length, double_value);
 
             if (coda_ascii_parse_double(&line[46], 14, &double_value, 0) < 0)
             {
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 46);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_double_new((coda_type_number *)sp3_type[sp3_V_clock_rate], NULL,
-                                                             info->product, double_value);
-            coda_mem_record_add_field(info->vel_rate, "clock_rate", value, 0);
+            pack_double(info->vel_rate_data, &info->vel_rate_length, double_value);
 
             if (linelength < 63 || memcmp(&line[61], "  ", 2) == 0)
             {
@@ -1505,9 +1497,7 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 61);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_V_xvel_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "xvel_sdev", value, 0);
+            pack_int8(info->vel_rate_data, &info->vel_rate_length, int_value);
 
             if (linelength < 66 || memcmp(&line[64], "  ", 2) == 0)
             {
@@ -1518,9 +1508,7 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 64);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_V_yvel_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "yvel_sdev", value, 0);
+            pack_int8(info->vel_rate_data, &info->vel_rate_length, int_value);
 
             if (linelength < 69 || memcmp(&line[67], "  ", 2) == 0)
             {
@@ -1531,9 +1519,7 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 67);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int8_new((coda_type_number *)sp3_type[sp3_V_zvel_sdev], NULL,
-                                                           info->product, (int8_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "zvel_sdev", value, 0);
+            pack_int8(info->vel_rate_data, &info->vel_rate_length, int_value);
 
             if (linelength < 73 || memcmp(&line[70], "   ", 3) == 0)
             {
@@ -1544,9 +1530,8 @@ static int read_records(ingest_info *info)
                 coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 70);
                 return -1;
             }
-            value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_V_clkrate_sdev], NULL,
-                                                            info->product, (int16_t)int_value);
-            coda_mem_record_add_field(info->vel_rate, "clkrate_sdev", value, 0);
+            pack_int16(info->vel_rate_data, &info->vel_rate_length, int_value);
+            assert(info->vel_rate_length == SP3_VEL_RATE_SIZE);
         }
         else
         {
@@ -1555,26 +1540,23 @@ static int read_records(ingest_info *info)
             return -1;
         }
 
-        info->offset = ftell(info->f);
-        info->linenumber++;
-        linelength = get_line(info->f, line);
+        linelength = get_line(info, &line);
         if (linelength < 0)
         {
             return -1;
         }
 
-        if (line[0] == 'E' && (line[1] == 'P' || line[1] == 'V'))
+        if (linelength >= 2 && line[0] == 'E' && (line[1] == 'P' || line[1] == 'V'))
         {
             if (line[1] == 'P')
             {
-                if (info->pos_clk == NULL)
+                if (info->pos_clk_length != SP3_POS_CLK_SIZE)
                 {
                     coda_set_error(CODA_ERROR_FILE_READ, "Position and Clock Correlation Record without Position and "
                                    "Clock Record (line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                     return -1;
                 }
-                info->corr = coda_mem_record_new((coda_type_record *)sp3_type[sp3_P_corr], NULL);
-
+                /* the correlation values are appended to the packed data of the pos_clk element */
                 if (linelength < 8 || memcmp(&line[4], "    ", 4) == 0)
                 {
                     int_value = 0;
@@ -1584,9 +1566,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EP_x_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "x_sdev", value, 0);
+                pack_int16(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 13 || memcmp(&line[9], "    ", 4) == 0)
                 {
@@ -1597,9 +1577,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 9);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EP_y_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "y_sdev", value, 0);
+                pack_int16(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 18 || memcmp(&line[14], "    ", 4) == 0)
                 {
@@ -1610,9 +1588,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 14);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EP_z_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "z_sdev", value, 0);
+                pack_int16(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 26 || memcmp(&line[19], "       ", 7) == 0)
                 {
@@ -1623,9 +1599,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 19);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_clock_sdev], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "clock_sdev", value, 0);
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 35 || memcmp(&line[27], "        ", 8) == 0)
                 {
@@ -1636,9 +1610,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 27);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_xy_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xy_corr", value, 0);
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 44 || memcmp(&line[36], "        ", 8) == 0)
                 {
@@ -1649,9 +1621,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 36);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_xz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xz_corr", value, 0);
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 53 || memcmp(&line[45], "        ", 8) == 0)
                 {
@@ -1662,9 +1632,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 45);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_xc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xc_corr", value, 0);
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 62 || memcmp(&line[54], "        ", 8) == 0)
                 {
@@ -1675,9 +1643,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 54);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_yz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yz_corr", value, 0);
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 71 || memcmp(&line[63], "        ", 8) == 0)
                 {
@@ -1688,9 +1654,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 63);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_yc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yc_corr", value, 0);
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
 
                 if (linelength < 80 || memcmp(&line[72], "        ", 8) == 0)
                 {
@@ -1701,23 +1665,17 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 72);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EP_zc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "zc_corr", value, 0);
-
-                coda_mem_record_add_field(info->pos_clk, "corr", (coda_dynamic_type *)info->corr, 0);
-                info->corr = NULL;
+                pack_int32(info->pos_clk_data, &info->pos_clk_length, int_value);
             }
             else
             {
-                if (info->vel_rate == NULL)
+                if (info->vel_rate_length != SP3_VEL_RATE_SIZE)
                 {
                     coda_set_error(CODA_ERROR_FILE_READ, "Velocity and Rate Correlation Record without Velocity and "
                                    "Rate Record (line: %ld, byte offset: %ld)", info->linenumber, info->offset);
                     return -1;
                 }
-                info->corr = coda_mem_record_new((coda_type_record *)sp3_type[sp3_V_corr], NULL);
-
+                /* the correlation values are appended to the packed data of the vel_rate element */
                 if (linelength < 8 || memcmp(&line[4], "    ", 4) == 0)
                 {
                     int_value = 0;
@@ -1727,9 +1685,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 4);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_xvel_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "xvel_sdev", value, 0);
+                pack_int16(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 13 || memcmp(&line[9], "    ", 4) == 0)
                 {
@@ -1740,9 +1696,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 9);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_yvel_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "yvel_sdev", value, 0);
+                pack_int16(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 18 || memcmp(&line[14], "    ", 4) == 0)
                 {
@@ -1753,9 +1707,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 14);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_zvel_sdev], NULL,
-                                                                info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "zvel_sdev", value, 0);
+                pack_int16(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 28 || memcmp(&line[19], "       ", 7) == 0)
                 {
@@ -1766,9 +1718,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 19);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int16_new((coda_type_number *)sp3_type[sp3_EV_clkrate_sdev],
-                                                                NULL, info->product, (int16_t)int_value);
-                coda_mem_record_add_field(info->corr, "clkrate_sdev", value, 0);
+                pack_int16(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 35 || memcmp(&line[27], "        ", 8) == 0)
                 {
@@ -1779,9 +1729,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 27);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_xy_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xy_corr", value, 0);
+                pack_int32(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 44 || memcmp(&line[36], "        ", 8) == 0)
                 {
@@ -1792,9 +1740,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 36);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_xz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xz_corr", value, 0);
+                pack_int32(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 53 || memcmp(&line[45], "        ", 8) == 0)
                 {
@@ -1805,9 +1751,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 45);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_xc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "xc_corr", value, 0);
+                pack_int32(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 62 || memcmp(&line[54], "        ", 8) == 0)
                 {
@@ -1818,9 +1762,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 54);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_yz_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yz_corr", value, 0);
+                pack_int32(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 71 || memcmp(&line[63], "        ", 8) == 0)
                 {
@@ -1831,9 +1773,7 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 63);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_yc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "yc_corr", value, 0);
+                pack_int32(info->vel_rate_data, &info->vel_rate_length, int_value);
 
                 if (linelength < 80 || memcmp(&line[72], "        ", 8) == 0)
                 {
@@ -1844,31 +1784,30 @@ static int read_records(ingest_info *info)
                     coda_add_error_message(" (line: %ld, byte offset: %ld)", info->linenumber, info->offset + 72);
                     return -1;
                 }
-                value = (coda_dynamic_type *)coda_mem_int32_new((coda_type_number *)sp3_type[sp3_EV_zc_corr], NULL,
-                                                                info->product, (int32_t)int_value);
-                coda_mem_record_add_field(info->corr, "zc_corr", value, 0);
-
-                coda_mem_record_add_field(info->vel_rate, "corr", (coda_dynamic_type *)info->corr, 0);
-                info->corr = NULL;
+                pack_int32(info->vel_rate_data, &info->vel_rate_length, int_value);
             }
-            info->offset = ftell(info->f);
-            info->linenumber++;
-            linelength = get_line(info->f, line);
+            linelength = get_line(info, &line);
             if (linelength < 0)
             {
                 return -1;
             }
         }
 
-        if (info->pos_clk != NULL)
+        if (info->pos_clk_length > 0)
         {
-            coda_mem_array_add_element(info->pos_clk_array, (coda_dynamic_type *)info->pos_clk);
-            info->pos_clk = NULL;
+            if (add_packed_element(info, info->pos_clk_array, info->pos_clk_data, info->pos_clk_length) != 0)
+            {
+                return -1;
+            }
+            info->pos_clk_length = 0;
         }
-        if (info->vel_rate != NULL)
+        if (info->vel_rate_length > 0)
         {
-            coda_mem_array_add_element(info->vel_rate_array, (coda_dynamic_type *)info->vel_rate);
-            info->vel_rate = NULL;
+            if (add_packed_element(info, info->vel_rate_array, info->vel_rate_data, info->vel_rate_length) != 0)
+            {
+                return -1;
+            }
+            info->vel_rate_length = 0;
         }
     }
 
@@ -1885,21 +1824,14 @@ static int read_records(ingest_info *info)
     return 0;
 }
 
-static int read_file(coda_product *product)
+static int read_file(coda_product *product, coda_product *raw_product)
 {
     coda_mem_record *root_type = NULL;
     ingest_info info;
 
-    ingest_info_init(&info);
+    ingest_info_init(&info, raw_product);
     info.product = product;
 
-    info.f = fopen(product->filename, "r");
-    if (info.f == NULL)
-    {
-        coda_set_error(CODA_ERROR_FILE_OPEN, "could not open file %s", product->filename);
-        return -1;
-    }
-
     info.header = coda_mem_record_new((coda_type_record *)sp3_type[sp3_header], NULL);
     info.records = coda_mem_array_new((coda_type_array *)sp3_type[sp3_records], NULL);
 
@@ -1967,15 +1899,15 @@ int coda_sp3_reopen(coda_product **product)
         return -1;
     }
 
-    coda_close(*product);
-
-    /* create root type */
-    if (read_file(product_file) != 0)
+    /* create root type (reading the file content via the still opened raw product) */
+    if (read_file(product_file, *product) != 0)
     {
         coda_close(product_file);
+        coda_close(*product);
         return -1;
     }
 
+    coda_close(*product);
     *product = (coda_product *)product_file;
 
     return 0;
@@ -2011,3 +1943,175 @@ int coda_sp3_cursor_set_product(coda_cursor *cursor, coda_product *product)
 
     return 0;
 }
+
+/** \addtogroup coda_product
+ * @{
+ */
+
+/** Read the values of a single satellite for all epochs of an SP3 product.
+ * This function retrieves, for a single satellite, a value from the /record[]/pos_clk[] or /record[]/vel_rate[]
+ * entries of all epochs (i.e. all /record[] elements) in one call. This gives the same result as moving a cursor to
+ * the entry of the satellite in each epoch and reading the value, but is much faster.
+ * The \a path should be the path to a numeric value relative to a /record[] element, i.e. "pos_clk/<field>",
+ * "vel_rate/<field>", "pos_clk/corr/<field>", or "vel_rate/corr/<field>" (for instance "pos_clk/x_coordinate").
+ * The \a dst array should have room for as many values as there are elements in /record. For epochs where there is
+ * no entry for the satellite (or where the entry has no correlation values in case of a 'corr' value) the value in
+ * \a dst will be set to NaN.
+ * \param product Pointer to a product file handle of an SP3 product.
+ * \param vehicle_id The 3 character satellite vehicle id as used in the SP3 file (e.g. "G01").
+ * \param path Path to a value relative to a /record[] element.
+ * \param dst Pointer to the array where the values will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_sp3_read_satellite_series(coda_product *product, const char *vehicle_id, const char *path,
+                                               double *dst)
+{
+    coda_mem_array *records;
+    coda_type_record *definition;
+    coda_type_record_field *field;
+    coda_native_type read_type;
+    const char *name;
+    long record_field_index;
+    long field_index;
+    long offset;
+    long cached_index = 0;
+    long i;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (product->format != coda_format_sp3)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product is not an sp3 product (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (vehicle_id == NULL || strlen(vehicle_id) != 3)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "vehicle_id argument should be a string of 3 characters (%s:%u)",
+                       __FILE__, __LINE__);
+        return -1;
+    }
+    if (path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (dst == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "dst argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    /* determine the location of the value within the packed data of a pos_clk/vel_rate element */
+    if (strncmp(path, "pos_clk/", 8) == 0)
+    {
+        definition = (coda_type_record *)sp3_type[sp3_pos_clk];
+        name = &path[8];
+    }
+    else if (strncmp(path, "vel_rate/", 9) == 0)
+    {
+        definition = (coda_type_record *)sp3_type[sp3_vel_rate];
+        name = &path[9];
+    }
+    else
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (should start with 'pos_clk/' or "
+                       "'vel_rate/')", path);
+        return -1;
+    }
+    record_field_index = (definition == (coda_type_record *)sp3_type[sp3_pos_clk] ? 1 : 2);
+    offset = 0;
+    if (strncmp(name, "corr/", 5) == 0)
+    {
+        field = definition->field[definition->num_fields - 1];
+        assert(field->bit_offset >= 0);
+        offset = (long)(field->bit_offset >> 3);
+        definition = (coda_type_record *)field->type;
+        name = &name[5];
+    }
+    if (coda_type_get_record_field_index_from_name((coda_type *)definition, name, &field_index) != 0)
+    {
+        return -1;
+    }
+    field = definition->field[field_index];
+    if (field->type->type_class != coda_integer_class && field->type->type_class != coda_real_class)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "invalid path '%s' (value is not numeric)", path);
+        return -1;
+    }
+    assert(field->bit_offset >= 0);
+    offset += (long)(field->bit_offset >> 3);
+    read_type = field->type->read_type;
+
+    records = (coda_mem_array *)((coda_mem_record *)product->root_type)->field_type[1];
+    for (i = 0; i < records->num_elements; i++)
+    {
+        coda_mem_array *entries;
+        coda_mem_data *entry = NULL;
+        const uint8_t *data;
+        long j;
+
+        dst[i] = coda_NaN();
+        entries = (coda_mem_array *)((coda_mem_record *)records->element[i])->field_type[record_field_index];
+        if (entries == NULL)
+        {
+            continue;
+        }
+
+        /* satellites are normally listed in the same order in each epoch, so try the previous position first */
+        for (j = 0; j < entries->num_elements; j++)
+        {
+            coda_mem_data *element = (coda_mem_data *)entries->element[(cached_index + j) % entries->num_elements];
+
+            if (memcmp(&product->mem_ptr[element->offset], vehicle_id, 3) == 0)
+            {
+                entry = element;
+                cached_index = (cached_index + j) % entries->num_elements;
+                break;
+            }
+        }
+        if (entry == NULL || offset >= entry->length)
+        {
+            /* no entry for this satellite or no correlation values for this entry */
+            continue;
+        }
+
+        data = &product->mem_ptr[entry->offset + offset];
+        switch (read_type)
+        {
+            case coda_native_type_int8:
+                dst[i] = (double)(int8_t)data[0];
+                break;
+            case coda_native_type_int16:
+                {
+                    int16_t value;
+
+                    memcpy(&value, data, 2);
+                    dst[i] = (double)value;
+                }
+                break;
+            case coda_native_type_int32:
+                {
+                    int32_t value;
+
+                    memcpy(&value, data, 4);
+                    dst[i] = (double)value;
+                }
+                break;
+            case coda_native_type_double:
+                memcpy(&dst[i], data, 8);
+                break;
+            default:
+                assert(0);
+                exit(1);
+        }
+    }
+
+    return 0;
+}
+
+/** @} */
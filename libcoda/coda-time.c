@@ -35,6 +35,7 @@
 #include <sys/stat.h>
 #include <assert.h>
 #include <ctype.h>
+#include <limits.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -120,6 +121,7 @@
 
 static THREAD_LOCAL int num_leap_seconds = 0;
 static THREAD_LOCAL double *leap_second_table = NULL;
+static THREAD_LOCAL int leap_second_cache_index = 0;
 
 int coda_month_to_integer(const char month[3])
 {
@@ -702,6 +704,72 @@ static int read_leap_second_table(char *filename)
     return 0;
 }
 
+/* Returns the number of leap seconds that were inserted before the given amount of TAI seconds since 2000-01-01
+ * (i.e. the number of table entries that are smaller than 'seconds').
+ * If 'seconds' falls inside a leap second then is_leap_sec will be set to 1.
+ * Consecutive lookups are usually for nearby time values, so we first check the interval of the previous lookup and
+ * only do a binary search on the (sorted) leap second table if that does not match.
+ */
+static int get_leap_seconds_for_tai(double seconds, int *is_leap_sec)
+{
+    int index = leap_second_cache_index;
+
+    assert(leap_second_table != NULL && num_leap_seconds > 0);
+    if (index > num_leap_seconds || (index > 0 && seconds <= leap_second_table[index - 1]) ||
+        (index < num_leap_seconds && seconds > leap_second_table[index]))
+    {
+        int low = 0;
+        int high = num_leap_seconds;
+
+        while (low < high)
+        {
+            int middle = (low + high) / 2;
+
+            if (seconds > leap_second_table[middle])
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        index = low;
+        leap_second_cache_index = index;
+    }
+    *is_leap_sec = index < num_leap_seconds && fabs(seconds - leap_second_table[index]) < 0.1;
+
+    return index;
+}
+
+/* Returns the number of leap seconds that were inserted before the start of the UTC day that starts at
+ * 't - 10' seconds since 2000-01-01 (with 't' the start of the day including the fixed 10 second TAI offset).
+ * Since the leap second entries are at least a second apart, 'leap_second_table[i] - i' is increasing and we can use
+ * a binary search.
+ */
+static int get_leap_seconds_for_utc_day(double t)
+{
+    int low = 0;
+    int high = num_leap_seconds;
+
+    assert(leap_second_table != NULL && num_leap_seconds > 0);
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+
+        if (t >= leap_second_table[middle] - middle)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
 void coda_leap_second_table_done(void)
 {
     if (leap_second_table != NULL)
@@ -710,6 +778,7 @@ void coda_leap_second_table_done(void)
         leap_second_table = NULL;
     }
     num_leap_seconds = 0;
+    leap_second_cache_index = 0;
 }
 
 int coda_leap_second_table_init(void)
@@ -758,35 +827,23 @@ int coda_leap_second_table_init(void)
     return 0;
 }
 
-/** Retrieve the decomposed date corresponding with the given amount of seconds since Jan 1st 2000.
- * \warning This function does _not_ perform any leap second correction. The returned value is just a straightforward
- * conversion using 86400 seconds per day.
- * \param datetime The amount of seconds since Jan 1st 2000.
- * \param year     Pointer to the variable where the year will be stored.
- * \param month    Pointer to the variable where the month of the year (1 - 12) will be stored.
- * \param day      Pointer to the variable where the day of the month (1 - 31) will be stored.
- * \param hour     Pointer to the variable where the hour of the day (0 - 23) will be stored.
- * \param minute   Pointer to the variable where the minute of the hour (0 - 59) will be stored.
- * \param second   Pointer to the variable where the second of the minute (0 - 59) will be stored.
- * \param musec    Pointer to the variable where the microseconds of the second (0 - 999999) will be stored.
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
- */
-LIBCODA_API int coda_time_double_to_parts(double datetime, int *year, int *month, int *day, int *hour, int *minute,
-                                          int *second, int *musec)
+/* Caches the day/month/year of the last converted day, since time values in an array will usually share days */
+typedef struct date_cache_struct
+{
+    int days;
+    int day;
+    int month;
+    int year;
+} date_cache;
+
+static int double_to_parts(double datetime, int utc, date_cache *cache, int *year, int *month, int *day, int *hour,
+                           int *minute, int *second, int *musec)
 {
     double seconds;
     int d, m, y;
     int h, min, s, us;
     int days, dayseconds;
-
-    if (year == NULL || month == NULL || day == NULL || hour == NULL || minute == NULL || second == NULL ||
-        musec == NULL)
-    {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "date/time argument(s) are NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
-    }
+    int is_leap_sec = 0;
 
     if (coda_isNaN(datetime))
     {
@@ -804,11 +861,36 @@ LIBCODA_API int coda_time_double_to_parts(double datetime, int *year, int *month
 
     seconds = floor(datetime);
 
+    if (utc)
+    {
+        int leap_sec;
+
+        leap_sec = get_leap_seconds_for_tai(seconds, &is_leap_sec);
+        seconds -= 10 + leap_sec + is_leap_sec;
+        datetime -= 10 + leap_sec + is_leap_sec;
+    }
+
     days = (int)floor(seconds / 86400.0);
 
-    if (mjd2000_to_dmy(days, &d, &m, &y) != 0)
+    if (cache != NULL && cache->days == days)
     {
-        return -1;
+        d = cache->day;
+        m = cache->month;
+        y = cache->year;
+    }
+    else
+    {
+        if (mjd2000_to_dmy(days, &d, &m, &y) != 0)
+        {
+            return -1;
+        }
+        if (cache != NULL)
+        {
+            cache->days = days;
+            cache->day = d;
+            cache->month = m;
+            cache->year = y;
+        }
     }
 
     dayseconds = (int)(seconds - days * 86400.0);
@@ -825,11 +907,38 @@ LIBCODA_API int coda_time_double_to_parts(double datetime, int *year, int *month
     *day = d;
     *hour = h;
     *minute = min;
-    *second = s;
+    *second = s + is_leap_sec;
     *musec = us;
 
     return 0;
+}
+
+/** Retrieve the decomposed date corresponding with the given amount of seconds since Jan 1st 2000.
+ * \warning This function does _not_ perform any leap second correction. The returned value is just a straightforward
+ * conversion using 86400 seconds per day.
+ * \param datetime The amount of seconds since Jan 1st 2000.
+ * \param year     Pointer to the variable where the year will be stored.
+ * \param month    Pointer to the variable where the month of the year (1 - 12) will be stored.
+ * \param day      Pointer to the variable where the day of the month (1 - 31) will be stored.
+ * \param hour     Pointer to the variable where the hour of the day (0 - 23) will be stored.
+ * \param minute   Pointer to the variable where the minute of the hour (0 - 59) will be stored.
+ * \param second   Pointer to the variable where the second of the minute (0 - 59) will be stored.
+ * \param musec    Pointer to the variable where the microseconds of the second (0 - 999999) will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_double_to_parts(double datetime, int *year, int *month, int *day, int *hour, int *minute,
+                                          int *second, int *musec)
+{
+    if (year == NULL || month == NULL || day == NULL || hour == NULL || minute == NULL || second == NULL ||
+        musec == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "date/time argument(s) are NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
 
+    return double_to_parts(datetime, 0, NULL, year, month, day, hour, minute, second, musec);
 }
 
 /** Retrieve the decomposed UTC date corresponding with the given amount of TAI seconds since Jan 1st 2000.
@@ -861,13 +970,6 @@ LIBCODA_API int coda_time_double_to_parts(double datetime, int *year, int *month
 LIBCODA_API int coda_time_double_to_parts_utc(double datetime, int *year, int *month, int *day, int *hour, int *minute,
                                               int *second, int *musec)
 {
-    double seconds;
-    int d, m, y;
-    int h, min, s, us;
-    int days, dayseconds;
-    int leap_sec;
-    int is_leap_sec;
-
     if (year == NULL || month == NULL || day == NULL || hour == NULL || minute == NULL || second == NULL ||
         musec == NULL)
     {
@@ -875,57 +977,7 @@ LIBCODA_API int coda_time_double_to_parts_utc(double datetime, int *year, int *m
         return -1;
     }
 
-    if (coda_isNaN(datetime))
-    {
-        coda_set_error(CODA_ERROR_INVALID_DATETIME, "datetime argument is NaN");
-        return -1;
-    }
-    if (coda_isInf(datetime))
-    {
-        coda_set_error(CODA_ERROR_INVALID_DATETIME, "datetime argument is Infinite");
-        return -1;
-    }
-
-    /* we add 0.5 milliseconds so the floor() becomes a round() that rounds at the millisecond */
-    datetime += 5E-7;
-
-    seconds = floor(datetime);
-
-    assert(leap_second_table != NULL && num_leap_seconds > 0);
-    leap_sec = 0;
-    while (leap_sec < num_leap_seconds && seconds > leap_second_table[leap_sec])
-    {
-        leap_sec++;
-    }
-    is_leap_sec = fabs(seconds - leap_second_table[leap_sec]) < 0.1;
-    seconds -= 10 + leap_sec + is_leap_sec;
-    datetime -= 10 + leap_sec + is_leap_sec;
-
-    days = (int)floor(seconds / 86400.0);
-
-    if (mjd2000_to_dmy(days, &d, &m, &y) != 0)
-    {
-        return -1;
-    }
-
-    dayseconds = (int)(seconds - days * 86400.0);
-
-    if (seconds_to_hms(dayseconds, &h, &min, &s) != 0)
-    {
-        return -1;
-    }
-
-    us = (int)floor((datetime - seconds) * 1E6);
-
-    *year = y;
-    *month = m;
-    *day = d;
-    *hour = h;
-    *minute = min;
-    *second = s + is_leap_sec;
-    *musec = us;
-
-    return 0;
+    return double_to_parts(datetime, 1, NULL, year, month, day, hour, minute, second, musec);
 }
 
 /** Retrieve the number of seconds since Jan 1st 2000 for a certain date and time.
@@ -1001,7 +1053,6 @@ LIBCODA_API int coda_time_parts_to_double_utc(int year, int month, int day, int
     double daytime;
     double t;
     int mjd2000;
-    int leap_sec;
 
     if (datetime == NULL)
     {
@@ -1020,63 +1071,126 @@ LIBCODA_API int coda_time_parts_to_double_utc(int year, int month, int day, int
     }
 
     t = 86400.0 * mjd2000 + 10;
-
-    assert(leap_second_table != NULL && num_leap_seconds > 0);
-    leap_sec = 0;
-    while (leap_sec < num_leap_seconds && t >= leap_second_table[leap_sec])
-    {
-        t++;
-        leap_sec++;
-    }
+    t += get_leap_seconds_for_utc_day(t);
 
     *datetime = t + daytime;
 
     return 0;
 }
 
-/** Create a string representation for a specific data and time.
- * The string will be formatted using the format that is provided as first parameter.
- * The time string will be stored in the \a str parameter. This parameter should be allocated by the user
- * and should be long enough to hold the formatted time string and a 0 termination character.
- *
- * The specification for the time format parameter is the same as the
- * <a href="../codadef/codadef-expressions.html#timeformat">date/time format patterns in coda expressions</a>.
- *
- * \warning This function does not perform any leap second correction.
- * \param year     The year.
- * \param month    The month of the year (1 - 12).
- * \param day      The day of the month (1 - 31).
- * \param hour     The hour of the day (0 - 23).
- * \param minute   The minute of the hour (0 - 59).
- * \param second   The second of the minute (0 - 60).
- * \param musec    The microseconds of the second (0 - 999999).
- * \param format    Date/time format to use for the string representation of the datetime value.
- * \param str       String representation of the given date and time.
- * \return
- *   \arg \c 0, Success.
- *   \arg \c -1, Error occurred (check #coda_errno).
- */
-LIBCODA_API int coda_time_parts_to_string(int year, int month, int day, int hour, int minute, int second, int musec,
-                                          const char *format, char *str)
+#define TIME_FORMAT_CACHE_SIZE 4
+
+typedef enum time_format_element_type_enum
 {
-    const char *month_name[] = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
-    int literal = 0;
-    int fi = 0;
-    int si = 0;
+    tf_literal,
+    tf_year,
+    tf_month,
+    tf_month_name,
+    tf_day,
+    tf_day_of_year,
+    tf_hour,
+    tf_minute,
+    tf_second,
+    tf_fraction
+} time_format_element_type;
+
+typedef struct time_format_element_struct
+{
+    time_format_element_type type;
+    int length; /* number of characters in the time string */
+    int use_leading_spaces;
+    const char *literal;        /* only for tf_literal; points into the 'literals' buffer of the time format */
+} time_format_element;
 
-    if (format == NULL)
+typedef struct time_format_pattern_struct
+{
+    const char *format; /* points into the full format string (only used for error messages) */
+    int num_elements;
+    time_format_element *element;
+    long length;        /* length of a formatted time string */
+} time_format_pattern;
+
+struct coda_time_format_struct
+{
+    char *format;
+    char *literals;
+    int num_patterns;
+    time_format_pattern *pattern;
+};
+
+/* compiled versions of the most recently used format strings of the string based time functions */
+static THREAD_LOCAL coda_time_format *time_format_cache[TIME_FORMAT_CACHE_SIZE];
+static THREAD_LOCAL int time_format_cache_index = 0;
+
+static const char *month_name[] = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
+
+static void write_integer(char *str, int value, int num_digits, int use_leading_spaces)
+{
+    int i;
+
+    for (i = num_digits - 1; i >= 0; i--)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "format argument is NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
+        str[i] = '0' + value % 10;
+        value /= 10;
     }
-    if (str == NULL)
+    if (use_leading_spaces)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "str argument is NULL (%s:%u)", __FILE__, __LINE__);
-        return -1;
+        for (i = 0; i < num_digits - 1 && str[i] == '0'; i++)
+        {
+            str[i] = ' ';
+        }
+    }
+}
+
+static int add_time_format_element(time_format_pattern *pattern, time_format_element_type type, int length,
+                                   int use_leading_spaces, const char *literal)
+{
+    time_format_element *element;
+
+    if (pattern->num_elements % BLOCK_SIZE == 0)
+    {
+        time_format_element *new_element;
+
+        new_element = realloc(pattern->element, (pattern->num_elements + BLOCK_SIZE) * sizeof(time_format_element));
+        if (new_element == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (pattern->num_elements + BLOCK_SIZE) * sizeof(time_format_element), __FILE__, __LINE__);
+            return -1;
+        }
+        pattern->element = new_element;
     }
+    element = &pattern->element[pattern->num_elements];
+    element->type = type;
+    element->length = length;
+    element->use_leading_spaces = use_leading_spaces;
+    element->literal = literal;
+    pattern->num_elements++;
+    pattern->length += length;
+
+    return 0;
+}
+
+/* compile a single pattern; returns the index of the terminating '|' or '\0' in *end */
+static int compile_time_format_pattern(coda_time_format *time_format, int offset, char **literals, int *end)
+{
+    const char *format = time_format->format;
+    time_format_pattern *pattern = &time_format->pattern[time_format->num_patterns];
+    time_format_element *last_element;
+    int literal = 0;
+    int fi = offset;
+
+    pattern->format = &format[offset];
+    pattern->num_elements = 0;
+    pattern->element = NULL;
+    pattern->length = 0;
+    time_format->num_patterns++;
 
     while (format[fi] != '\0' && (literal || format[fi] != '|'))
     {
+        time_format_element_type type = tf_literal;
+        int length = 0;
+
         if (format[fi] == '\'')
         {
             fi++;
@@ -1086,365 +1200,662 @@ LIBCODA_API int coda_time_parts_to_string(int year, int month, int day, int hour
                 continue;
             }
         }
-        if (literal)
+        if (!literal)
         {
-            str[si] = format[fi];
-            fi++;
-            si++;
-        }
-        else if (format[fi] == 'y' && format[fi + 1] == 'y' && format[fi + 2] == 'y' && format[fi + 3] == 'y')
-        {
-            if (year < 0 || year > 9999)
+            if (format[fi] == 'y' && format[fi + 1] == 'y' && format[fi + 2] == 'y' && format[fi + 3] == 'y')
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the year can not be represented using a positive four "
-                               "digit number");
-                return -1;
+                type = tf_year;
+                length = 4;
             }
-            sprintf(&str[si], "%04d", year);
-            fi += 4;
-            si += 4;
-        }
-        else if (format[fi] == 'M' && format[fi + 1] == 'M')
-        {
-            if (month < 1 || month > 12)
+            else if (format[fi] == 'M' && format[fi + 1] == 'M')
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the month value is not within range (1 - 12)");
-                return -1;
+                type = (format[fi + 2] == 'M' ? tf_month_name : tf_month);
+                length = (format[fi + 2] == 'M' ? 3 : 2);
             }
-            if (format[fi + 2] == 'M')
+            else if (format[fi] == 'd' && format[fi + 1] == 'd')
             {
-                sprintf(&str[si], "%s", month_name[month]);
-                fi += 3;
-                si += 3;
+                type = tf_day;
+                length = 2;
             }
-            else
+            else if (format[fi] == 'D' && format[fi + 1] == 'D' && format[fi + 2] == 'D')
             {
-                sprintf(&str[si], "%02d", month);
-                fi += 2;
-                si += 2;
+                type = tf_day_of_year;
+                length = 3;
             }
-        }
-        else if (format[fi] == 'd' && format[fi + 1] == 'd')
-        {
-            if (day < 1 || day > 31)
+            else if (format[fi] == 'H' && format[fi + 1] == 'H')
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the day value is not within range (1 - 31)");
-                return -1;
+                type = tf_hour;
+                length = 2;
             }
-            sprintf(&str[si], "%02d", day);
-            fi += 2;
-            si += 2;
-        }
-        else if (format[fi] == 'D' && format[fi + 1] == 'D' && format[fi + 2] == 'D')
-        {
-            int mjd, mjd_offset;
-
-            if (dmy_to_mjd2000(day, month, year, &mjd) != 0)
+            else if (format[fi] == 'm' && format[fi + 1] == 'm')
             {
-                return -1;
+                type = tf_minute;
+                length = 2;
             }
-            if (dmy_to_mjd2000(1, 1, year, &mjd_offset) != 0)
+            else if (format[fi] == 's' && format[fi + 1] == 's')
             {
-                return -1;
+                type = tf_second;
+                length = 2;
             }
-            sprintf(&str[si], "%03d", mjd - mjd_offset + 1);
-            fi += 3;
-            si += 3;
-        }
-        else if (format[fi] == 'H' && format[fi + 1] == 'H')
-        {
-            if (hour < 0 || hour > 23)
+            else if (format[fi] == 'S')
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the hour value is not within range (0 - 23)");
-                return -1;
+                type = tf_fraction;
+                while (format[fi + length] == 'S')
+                {
+                    length++;
+                }
             }
-            sprintf(&str[si], "%02d", hour);
-            fi += 2;
-            si += 2;
-        }
-        else if (format[fi] == 'm' && format[fi + 1] == 'm')
-        {
-            if (minute < 0 || minute > 59)
+            else if ((format[fi] >= 'A' && format[fi] <= 'Z') || (format[fi] >= 'a' && format[fi] <= 'z') ||
+                     format[fi] == '*')
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the minute value is not within range (0 - 59)");
+                /* reserved character */
+                coda_set_error(CODA_ERROR_INVALID_FORMAT, "unsupported character sequence in date/time format (%s)",
+                               format);
                 return -1;
             }
-            sprintf(&str[si], "%02d", minute);
-            fi += 2;
-            si += 2;
         }
-        else if (format[fi] == 's' && format[fi + 1] == 's')
+        if (type == tf_literal)
         {
-            if (second < 0 || second > 60)
+            /* consecutive literal characters are combined into a single element */
+            last_element = (pattern->num_elements > 0 ? &pattern->element[pattern->num_elements - 1] : NULL);
+            if (last_element != NULL && last_element->type == tf_literal &&
+                last_element->literal + last_element->length == *literals)
+            {
+                last_element->length++;
+                pattern->length++;
+            }
+            else if (add_time_format_element(pattern, tf_literal, 1, 0, *literals) != 0)
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the second value is not within range (0 - 60)");
                 return -1;
             }
-            sprintf(&str[si], "%02d", second);
-            fi += 2;
-            si += 2;
+            **literals = format[fi];
+            (*literals)++;
+            fi++;
+            continue;
         }
-        else if (format[fi] == 'S')
+        fi += length;
+        if (format[fi] == '*' && type != tf_month_name && type != tf_fraction)
         {
-            int fraction = musec;
-            int n = 0;
-            int i;
-
-            if (musec < 0 || musec > 999999)
+            if (add_time_format_element(pattern, type, length, 1, NULL) != 0)
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "the microsecond value is not within range (0 - 999999)");
                 return -1;
             }
-            while (format[fi] == 'S')
-            {
-                fi++;
-                n++;
-            }
-            for (i = n; i < 6; i++)
-            {
-                fraction /= 10;
-            }
-            sprintf(&str[si], "%0*d", n, fraction);
-            si += n;
+            fi++;
         }
-        else if ((format[fi] >= 'A' && format[fi] <= 'Z') || (format[fi] >= 'a' && format[fi] <= 'z'))
+        else if (add_time_format_element(pattern, type, length, 0, NULL) != 0)
         {
-            /* reserved character */
-            coda_set_error(CODA_ERROR_INVALID_FORMAT, "unsuppored character sequence in date/time format (%s)", format);
             return -1;
         }
-        else
-        {
-            str[si] = format[fi];
-            fi++;
-            si++;
-        }
     }
     if (literal)
     {
         coda_set_error(CODA_ERROR_INVALID_FORMAT, "missing closing ' in date/time format (%s)", format);
         return -1;
     }
+    *end = fi;
 
     return 0;
 }
 
-static int string_to_parts(const char *format, const char *str, int *year, int *month, int *day, int *hour,
-                           int *minute, int *second, int *musec)
+/** Compile a date/time format.
+ * Parsing or formatting time strings using a compiled time format is faster than using the functions that take the
+ * format as a string (such as coda_time_string_to_double()), since the format only needs to be interpreted once.
+ * This makes it the preferred approach when many time values need to be converted using the same format.
+ *
+ * The specification for the time format parameter is the same as the
+ * <a href="../codadef/codadef-expressions.html#timeformat">date/time format patterns in coda expressions</a>.
+ * The format can be a '|' separated list of formats. When parsing, these formats will be tried in sequence until one
+ * succeeds. When formatting, only the first format will be used.
+ *
+ * The compiled format should be deleted with coda_time_format_delete() when it is no longer needed.
+ * \param format String containing the datetime format(s).
+ * \param time_format Pointer to the variable where the compiled time format will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_compile(const char *format, coda_time_format **time_format)
 {
-    int use_leading_spaces;
-    int format_index = 0;
-    int string_index = 0;
+    coda_time_format *new_time_format;
+    char *literals;
+    int num_patterns = 1;
     int literal = 0;
+    int offset = 0;
     int n;
 
-    /* initialize with epoch 2000-01-01T00:00:00.000000 */
-    *year = 2000;
-    *month = 1;
-    *day = 1;
-    *hour = 0;
-    *minute = 0;
-    *second = 0;
-    *musec = 0;
+    if (format == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "format argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (time_format == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "time_format argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
 
-    while (format[format_index] != '\0' && (literal || format[format_index] != '|'))
+    for (n = 0; format[n] != '\0'; n++)
     {
-        if (format[format_index] == '\'')
-        {
-            format_index++;
-            if (format[format_index] != '\'')
-            {
-                literal = !literal;
-                continue;
-            }
-        }
-        if (literal)
-        {
-            /* literal match */
-            if (format[format_index] != str[string_index])
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect fixed character "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index++;
-            string_index++;
-        }
-        else if (format[format_index] == 'y' && format[format_index + 1] == 'y' && format[format_index + 2] == 'y' &&
-                 format[format_index + 3] == 'y')
-        {
-            use_leading_spaces = format[format_index + 4] == '*';
-            if (parse_integer(&str[string_index], 4, use_leading_spaces, year) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect year value "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index += 4 + (format[format_index] == '*');
-            string_index += 4;
-        }
-        else if (format[format_index] == 'M' && format[format_index + 1] == 'M')
+        if (format[n] == '\'')
         {
-            if (format[format_index + 2] == 'M')
-            {
-                /* coda_month_to_integer already limits comparison to only 3 characters */
-                *month = coda_month_to_integer(&str[string_index]);
-                if (*month == -1)
-                {
-                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect month value "
-                                   "(format: %s)", str, format);
-                    return -1;
-                }
-                format_index += 3;
-                string_index += 3;
-            }
-            else
-            {
-                use_leading_spaces = format[format_index + 2] == '*';
-                if (parse_integer(&str[string_index], 2, use_leading_spaces, month) != 0)
-                {
-                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect month value "
-                                   "(format: %s)", str, format);
-                    return -1;
-                }
-                format_index += 2 + (format[format_index + 2] == '*');
-                string_index += 2;
-            }
+            literal = !literal;
         }
-        else if (format[format_index] == 'd' && format[format_index + 1] == 'd')
+        else if (format[n] == '|' && !literal)
         {
-            use_leading_spaces = format[format_index + 2] == '*';
-            if (parse_integer(&str[string_index], 2, use_leading_spaces, day) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect day value "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index += 2 + (format[format_index + 2] == '*');
-            string_index += 2;
+            num_patterns++;
         }
-        else if (format[format_index] == 'D' && format[format_index + 1] == 'D' && format[format_index + 2] == 'D')
-        {
-            int day_of_year;
+    }
 
-            use_leading_spaces = format[format_index + 3] == '*';
-            /* uses currently parsed year value to determine the actual month/day within the year */
-            if (parse_integer(&str[string_index], 3, use_leading_spaces, &day_of_year) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect day value "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            if (coda_dayofyear_to_month_day(*year, day_of_year, month, day) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an invalid day value "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index += 3 + (format[format_index + 3] == '*');
-            string_index += 3;
-        }
-        else if (format[format_index] == 'H' && format[format_index + 1] == 'H')
-        {
-            use_leading_spaces = format[format_index + 2] == '*';
-            if (parse_integer(&str[string_index], 2, use_leading_spaces, hour) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect hour value "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index += 2 + (format[format_index + 2] == '*');
-            string_index += 2;
-        }
-        else if (format[format_index] == 'm' && format[format_index + 1] == 'm')
+    new_time_format = malloc(sizeof(coda_time_format));
+    if (new_time_format == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)sizeof(coda_time_format), __FILE__, __LINE__);
+        return -1;
+    }
+    new_time_format->format = NULL;
+    new_time_format->literals = NULL;
+    new_time_format->num_patterns = 0;
+    new_time_format->pattern = NULL;
+
+    new_time_format->format = strdup(format);
+    if (new_time_format->format == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate string) (%s:%u)", __FILE__,
+                       __LINE__);
+        coda_time_format_delete(new_time_format);
+        return -1;
+    }
+    new_time_format->literals = malloc(n + 1);
+    if (new_time_format->literals == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(n + 1), __FILE__, __LINE__);
+        coda_time_format_delete(new_time_format);
+        return -1;
+    }
+    new_time_format->pattern = malloc(num_patterns * sizeof(time_format_pattern));
+    if (new_time_format->pattern == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)(num_patterns * sizeof(time_format_pattern)), __FILE__, __LINE__);
+        coda_time_format_delete(new_time_format);
+        return -1;
+    }
+
+    literals = new_time_format->literals;
+    while (new_time_format->num_patterns < num_patterns)
+    {
+        if (compile_time_format_pattern(new_time_format, offset, &literals, &n) != 0)
         {
-            use_leading_spaces = format[format_index + 2] == '*';
-            if (parse_integer(&str[string_index], 2, use_leading_spaces, minute) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect minute value "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index += 2 + (format[format_index + 2] == '*');
-            string_index += 2;
+            coda_time_format_delete(new_time_format);
+            return -1;
         }
-        else if (format[format_index] == 's' && format[format_index + 1] == 's')
+        offset = n + 1;
+    }
+
+    *time_format = new_time_format;
+
+    return 0;
+}
+
+/** Delete a compiled time format.
+ * \param time_format The compiled time format that should be deleted.
+ */
+LIBCODA_API void coda_time_format_delete(coda_time_format *time_format)
+{
+    int i;
+
+    if (time_format == NULL)
+    {
+        return;
+    }
+    if (time_format->pattern != NULL)
+    {
+        for (i = 0; i < time_format->num_patterns; i++)
         {
-            use_leading_spaces = format[format_index + 2] == '*';
-            if (parse_integer(&str[string_index], 2, use_leading_spaces, second) != 0)
+            if (time_format->pattern[i].element != NULL)
             {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect second value "
-                               "(format: %s)", str, format);
-                return -1;
+                free(time_format->pattern[i].element);
             }
-            format_index += 2 + (format[format_index + 2] == '*');
-            string_index += 2;
         }
-        else if (format[format_index] == 'S')
+        free(time_format->pattern);
+    }
+    if (time_format->literals != NULL)
+    {
+        free(time_format->literals);
+    }
+    if (time_format->format != NULL)
+    {
+        free(time_format->format);
+    }
+    free(time_format);
+}
+
+/** Retrieve the length of time strings that are created with a compiled time format.
+ * The length does not include the terminating zero character.
+ * \param time_format A compiled time format.
+ * \param length Pointer to the variable where the string length will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_get_string_length(const coda_time_format *time_format, long *length)
+{
+    if (time_format == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "time_format argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (length == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "length argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    *length = time_format->pattern[0].length;
+
+    return 0;
+}
+
+/* retrieve a compiled version of a format string from the cache (compiling it if needed) */
+static int get_cached_time_format(const char *format, const coda_time_format **time_format)
+{
+    int i;
+
+    if (format == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "format argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < TIME_FORMAT_CACHE_SIZE; i++)
+    {
+        if (time_format_cache[i] != NULL && strcmp(time_format_cache[i]->format, format) == 0)
         {
-            n = 0;
-            while (format[format_index] == 'S')
-            {
-                format_index++;
-                n++;
-            }
-            if (parse_integer(&str[string_index], n > 6 ? 6 : n, 0, musec) != 0)
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect fractional "
-                               "second value (format: %s)", str, format);
-                return -1;
-            }
-            string_index += n;
-            while (n < 6)
-            {
-                *musec *= 10;
-                n++;
-            }
+            *time_format = time_format_cache[i];
+            return 0;
         }
-        else if ((format[format_index] >= 'A' && format[format_index] <= 'Z') ||
-                 (format[format_index] >= 'a' && format[format_index] <= 'z') || format[format_index] == '*')
+    }
+    i = time_format_cache_index;
+    if (time_format_cache[i] != NULL)
+    {
+        coda_time_format_delete(time_format_cache[i]);
+        time_format_cache[i] = NULL;
+    }
+    if (coda_time_format_compile(format, &time_format_cache[i]) != 0)
+    {
+        return -1;
+    }
+    time_format_cache_index = (i + 1) % TIME_FORMAT_CACHE_SIZE;
+    *time_format = time_format_cache[i];
+
+    return 0;
+}
+
+void coda_time_format_cache_done(void)
+{
+    int i;
+
+    for (i = 0; i < TIME_FORMAT_CACHE_SIZE; i++)
+    {
+        if (time_format_cache[i] != NULL)
         {
-            /* reserved character */
-            coda_set_error(CODA_ERROR_INVALID_FORMAT, "unsuppored character sequence in date/time format (%s)", format);
-            return -1;
+            coda_time_format_delete(time_format_cache[i]);
+            time_format_cache[i] = NULL;
         }
-        else
+    }
+    time_format_cache_index = 0;
+}
+
+/** Create a string representation for a specific date and time using a compiled time format.
+ * The time string will be stored in the \a str parameter. This parameter should be allocated by the user
+ * and should be long enough to hold the formatted time string and a 0 termination character (see
+ * coda_time_format_get_string_length()).
+ *
+ * If the time format consists of multiple '|' separated formats, only the first format will be used.
+ *
+ * \warning This function does not perform any leap second correction.
+ * \param time_format A compiled time format.
+ * \param year     The year.
+ * \param month    The month of the year (1 - 12).
+ * \param day      The day of the month (1 - 31).
+ * \param hour     The hour of the day (0 - 23).
+ * \param minute   The minute of the hour (0 - 59).
+ * \param second   The second of the minute (0 - 60).
+ * \param musec    The microseconds of the second (0 - 999999).
+ * \param str      String representation of the given date and time.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_parts_to_string(const coda_time_format *time_format, int year, int month, int day,
+                                                 int hour, int minute, int second, int musec, char *str)
+{
+    const time_format_pattern *pattern;
+    int si = 0;
+    int i;
+
+    if (time_format == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "time_format argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (str == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "str argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    pattern = &time_format->pattern[0];
+    for (i = 0; i < pattern->num_elements; i++)
+    {
+        const time_format_element *element = &pattern->element[i];
+
+        switch (element->type)
         {
-            /* literal match */
-            if (format[format_index] != str[string_index])
-            {
-                coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect fixed character "
-                               "(format: %s)", str, format);
-                return -1;
-            }
-            format_index++;
-            string_index++;
+            case tf_literal:
+                memcpy(&str[si], element->literal, element->length);
+                break;
+            case tf_year:
+                if (year < 0 || year > 9999)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "the year can not be represented using a positive "
+                                   "four digit number");
+                    return -1;
+                }
+                write_integer(&str[si], year, 4, element->use_leading_spaces);
+                break;
+            case tf_month:
+            case tf_month_name:
+                if (month < 1 || month > 12)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "the month value is not within range (1 - 12)");
+                    return -1;
+                }
+                if (element->type == tf_month_name)
+                {
+                    memcpy(&str[si], month_name[month - 1], 3);
+                }
+                else
+                {
+                    write_integer(&str[si], month, 2, element->use_leading_spaces);
+                }
+                break;
+            case tf_day:
+                if (day < 1 || day > 31)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "the day value is not within range (1 - 31)");
+                    return -1;
+                }
+                write_integer(&str[si], day, 2, element->use_leading_spaces);
+                break;
+            case tf_day_of_year:
+                {
+                    int mjd, mjd_offset;
+
+                    if (dmy_to_mjd2000(day, month, year, &mjd) != 0)
+                    {
+                        return -1;
+                    }
+                    if (dmy_to_mjd2000(1, 1, year, &mjd_offset) != 0)
+                    {
+                        return -1;
+                    }
+                    write_integer(&str[si], mjd - mjd_offset + 1, 3, element->use_leading_spaces);
+                }
+                break;
+            case tf_hour:
+                if (hour < 0 || hour > 23)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "the hour value is not within range (0 - 23)");
+                    return -1;
+                }
+                write_integer(&str[si], hour, 2, element->use_leading_spaces);
+                break;
+            case tf_minute:
+                if (minute < 0 || minute > 59)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "the minute value is not within range (0 - 59)");
+                    return -1;
+                }
+                write_integer(&str[si], minute, 2, element->use_leading_spaces);
+                break;
+            case tf_second:
+                if (second < 0 || second > 60)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "the second value is not within range (0 - 60)");
+                    return -1;
+                }
+                write_integer(&str[si], second, 2, element->use_leading_spaces);
+                break;
+            case tf_fraction:
+                {
+                    int fraction = musec;
+                    int n;
+
+                    if (musec < 0 || musec > 999999)
+                    {
+                        coda_set_error(CODA_ERROR_INVALID_DATETIME, "the microsecond value is not within range "
+                                       "(0 - 999999)");
+                        return -1;
+                    }
+                    for (n = element->length; n < 6; n++)
+                    {
+                        fraction /= 10;
+                    }
+                    if (element->length > 6)
+                    {
+                        /* digits beyond microsecond resolution are always zero */
+                        write_integer(&str[si], fraction, 6, 0);
+                        memset(&str[si + 6], '0', element->length - 6);
+                    }
+                    else
+                    {
+                        write_integer(&str[si], fraction, element->length, 0);
+                    }
+                }
+                break;
         }
+        si += element->length;
     }
-    if (literal)
+    str[si] = '\0';
+
+    return 0;
+}
+
+/** Create a string representation for a specific data and time.
+ * The string will be formatted using the format that is provided as first parameter.
+ * The time string will be stored in the \a str parameter. This parameter should be allocated by the user
+ * and should be long enough to hold the formatted time string and a 0 termination character.
+ *
+ * The specification for the time format parameter is the same as the
+ * <a href="../codadef/codadef-expressions.html#timeformat">date/time format patterns in coda expressions</a>.
+ *
+ * \warning This function does not perform any leap second correction.
+ * \param year     The year.
+ * \param month    The month of the year (1 - 12).
+ * \param day      The day of the month (1 - 31).
+ * \param hour     The hour of the day (0 - 23).
+ * \param minute   The minute of the hour (0 - 59).
+ * \param second   The second of the minute (0 - 60).
+ * \param musec    The microseconds of the second (0 - 999999).
+ * \param format    Date/time format to use for the string representation of the datetime value.
+ * \param str       String representation of the given date and time.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_parts_to_string(int year, int month, int day, int hour, int minute, int second, int musec,
+                                          const char *format, char *str)
+{
+    const coda_time_format *time_format;
+
+    if (get_cached_time_format(format, &time_format) != 0)
     {
-        coda_set_error(CODA_ERROR_INVALID_FORMAT, "missing closing ' in date/time format (%s)", format);
         return -1;
     }
+    return coda_time_format_parts_to_string(time_format, year, month, day, hour, minute, second, musec, str);
+}
+
+static int pattern_string_to_parts(const time_format_pattern *pattern, const char *str, int *year, int *month,
+                                   int *day, int *hour, int *minute, int *second, int *musec)
+{
+    int string_index = 0;
+    int i;
+
+    /* initialize with epoch 2000-01-01T00:00:00.000000 */
+    *year = 2000;
+    *month = 1;
+    *day = 1;
+    *hour = 0;
+    *minute = 0;
+    *second = 0;
+    *musec = 0;
+
+    for (i = 0; i < pattern->num_elements; i++)
+    {
+        const time_format_element *element = &pattern->element[i];
+        int day_of_year;
+        int n;
+        int j;
+
+        switch (element->type)
+        {
+            case tf_literal:
+                if (strncmp(&str[string_index], element->literal, element->length) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect fixed "
+                                   "character (format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_year:
+                if (parse_integer(&str[string_index], 4, element->use_leading_spaces, year) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect year value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_month:
+                if (parse_integer(&str[string_index], 2, element->use_leading_spaces, month) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect month value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_month_name:
+                if (str[string_index] == '\0' || str[string_index + 1] == '\0')
+                {
+                    *month = -1;
+                }
+                else
+                {
+                    /* coda_month_to_integer already limits comparison to only 3 characters */
+                    *month = coda_month_to_integer(&str[string_index]);
+                }
+                if (*month == -1)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect month value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_day:
+                if (parse_integer(&str[string_index], 2, element->use_leading_spaces, day) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect day value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_day_of_year:
+                /* uses currently parsed year value to determine the actual month/day within the year */
+                if (parse_integer(&str[string_index], 3, element->use_leading_spaces, &day_of_year) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect day value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                if (coda_dayofyear_to_month_day(*year, day_of_year, month, day) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an invalid day value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_hour:
+                if (parse_integer(&str[string_index], 2, element->use_leading_spaces, hour) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect hour value "
+                                   "(format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_minute:
+                if (parse_integer(&str[string_index], 2, element->use_leading_spaces, minute) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect minute "
+                                   "value (format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_second:
+                if (parse_integer(&str[string_index], 2, element->use_leading_spaces, second) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect second "
+                                   "value (format: %s)", str, pattern->format);
+                    return -1;
+                }
+                break;
+            case tf_fraction:
+                n = element->length;
+                if (parse_integer(&str[string_index], n > 6 ? 6 : n, 0, musec) != 0)
+                {
+                    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect fractional "
+                                   "second value (format: %s)", str, pattern->format);
+                    return -1;
+                }
+                /* any characters beyond the 6th digit are ignored (e.g. RINEX clock epochs pad the 7th digit with a
+                 * space); we only make sure that we do not skip past the terminating zero of a string that is too
+                 * short */
+                for (j = 6; j < n; j++)
+                {
+                    if (str[string_index + j] == '\0')
+                    {
+                        coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) has an incorrect "
+                                       "fractional second value (format: %s)", str, pattern->format);
+                        return -1;
+                    }
+                }
+                if (n > 6)
+                {
+                    n = 6;
+                }
+                while (n < 6)
+                {
+                    *musec *= 10;
+                    n++;
+                }
+                break;
+        }
+        string_index += element->length;
+    }
     if (str[string_index] != '\0')
     {
         coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) contains additional characters "
-                       "(format: %s)", str, format);
+                       "(format: %s)", str, pattern->format);
         return -1;
     }
 
     return 0;
 }
 
-/** Convert a time string to a date and time using a specified format.
- * The string will be parsed using the format that is provided as first parameter. This can be a '|' separated list
- * of formats that will be tried in sequence until one succeeds.
- *
- * The specification for the time format parameter is the same as the
- * <a href="../codadef/codadef-expressions.html#timeformat">date/time format patterns in coda expressions</a>.
+/** Convert a time string to a date and time using a compiled time format.
+ * If the time format consists of multiple '|' separated formats, these will be tried in sequence until one succeeds.
  *
  * \warning This function does not perform any leap second correction.
- * \param format String containing the datetime format(s) to use for parsing the datetime value.
+ * \param time_format A compiled time format.
  * \param str    String containing the time in one of the supported formats.
  * \param year   Pointer to the variable where the year will be stored.
  * \param month  Pointer to the variable where the month of the year (1 - 12) will be stored.
@@ -1457,15 +1868,14 @@ static int string_to_parts(const char *format, const char *str, int *year, int *
  *   \arg \c 0, Success.
  *   \arg \c -1, Error occurred (check #coda_errno).
  */
-LIBCODA_API int coda_time_string_to_parts(const char *format, const char *str, int *year, int *month, int *day,
-                                          int *hour, int *minute, int *second, int *musec)
+LIBCODA_API int coda_time_format_string_to_parts(const coda_time_format *time_format, const char *str, int *year,
+                                                 int *month, int *day, int *hour, int *minute, int *second, int *musec)
 {
-    int literal = 0;
-    int n = 0;
+    int i;
 
-    if (format == NULL)
+    if (time_format == NULL)
     {
-        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "format argument is NULL (%s:%u)", __FILE__, __LINE__);
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "time_format argument is NULL (%s:%u)", __FILE__, __LINE__);
         return -1;
     }
     if (str == NULL)
@@ -1480,47 +1890,58 @@ LIBCODA_API int coda_time_string_to_parts(const char *format, const char *str, i
         return -1;
     }
 
-    while (format[n] != '\0' && (literal || format[n] != '|'))
+    if (time_format->num_patterns == 1)
     {
-        if (format[n] == '\'')
-        {
-            literal = !literal;
-        }
-        n++;
+        return pattern_string_to_parts(&time_format->pattern[0], str, year, month, day, hour, minute, second, musec);
     }
-    if (format[n] == '|')
-    {
-        int offset = 0;
 
-        /* try multiple formats */
-        while (1)
-        {
-            if (string_to_parts(&format[offset], str, year, month, day, hour, minute, second, musec) == 0)
-            {
-                /* found a format that works */
-                return 0;
-            }
-            if (format[n] == '\0')
-            {
-                /* the string matched none of the formats */
-                coda_set_error(CODA_ERROR_INVALID_DATETIME,
-                               "date/time argument (%s) did not match any of the formats (%s)", str, format);
-                return -1;
-            }
-            n++;
-            offset = n;
-            while (format[n] != '\0' && (literal || format[n] != '|'))
-            {
-                if (format[n] == '\'')
-                {
-                    literal = !literal;
-                }
-                n++;
-            }
+    /* try multiple formats */
+    for (i = 0; i < time_format->num_patterns; i++)
+    {
+        if (pattern_string_to_parts(&time_format->pattern[i], str, year, month, day, hour, minute, second, musec) == 0)
+        {
+            /* found a format that works */
+            return 0;
         }
     }
 
-    return string_to_parts(format, str, year, month, day, hour, minute, second, musec);
+    /* the string matched none of the formats */
+    coda_set_error(CODA_ERROR_INVALID_DATETIME, "date/time argument (%s) did not match any of the formats (%s)", str,
+                   time_format->format);
+    return -1;
+}
+
+/** Convert a time string to a date and time using a specified format.
+ * The string will be parsed using the format that is provided as first parameter. This can be a '|' separated list
+ * of formats that will be tried in sequence until one succeeds.
+ *
+ * The specification for the time format parameter is the same as the
+ * <a href="../codadef/codadef-expressions.html#timeformat">date/time format patterns in coda expressions</a>.
+ *
+ * \warning This function does not perform any leap second correction.
+ * \param format String containing the datetime format(s) to use for parsing the datetime value.
+ * \param str    String containing the time in one of the supported formats.
+ * \param year   Pointer to the variable where the year will be stored.
+ * \param month  Pointer to the variable where the month of the year (1 - 12) will be stored.
+ * \param day    Pointer to the variable where the day of the month (1 - 31) will be stored.
+ * \param hour   Pointer to the variable where the hour of the day (0 - 23) will be stored.
+ * \param minute Pointer to the variable where the minute of the hour (0 - 59) will be stored.
+ * \param second Pointer to the variable where the second of the minute (0 - 59) will be stored.
+ * \param musec  Pointer to the variable where the microseconds of the second (0 - 999999) will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_string_to_parts(const char *format, const char *str, int *year, int *month, int *day,
+                                          int *hour, int *minute, int *second, int *musec)
+{
+    const coda_time_format *time_format;
+
+    if (get_cached_time_format(format, &time_format) != 0)
+    {
+        return -1;
+    }
+    return coda_time_format_string_to_parts(time_format, str, year, month, day, hour, minute, second, musec);
 }
 
 /** Convert a floating point time value to a string using a specified format.
@@ -1542,14 +1963,13 @@ LIBCODA_API int coda_time_string_to_parts(const char *format, const char *str, i
 /* the date/time formats that we support guarantee that strlen(format) >= strlen(str) for all formats */
 LIBCODA_API int coda_time_double_to_string(double datetime, const char *format, char *str)
 {
-    int year, month, day, hour, minute, second, musec;
+    const coda_time_format *time_format;
 
-    if (coda_time_double_to_parts(datetime, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    if (get_cached_time_format(format, &time_format) != 0)
     {
         return -1;
     }
-
-    return coda_time_parts_to_string(year, month, day, hour, minute, second, musec, format, str);
+    return coda_time_format_double_to_string(time_format, datetime, str);
 }
 
 /** Convert a floating point TAI time value to a UTC string.
@@ -1573,14 +1993,13 @@ LIBCODA_API int coda_time_double_to_string(double datetime, const char *format,
 /* the date/time formats that we support guarantee that strlen(format) >= strlen(str) for all formats */
 LIBCODA_API int coda_time_double_to_string_utc(double datetime, const char *format, char *str)
 {
-    int year, month, day, hour, minute, second, musec;
+    const coda_time_format *time_format;
 
-    if (coda_time_double_to_parts_utc(datetime, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    if (get_cached_time_format(format, &time_format) != 0)
     {
         return -1;
     }
-
-    return coda_time_parts_to_string(year, month, day, hour, minute, second, musec, format, str);
+    return coda_time_format_double_to_string_utc(time_format, datetime, str);
 }
 
 /** Convert a time string to a floating point time value.
@@ -1600,13 +2019,13 @@ LIBCODA_API int coda_time_double_to_string_utc(double datetime, const char *form
  */
 LIBCODA_API int coda_time_string_to_double(const char *format, const char *str, double *datetime)
 {
-    int year, month, day, hour, minute, second, musec;
+    const coda_time_format *time_format;
 
-    if (coda_time_string_to_parts(format, str, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    if (get_cached_time_format(format, &time_format) != 0)
     {
         return -1;
     }
-    return coda_time_parts_to_double(year, month, day, hour, minute, second, musec, datetime);
+    return coda_time_format_string_to_double(time_format, str, datetime);
 }
 
 /** Convert a UTC time string to a TAI floating point time value.
@@ -1627,16 +2046,399 @@ LIBCODA_API int coda_time_string_to_double(const char *format, const char *str,
  *   \arg \c -1, Error occurred (check #coda_errno).
  */
 int coda_time_string_to_double_utc(const char *format, const char *str, double *datetime)
+{
+    const coda_time_format *time_format;
+
+    if (get_cached_time_format(format, &time_format) != 0)
+    {
+        return -1;
+    }
+    return coda_time_format_string_to_double_utc(time_format, str, datetime);
+}
+
+/** Convert a floating point time value to a string using a compiled time format.
+ * The time string will be stored in the \a str parameter. This parameter should be allocated by the user
+ * and should be long enough to hold the formatted time string and a 0 termination character (see
+ * coda_time_format_get_string_length()).
+ *
+ * \warning This function does not perform any leap second correction.
+ * \param time_format A compiled time format.
+ * \param datetime  Floating point value representing the number of seconds since January 1st, 2000 00:00:00.000000.
+ * \param str       String representation of the floating point time value.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_double_to_string(const coda_time_format *time_format, double datetime, char *str)
+{
+    int year, month, day, hour, minute, second, musec;
+
+    if (coda_time_double_to_parts(datetime, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    {
+        return -1;
+    }
+    return coda_time_format_parts_to_string(time_format, year, month, day, hour, minute, second, musec, str);
+}
+
+/** Convert a floating point TAI time value to a UTC string using a compiled time format.
+ * The time string will be stored in the \a str parameter. This parameter should be allocated by the user
+ * and should be long enough to hold the formatted time string and a 0 termination character (see
+ * coda_time_format_get_string_length()).
+ *
+ * This function performs proper leap second correction in the conversion from TAI to UTC
+ * (see also \a coda_time_double_to_parts_utc()).
+ *
+ * \param time_format A compiled time format.
+ * \param datetime  Floating point value representing the number of seconds since January 1st, 2000 00:00:00.000000.
+ * \param str       String representation of the floating point time value.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_double_to_string_utc(const coda_time_format *time_format, double datetime, char *str)
+{
+    int year, month, day, hour, minute, second, musec;
+
+    if (coda_time_double_to_parts_utc(datetime, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    {
+        return -1;
+    }
+    return coda_time_format_parts_to_string(time_format, year, month, day, hour, minute, second, musec, str);
+}
+
+/** Convert a time string to a floating point time value using a compiled time format.
+ * \warning This function does not perform any leap second correction.
+ * \param time_format A compiled time format.
+ * \param str       String containing the time in one of the supported formats.
+ * \param datetime  Floating point value representing the number of seconds since January 1st, 2000 00:00:00.000000.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_string_to_double(const coda_time_format *time_format, const char *str,
+                                                  double *datetime)
+{
+    int year, month, day, hour, minute, second, musec;
+
+    if (coda_time_format_string_to_parts(time_format, str, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    {
+        return -1;
+    }
+    return coda_time_parts_to_double(year, month, day, hour, minute, second, musec, datetime);
+}
+
+/** Convert a UTC time string to a TAI floating point time value using a compiled time format.
+ * This function performs proper leap second correction in the conversion from UTC to TAI
+ * (see also \a coda_time_parts_to_double_utc()).
+ *
+ * \param time_format A compiled time format.
+ * \param str       String containing the time in one of the supported formats.
+ * \param datetime  Floating point value representing the number of seconds since January 1st, 2000 00:00:00.000000.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_string_to_double_utc(const coda_time_format *time_format, const char *str,
+                                                      double *datetime)
 {
     int year, month, day, hour, minute, second, musec;
 
-    if (coda_time_string_to_parts(format, str, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+    if (coda_time_format_string_to_parts(time_format, str, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
     {
         return -1;
     }
     return coda_time_parts_to_double_utc(year, month, day, hour, minute, second, musec, datetime);
 }
 
+static int double_array_to_string(const coda_time_format *time_format, long num_elements, const double *datetime,
+                                  int utc, char *str)
+{
+    date_cache cache;
+    long length;
+    long i;
+
+    if (coda_time_format_get_string_length(time_format, &length) != 0)
+    {
+        return -1;
+    }
+    if (num_elements > 0 && (datetime == NULL || str == NULL))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "datetime or str argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    cache.days = INT_MIN;
+    for (i = 0; i < num_elements; i++)
+    {
+        int year, month, day, hour, minute, second, musec;
+
+        if (double_to_parts(datetime[i], utc, &cache, &year, &month, &day, &hour, &minute, &second, &musec) != 0)
+        {
+            return -1;
+        }
+        if (coda_time_format_parts_to_string(time_format, year, month, day, hour, minute, second, musec,
+                                             &str[i * (length + 1)]) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/** Convert an array of floating point time values to strings using a compiled time format.
+ * All strings will be stored consecutively in the \a str parameter, each followed by a 0 termination character.
+ * String \a i will thus start at position <tt>i * (length + 1)</tt> in \a str, with \a length the value returned by
+ * coda_time_format_get_string_length(). The \a str parameter should be allocated by the user and should be at least
+ * <tt>num_elements * (length + 1)</tt> bytes long.
+ *
+ * \warning This function does not perform any leap second correction.
+ * \param time_format A compiled time format.
+ * \param num_elements Number of time values.
+ * \param datetime  Array of floating point values representing the number of seconds since January 1st, 2000.
+ * \param str       Buffer that will receive the string representations of the time values.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_double_to_string_array(const coda_time_format *time_format, long num_elements,
+                                                        const double *datetime, char *str)
+{
+    return double_array_to_string(time_format, num_elements, datetime, 0, str);
+}
+
+/** Convert an array of floating point TAI time values to UTC strings using a compiled time format.
+ * The strings are stored in the same way as for coda_time_format_double_to_string_array().
+ *
+ * This function performs proper leap second correction in the conversion from TAI to UTC
+ * (see also \a coda_time_double_to_parts_utc()).
+ *
+ * \param time_format A compiled time format.
+ * \param num_elements Number of time values.
+ * \param datetime  Array of floating point values representing the number of TAI seconds since January 1st, 2000.
+ * \param str       Buffer that will receive the string representations of the time values.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_double_to_string_utc_array(const coda_time_format *time_format, long num_elements,
+                                                            const double *datetime, char *str)
+{
+    return double_array_to_string(time_format, num_elements, datetime, 1, str);
+}
+
+/** Convert an array of time strings to floating point time values using a compiled time format.
+ * \warning This function does not perform any leap second correction.
+ * \param time_format A compiled time format.
+ * \param num_elements Number of time strings.
+ * \param str       Array of (0 terminated) time strings.
+ * \param datetime  Array that will receive the floating point time values (seconds since January 1st, 2000).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_string_to_double_array(const coda_time_format *time_format, long num_elements,
+                                                        const char **str, double *datetime)
+{
+    long i;
+
+    if (num_elements > 0 && (str == NULL || datetime == NULL))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "str or datetime argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_elements; i++)
+    {
+        if (coda_time_format_string_to_double(time_format, str[i], &datetime[i]) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+
+/** Convert an array of UTC time strings to TAI floating point time values using a compiled time format.
+ * This function performs proper leap second correction in the conversion from UTC to TAI
+ * (see also \a coda_time_parts_to_double_utc()).
+ *
+ * \param time_format A compiled time format.
+ * \param num_elements Number of time strings.
+ * \param str       Array of (0 terminated) time strings.
+ * \param datetime  Array that will receive the floating point time values (TAI seconds since January 1st, 2000).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_format_string_to_double_utc_array(const coda_time_format *time_format, long num_elements,
+                                                            const char **str, double *datetime)
+{
+    long i;
+
+    if (num_elements > 0 && (str == NULL || datetime == NULL))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "str or datetime argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_elements; i++)
+    {
+        if (coda_time_format_string_to_double_utc(time_format, str[i], &datetime[i]) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int double_array_to_parts(long num_elements, const double *datetime, int utc, int *year, int *month, int *day,
+                                 int *hour, int *minute, int *second, int *musec)
+{
+    date_cache cache;
+    long i;
+
+    if (num_elements > 0 && (datetime == NULL || year == NULL || month == NULL || day == NULL || hour == NULL ||
+                             minute == NULL || second == NULL || musec == NULL))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "date/time argument(s) are NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    cache.days = INT_MIN;
+    for (i = 0; i < num_elements; i++)
+    {
+        if (double_to_parts(datetime[i], utc, &cache, &year[i], &month[i], &day[i], &hour[i], &minute[i], &second[i],
+                            &musec[i]) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/** Retrieve the decomposed dates for an array of amounts of seconds since Jan 1st 2000.
+ * This is the array version of coda_time_double_to_parts(). Each of the output parameters should point to an array
+ * of at least \a num_elements items.
+ * \warning This function does _not_ perform any leap second correction.
+ * \param num_elements Number of time values.
+ * \param datetime Array with amounts of seconds since Jan 1st 2000.
+ * \param year     Array where the years will be stored.
+ * \param month    Array where the months of the year (1 - 12) will be stored.
+ * \param day      Array where the days of the month (1 - 31) will be stored.
+ * \param hour     Array where the hours of the day (0 - 23) will be stored.
+ * \param minute   Array where the minutes of the hour (0 - 59) will be stored.
+ * \param second   Array where the seconds of the minute (0 - 59) will be stored.
+ * \param musec    Array where the microseconds of the second (0 - 999999) will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_double_to_parts_array(long num_elements, const double *datetime, int *year, int *month,
+                                                int *day, int *hour, int *minute, int *second, int *musec)
+{
+    return double_array_to_parts(num_elements, datetime, 0, year, month, day, hour, minute, second, musec);
+}
+
+/** Retrieve the decomposed UTC dates for an array of amounts of TAI seconds since Jan 1st 2000.
+ * This is the array version of coda_time_double_to_parts_utc(). Each of the output parameters should point to an
+ * array of at least \a num_elements items.
+ * Since time values within an array are usually sorted, this function is considerably faster than calling
+ * coda_time_double_to_parts_utc() for each element.
+ * \param num_elements Number of time values.
+ * \param datetime Array with amounts of TAI seconds since Jan 1st 2000.
+ * \param year     Array where the years will be stored.
+ * \param month    Array where the months of the year (1 - 12) will be stored.
+ * \param day      Array where the days of the month (1 - 31) will be stored.
+ * \param hour     Array where the hours of the day (0 - 23) will be stored.
+ * \param minute   Array where the minutes of the hour (0 - 59) will be stored.
+ * \param second   Array where the seconds of the minute (0 - 60) will be stored.
+ * \param musec    Array where the microseconds of the second (0 - 999999) will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_double_to_parts_utc_array(long num_elements, const double *datetime, int *year, int *month,
+                                                    int *day, int *hour, int *minute, int *second, int *musec)
+{
+    return double_array_to_parts(num_elements, datetime, 1, year, month, day, hour, minute, second, musec);
+}
+
+/** Convert an array of TAI time values to UTC time values.
+ * Both the input and output values are seconds since Jan 1st 2000. For the UTC values each day is taken to have
+ * 86400 seconds (i.e. a UTC value equals the value that coda_time_parts_to_double() would return for the UTC date/time).
+ * A TAI value that falls within a leap second will be mapped to the last second of the UTC day (i.e. that second will
+ * be repeated).
+ * NaN and Infinite values are passed through unchanged.
+ * The \a tai and \a utc arrays may be the same array.
+ * \param num_elements Number of time values.
+ * \param tai      Array with amounts of TAI seconds since Jan 1st 2000.
+ * \param utc      Array where the amounts of UTC seconds since Jan 1st 2000 will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_tai_to_utc_array(long num_elements, const double *tai, double *utc)
+{
+    long i;
+
+    if (num_elements > 0 && (tai == NULL || utc == NULL))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "tai or utc argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_elements; i++)
+    {
+        int leap_sec;
+        int is_leap_sec;
+
+        if (coda_isNaN(tai[i]) || coda_isInf(tai[i]))
+        {
+            utc[i] = tai[i];
+            continue;
+        }
+        /* round at the microsecond in the same way as double_to_parts() does */
+        leap_sec = get_leap_seconds_for_tai(floor(tai[i] + 5E-7), &is_leap_sec);
+        utc[i] = tai[i] - (10 + leap_sec + is_leap_sec);
+    }
+
+    return 0;
+}
+
+/** Convert an array of UTC time values to TAI time values.
+ * This is the inverse of coda_time_tai_to_utc_array(). Both the input and output values are seconds since
+ * Jan 1st 2000, where for the UTC values each day is taken to have 86400 seconds.
+ * NaN and Infinite values are passed through unchanged.
+ * The \a utc and \a tai arrays may be the same array.
+ * \param num_elements Number of time values.
+ * \param utc      Array with amounts of UTC seconds since Jan 1st 2000.
+ * \param tai      Array where the amounts of TAI seconds since Jan 1st 2000 will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_time_utc_to_tai_array(long num_elements, const double *utc, double *tai)
+{
+    long i;
+
+    if (num_elements > 0 && (utc == NULL || tai == NULL))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "utc or tai argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    for (i = 0; i < num_elements; i++)
+    {
+        if (coda_isNaN(utc[i]) || coda_isInf(utc[i]))
+        {
+            tai[i] = utc[i];
+            continue;
+        }
+        /* round at the microsecond in the same way as double_to_parts() does */
+        tai[i] = utc[i] + 10 + get_leap_seconds_for_utc_day(86400.0 * floor((utc[i] + 5E-7) / 86400.0) + 10);
+    }
+
+    return 0;
+}
+
 
 /* Deprecated backward compatibility functions */
 
@@ -614,6 +614,15 @@ static void raw_delete(coda_type_raw *type)
     free(type);
 }
 
+static void time_decoder_delete(coda_time_decoder *decoder)
+{
+    if (decoder->mapping != NULL)
+    {
+        free(decoder->mapping);
+    }
+    free(decoder);
+}
+
 static void special_delete(coda_type_special *type)
 {
     if (type == NULL)
@@ -648,6 +657,10 @@ static void special_delete(coda_type_special *type)
     {
         coda_expression_delete(type->value_expr);
     }
+    if (type->time_decoder != NULL)
+    {
+        time_decoder_delete(type->time_decoder);
+    }
     free(type);
 }
 
@@ -1290,9 +1303,13 @@ int coda_type_record_insert_field(coda_type_record *type, long index, coda_type_
 
     if (type->format != field->type->format)
     {
-        /* we only allow switching from binary or xml to ascii */
+        /* we only allow switching from binary or xml to ascii and from rinex or sp3 to binary (the latter is used for
+         * values that are stored as packed binary data in memory)
+         */
         if (!(field->type->format == coda_format_ascii &&
-              (type->format == coda_format_binary || type->format == coda_format_xml)))
+              (type->format == coda_format_binary || type->format == coda_format_xml)) &&
+            !(field->type->format == coda_format_binary &&
+              (type->format == coda_format_rinex || type->format == coda_format_sp3)))
         {
             coda_set_error(CODA_ERROR_DATA_DEFINITION, "cannot add field with %s format to record with %s format",
                            coda_type_get_format_name(field->type->format), coda_type_get_format_name(type->format));
@@ -1603,9 +1620,13 @@ int coda_type_array_set_base_type(coda_type_array *type, coda_type *base_type)
     }
     if (type->format != base_type->format)
     {
-        /* we only allow switching from binary or xml to ascii */
+        /* we only allow switching from binary or xml to ascii and from rinex or sp3 to binary (the latter is used for
+         * values that are stored as packed binary data in memory)
+         */
         if (!(base_type->format == coda_format_ascii &&
-              (type->format == coda_format_binary || type->format == coda_format_xml)))
+              (type->format == coda_format_binary || type->format == coda_format_xml)) &&
+            !(base_type->format == coda_format_binary &&
+              (type->format == coda_format_rinex || type->format == coda_format_sp3)))
         {
             coda_set_error(CODA_ERROR_DATA_DEFINITION, "cannot add element with %s format to array with %s format",
                            coda_type_get_format_name(base_type->format), coda_type_get_format_name(type->format));
@@ -2243,6 +2264,7 @@ coda_type_special *coda_type_no_data_singleton(coda_format format)
         type->base_type = NULL;
         type->unit = NULL;
         type->value_expr = NULL;
+        type->time_decoder = NULL;
 
         type->base_type = (coda_type *)coda_type_raw_new(format);
         if (type->base_type == NULL)
@@ -2286,6 +2308,7 @@ coda_type_special *coda_type_vsf_integer_new(coda_format format)
     type->base_type = NULL;
     type->unit = NULL;
     type->value_expr = NULL;
+    type->time_decoder = NULL;
 
     type->base_type = (coda_type *)coda_type_record_new(format);
     coda_type_set_description(type->base_type, "Variable Scale Factor Integer");
@@ -2423,6 +2446,304 @@ int coda_type_vsf_integer_validate(coda_type_special *type)
     return 0;
 }
 
+static int get_time_decoder_constant(const coda_expression *expr, double *value)
+{
+    if (expr->tag == expr_constant_float)
+    {
+        *value = ((coda_expression_float_constant *)expr)->value;
+        return 1;
+    }
+    if (expr->tag == expr_constant_integer)
+    {
+        *value = (double)((coda_expression_integer_constant *)expr)->value;
+        return 1;
+    }
+    return 0;
+}
+
+/* checks whether expr is 'float(.)' or 'float(./<field>)' and returns the field index (-1 for '.') */
+static int get_time_decoder_value_node(const coda_type *base_type, const coda_expression *expr, long *field_index)
+{
+    const coda_expression_operation *opexpr = (const coda_expression_operation *)expr;
+    coda_type_record *record;
+    long index;
+
+    if (expr->tag != expr_float || opexpr->operand[0]->result_type != coda_expression_node)
+    {
+        return 0;
+    }
+    opexpr = (const coda_expression_operation *)opexpr->operand[0];
+    if (opexpr->tag == expr_goto_here)
+    {
+        if (base_type->type_class != coda_integer_class && base_type->type_class != coda_real_class)
+        {
+            return 0;
+        }
+        *field_index = -1;
+        return 1;
+    }
+    if (opexpr->tag != expr_goto_field || opexpr->identifier == NULL || opexpr->operand[0] == NULL ||
+        opexpr->operand[0]->tag != expr_goto_here || base_type->type_class != coda_record_class)
+    {
+        return 0;
+    }
+    record = (coda_type_record *)base_type;
+    if (record->union_field_expr != NULL)
+    {
+        return 0;
+    }
+    index = hashtable_get_index_from_name(record->hash_data, opexpr->identifier);
+    if (index < 0)
+    {
+        return 0;
+    }
+    if (record->field[index]->optional || record->field[index]->available_expr != NULL)
+    {
+        return 0;
+    }
+    if (record->field[index]->type->type_class != coda_integer_class &&
+        record->field[index]->type->type_class != coda_real_class)
+    {
+        return 0;
+    }
+    *field_index = index;
+    return 1;
+}
+
+/* recognises 'c', 'F', '(F +/- c)', 'F * c', 'c * F', 'F / c', '(F +/- c) * c', etc. with F a value node */
+static int get_time_decoder_term(const coda_type *base_type, const coda_expression *expr, coda_time_decoder_term *term)
+{
+    const coda_expression_operation *opexpr = (const coda_expression_operation *)expr;
+
+    term->op = '+';
+    term->field_index = -2;
+    term->value = 0;
+    term->offset_op = 0;
+    term->offset = 0;
+    term->scale_op = 0;
+    term->scale = 1;
+
+    if (get_time_decoder_constant(expr, &term->value))
+    {
+        return 1;
+    }
+    if (expr->tag == expr_multiply || expr->tag == expr_divide)
+    {
+        if (get_time_decoder_constant(opexpr->operand[1], &term->scale))
+        {
+            term->scale_op = (expr->tag == expr_multiply ? '*' : '/');
+            expr = opexpr->operand[0];
+        }
+        else if (expr->tag == expr_multiply && get_time_decoder_constant(opexpr->operand[0], &term->scale))
+        {
+            /* multiplication is commutative (also for IEEE floating point) */
+            term->scale_op = '*';
+            expr = opexpr->operand[1];
+        }
+        else
+        {
+            return 0;
+        }
+        opexpr = (const coda_expression_operation *)expr;
+    }
+    if (expr->tag == expr_add || expr->tag == expr_subtract)
+    {
+        if (get_time_decoder_constant(opexpr->operand[1], &term->offset))
+        {
+            term->offset_op = (expr->tag == expr_add ? '+' : '-');
+            expr = opexpr->operand[0];
+        }
+        else if (expr->tag == expr_add && get_time_decoder_constant(opexpr->operand[0], &term->offset))
+        {
+            term->offset_op = '+';
+            expr = opexpr->operand[1];
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    return get_time_decoder_value_node(base_type, expr, &term->field_index);
+}
+
+/* recognises a (left associative) sum of terms */
+static int get_time_decoder_terms(const coda_type *base_type, const coda_expression *expr, coda_time_decoder *decoder)
+{
+    const coda_expression_operation *opexpr = (const coda_expression_operation *)expr;
+
+    if (expr->tag == expr_add || expr->tag == expr_subtract)
+    {
+        /* try to treat the full expression as a single term first */
+        if (get_time_decoder_term(base_type, expr, &decoder->term[decoder->num_terms]))
+        {
+            decoder->num_terms++;
+            return 1;
+        }
+        if (!get_time_decoder_terms(base_type, opexpr->operand[0], decoder) ||
+            decoder->num_terms == CODA_TIME_DECODER_MAX_TERMS)
+        {
+            return 0;
+        }
+        if (!get_time_decoder_term(base_type, opexpr->operand[1], &decoder->term[decoder->num_terms]))
+        {
+            return 0;
+        }
+        decoder->term[decoder->num_terms].op = (expr->tag == expr_add ? '+' : '-');
+        decoder->num_terms++;
+        return 1;
+    }
+
+    if (!get_time_decoder_term(base_type, expr, &decoder->term[decoder->num_terms]))
+    {
+        return 0;
+    }
+    decoder->num_terms++;
+    return 1;
+}
+
+/* recognises 'if(str(.[,<n>])=="<str>",<value>,...)' and 'if(length(.)==<n>,<value>,...)' constructs */
+static int get_time_decoder_mapping(const coda_expression *expr, coda_time_decoder_mapping *mapping)
+{
+    const coda_expression_operation *opexpr = (const coda_expression_operation *)expr;
+    const coda_expression_operation *cond;
+    const coda_expression_operation *node;
+
+    if (!get_time_decoder_constant(opexpr->operand[1], &mapping->value))
+    {
+        return 0;
+    }
+    cond = (const coda_expression_operation *)opexpr->operand[0];
+    if (cond->tag != expr_equal)
+    {
+        return 0;
+    }
+    node = (const coda_expression_operation *)cond->operand[0];
+    if (node->tag == expr_length)
+    {
+        if (node->operand[0]->tag != expr_goto_here || cond->operand[1]->tag != expr_constant_integer)
+        {
+            return 0;
+        }
+        mapping->is_length_check = 1;
+        mapping->max_length = -1;
+        mapping->length = (long)((coda_expression_integer_constant *)cond->operand[1])->value;
+        mapping->str = NULL;
+        return 1;
+    }
+    if (node->tag != expr_string || node->operand[0]->tag != expr_goto_here)
+    {
+        return 0;
+    }
+    if (cond->operand[1]->tag != expr_constant_string && cond->operand[1]->tag != expr_constant_rawstring)
+    {
+        return 0;
+    }
+    mapping->is_length_check = 0;
+    mapping->max_length = -1;
+    if (node->operand[1] != NULL)
+    {
+        if (node->operand[1]->tag != expr_constant_integer)
+        {
+            return 0;
+        }
+        mapping->max_length = (long)((coda_expression_integer_constant *)node->operand[1])->value;
+        if (mapping->max_length < 0)
+        {
+            return 0;
+        }
+    }
+    mapping->length = ((coda_expression_string_constant *)cond->operand[1])->length;
+    mapping->str = ((coda_expression_string_constant *)cond->operand[1])->value;
+    return 1;
+}
+
+/* determine whether the value_expr of a time type matches one of the patterns that can be decoded directly */
+static int time_update_decoder(coda_type_special *type)
+{
+    const coda_expression *expr = type->value_expr;
+    coda_time_decoder *decoder;
+    int num_mappings = 0;
+
+    if (type->time_decoder != NULL)
+    {
+        time_decoder_delete(type->time_decoder);
+        type->time_decoder = NULL;
+    }
+    if (type->base_type == NULL || expr == NULL)
+    {
+        return 0;
+    }
+
+    while (expr->tag == expr_if)
+    {
+        num_mappings++;
+        expr = ((const coda_expression_operation *)expr)->operand[2];
+    }
+
+    decoder = (coda_time_decoder *)malloc(sizeof(coda_time_decoder));
+    if (decoder == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       (long)sizeof(coda_time_decoder), __FILE__, __LINE__);
+        return -1;
+    }
+    decoder->num_mappings = 0;
+    decoder->mapping = NULL;
+    decoder->time_format = NULL;
+    decoder->num_terms = 0;
+
+    if (expr->tag == expr_time)
+    {
+        const coda_expression_operation *opexpr = (const coda_expression_operation *)expr;
+        const coda_expression_operation *node = (const coda_expression_operation *)opexpr->operand[0];
+
+        decoder->type = coda_time_decoder_string;
+        if (type->base_type->type_class != coda_text_class || node->tag != expr_string ||
+            node->operand[0]->tag != expr_goto_here || node->operand[1] != NULL ||
+            opexpr->time_format == NULL)
+        {
+            time_decoder_delete(decoder);
+            return 0;
+        }
+        decoder->time_format = opexpr->time_format;
+        if (num_mappings > 0)
+        {
+            decoder->mapping = malloc(num_mappings * sizeof(coda_time_decoder_mapping));
+            if (decoder->mapping == NULL)
+            {
+                coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                               (long)(num_mappings * sizeof(coda_time_decoder_mapping)), __FILE__, __LINE__);
+                time_decoder_delete(decoder);
+                return -1;
+            }
+            for (expr = type->value_expr; expr->tag == expr_if;
+                 expr = ((const coda_expression_operation *)expr)->operand[2])
+            {
+                if (!get_time_decoder_mapping(expr, &decoder->mapping[decoder->num_mappings]))
+                {
+                    time_decoder_delete(decoder);
+                    return 0;
+                }
+                decoder->num_mappings++;
+            }
+        }
+    }
+    else
+    {
+        decoder->type = coda_time_decoder_linear;
+        if (num_mappings > 0 || !get_time_decoder_terms(type->base_type, expr, decoder))
+        {
+            time_decoder_delete(decoder);
+            return 0;
+        }
+    }
+
+    type->time_decoder = decoder;
+
+    return 0;
+}
+
 coda_type_special *coda_type_time_new(coda_format format, coda_expression *value_expr)
 {
     coda_type_special *type;
@@ -2453,6 +2774,7 @@ coda_type_special *coda_type_time_new(coda_format format, coda_expression *value
     type->base_type = NULL;
     type->unit = NULL;
     type->value_expr = value_expr;
+    type->time_decoder = NULL;
 
     type->unit = strdup("s since 2000-01-01");
     if (type->unit == NULL)
@@ -2523,7 +2845,7 @@ int coda_type_time_add_ascii_float_mapping(coda_type_special *type, coda_ascii_f
 
     coda_ascii_float_mapping_delete(mapping);
 
-    return 0;
+    return time_update_decoder(type);
 }
 
 int coda_type_time_set_base_type(coda_type_special *type, coda_type *base_type)
@@ -2556,7 +2878,7 @@ int coda_type_time_set_base_type(coda_type_special *type, coda_type *base_type)
     /* update bit_size */
     type->bit_size = type->base_type->bit_size;
 
-    return 0;
+    return time_update_decoder(type);
 }
 
 int coda_type_time_validate(coda_type_special *type)
@@ -2593,6 +2915,7 @@ coda_type_special *coda_type_complex_new(coda_format format)
     type->base_type = NULL;
     type->unit = NULL;
     type->value_expr = NULL;
+    type->time_decoder = NULL;
 
     return type;
 }
@@ -207,6 +207,50 @@ typedef struct coda_type_raw_struct
     char *fixed_value;
 } coda_type_raw;
 
+/* maximum number of terms in a linear time expression that can be handled by the time decoder */
+#define CODA_TIME_DECODER_MAX_TERMS 8
+
+typedef enum coda_time_decoder_type_enum
+{
+    coda_time_decoder_string,   /* time(str(.), "<format>") */
+    coda_time_decoder_linear    /* linear combination of float(.) and/or float(./<field>) terms */
+} coda_time_decoder_type;
+
+typedef struct coda_time_decoder_mapping_struct
+{
+    int is_length_check;        /* if set, the mapping applies if the string length equals 'length' */
+    long max_length;    /* only the first max_length characters of the string are compared (-1 = full string) */
+    long length;
+    const char *str;    /* points into the value_expr of the time type */
+    double value;
+} coda_time_decoder_mapping;
+
+typedef struct coda_time_decoder_term_struct
+{
+    char op;    /* '+' or '-'; how the term is combined with the preceding terms (ignored for the first term) */
+    long field_index;   /* index of the field in the base record, -1 for the base type itself, -2 for a constant */
+    double value;       /* value for constant terms */
+    char offset_op;     /* '+', '-', or 0 if there is no offset */
+    double offset;
+    char scale_op;      /* '*', '/', or 0 if there is no scale factor */
+    double scale;
+} coda_time_decoder_term;
+
+/* decoder for common time expression patterns, such that time values can be read without using the expression
+ * evaluator; the decoder produces exactly the same values (including rounding) as evaluating value_expr */
+typedef struct coda_time_decoder_struct
+{
+    coda_time_decoder_type type;
+
+    /* ascii mappings that are checked (in order) before the string is parsed (only for string decoders) */
+    int num_mappings;
+    coda_time_decoder_mapping *mapping;
+    const coda_time_format *time_format;        /* points into the value_expr of the time type */
+
+    int num_terms;
+    coda_time_decoder_term term[CODA_TIME_DECODER_MAX_TERMS];
+} coda_time_decoder;
+
 typedef struct coda_type_special_struct
 {
     coda_format format;
@@ -223,6 +267,7 @@ typedef struct coda_type_special_struct
     coda_type *base_type;
     char *unit;
     coda_expression *value_expr;
+    coda_time_decoder *time_decoder;    /* only for time types; NULL if value_expr needs to be evaluated */
 } coda_type_special;
 
 coda_conversion *coda_conversion_new(double numerator, double denominator, double add_offset, double invalid_value);
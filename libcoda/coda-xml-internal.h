@@ -67,6 +67,17 @@ typedef struct coda_xml_element_struct
     struct coda_xml_element_struct *parent;
 } coda_xml_element;
 
+/* byte offsets of an xml element in the file (used for lazy loading of xml products) */
+typedef struct coda_xml_index_entry_struct
+{
+    int64_t offset;     /* byte offset in file of the start tag */
+    int64_t end_offset; /* byte offset in file directly after the end tag */
+    int32_t start_tag_length;   /* byte length of the start tag */
+    int32_t end_tag_length;     /* byte length of the end tag */
+    long parent;        /* index entry of the parent element (-1 for the root element) */
+    long end_index;     /* index entry directly after the index entries of all descendants */
+} coda_xml_index_entry;
+
 struct coda_xml_product_struct
 {
     /* general fields (shared between all supported product types) */
@@ -82,10 +93,12 @@ struct coda_xml_product_struct
 
     /* 'xml' product specific fields */
     coda_product *raw_product;
+    long num_index_entries;
+    coda_xml_index_entry *index_entry;  /* elements with child elements in document order (for lazy loading) */
 };
 typedef struct coda_xml_product_struct coda_xml_product;
 
-int coda_xml_parse(coda_xml_product *product);
+int coda_xml_parse(coda_xml_product *product, int use_lazy_loading);
 
 int coda_xml_element_add_element(coda_xml_element *parent, coda_xml_product *product, const char *el, const char **attr,
                                  int64_t outer_bit_offset, int64_t inner_bit_offset, int update_definition,
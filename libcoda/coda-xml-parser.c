@@ -46,6 +46,9 @@
 
 #define BUFFSIZE        8192
 
+/* the element index is grown in steps of this number of entries */
+#define INDEX_BLOCK_SIZE 4096
+
 static int is_whitespace(const char *s, int len)
 {
     int i;
@@ -263,6 +266,17 @@ struct parser_info_struct
     long value_length;  /* number of used characters within value buffer */
     long value_size;    /* allocated size for value buffer */
     char *value;
+
+    /* fields for lazy loading */
+    int64_t stream_offset;      /* number of bytes that have been passed to the xml parser */
+    int64_t file_offset_delta;  /* difference between file offset and stream offset for the current block */
+    long current_entry; /* index entry of the current element (only used when creating the element index) */
+    long lazy_index;    /* index entry of the element whose content can be skipped (or -1) */
+    coda_dynamic_type *lazy_element;    /* placeholder for the current element if its content is skipped */
+    int skip_elements;  /* number of ancestor start tags that still need to be ignored when loading an element */
+    coda_type *load_definition; /* definition for the element that is being loaded (or NULL) */
+    char *load_name;    /* xml name of the element that is being loaded */
+    coda_dynamic_type *load_result;     /* the loaded element */
 };
 typedef struct parser_info_struct parser_info;
 
@@ -289,6 +303,22 @@ static void parser_info_cleanup(parser_info *info)
     {
         free(info->value);
     }
+    if (info->lazy_element != NULL)
+    {
+        coda_dynamic_type_delete(info->lazy_element);
+    }
+    if (info->load_definition != NULL)
+    {
+        coda_type_release(info->load_definition);
+    }
+    if (info->load_name != NULL)
+    {
+        free(info->load_name);
+    }
+    if (info->load_result != NULL)
+    {
+        coda_dynamic_type_delete(info->load_result);
+    }
 }
 
 static void parser_info_init(parser_info *info)
@@ -302,6 +332,15 @@ static void parser_info_init(parser_info *info)
     info->value_length = 0;
     info->value_size = 0;
     info->value = NULL;
+    info->stream_offset = 0;
+    info->file_offset_delta = 0;
+    info->current_entry = -1;
+    info->lazy_index = -1;
+    info->lazy_element = NULL;
+    info->skip_elements = 0;
+    info->load_definition = NULL;
+    info->load_name = NULL;
+    info->load_result = NULL;
 }
 
 static void abort_parser(parser_info *info)
@@ -320,6 +359,86 @@ static int XMLCALL not_standalone_handler(void *data)
     return XML_STATUS_ERROR;
 }
 
+/* create the attributes and (if the element is an xml record) the record for the element at the current depth */
+static void init_element(parser_info *info, coda_type *definition, const char *el, const char **attr)
+{
+    /* create attributes record */
+    if (definition->attributes == NULL)
+    {
+        info->attributes = NULL;
+        if (info->update_definition)
+        {
+            if (attr[0] != NULL || el != coda_element_name_from_xml_name(el))
+            {
+                definition->attributes = coda_type_record_new(coda_format_xml);
+                if (definition->attributes == NULL)
+                {
+                    abort_parser(info);
+                    return;
+                }
+                info->attributes = (coda_dynamic_type *)attribute_record_new(definition->attributes, info->product,
+                                                                             el, attr, info->update_definition);
+                if (info->attributes == NULL)
+                {
+                    abort_parser(info);
+                    return;
+                }
+            }
+        }
+        else
+        {
+            if (attr[0] != NULL)
+            {
+                coda_set_error(CODA_ERROR_PRODUCT, "xml attribute '%s' is not allowed", attr[0]);
+                abort_parser(info);
+                return;
+            }
+        }
+    }
+    else
+    {
+        info->attributes = (coda_dynamic_type *)attribute_record_new(definition->attributes, info->product, el, attr,
+                                                                     info->update_definition);
+        if (info->attributes == NULL)
+        {
+            abort_parser(info);
+            return;
+        }
+    }
+
+    /* xml records are already created here in order to allow adding child xml elements */
+    if (definition->format == coda_format_xml && definition->type_class == coda_record_class)
+    {
+        int i;
+
+        assert(!((coda_type_record *)definition)->is_union);
+        info->record[info->depth] = coda_mem_record_new((coda_type_record *)definition, info->attributes);
+        if (info->record[info->depth] == NULL)
+        {
+            abort_parser(info);
+            return;
+        }
+        /* create empty arrays for array child elements */
+        for (i = 0; i < info->record[info->depth]->num_fields; i++)
+        {
+            if (((coda_type_record *)definition)->field[i]->type->type_class == coda_array_class &&
+                ((coda_type_record *)definition)->field[i]->type->format == coda_format_xml)
+            {
+                coda_type *array_definition = ((coda_type_record *)definition)->field[i]->type;
+
+                info->record[info->depth]->field_type[i] =
+                    (coda_dynamic_type *)coda_mem_array_new((coda_type_array *)array_definition, NULL);
+                if (info->record[info->depth]->field_type[i] == NULL)
+                {
+                    abort_parser(info);
+                    return;
+                }
+            }
+        }
+        info->attributes = NULL;
+    }
+}
+
 static void XMLCALL start_element_handler(void *data, const char *el, const char **attr)
 {
     parser_info *info;
@@ -329,6 +448,33 @@ static void XMLCALL start_element_handler(void *data, const char *el, const char
 
     info = (parser_info *)data;
 
+    if (info->skip_elements > 0)
+    {
+        /* start tag of an ancestor of the element that is being loaded */
+        info->skip_elements--;
+        return;
+    }
+    if (info->load_definition != NULL && info->depth == 0)
+    {
+        /* start tag of the element that is being loaded */
+        info->load_name = strdup(info->update_definition ? el : coda_element_name_from_xml_name(el));
+        if (info->load_name == NULL)
+        {
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate string) (%s:%u)", __FILE__,
+                           __LINE__);
+            abort_parser(info);
+            return;
+        }
+        info->value_length = 0;
+        info->depth++;
+        info->record[info->depth] = NULL;
+        info->index[info->depth] = -1;
+        info->definition[info->depth] = &info->load_definition;
+        info->xml_name[info->depth] = info->load_name;
+        init_element(info, info->load_definition, el, attr);
+        return;
+    }
+
     if (info->record[info->depth] != NULL)
     {
         if (info->record[info->depth]->definition->format != coda_format_xml)
@@ -495,96 +641,26 @@ static void XMLCALL start_element_handler(void *data, const char *el, const char
         }
     }
 
-    /* create attributes record */
-    if (definition->attributes == NULL)
-    {
-        info->attributes = NULL;
-        if (info->update_definition)
-        {
-            if (attr[0] != NULL || el != coda_element_name_from_xml_name(el))
-            {
-                definition->attributes = coda_type_record_new(coda_format_xml);
-                if (definition->attributes == NULL)
-                {
-                    abort_parser(info);
-                    return;
-                }
-                info->attributes = (coda_dynamic_type *)attribute_record_new(definition->attributes, info->product,
-                                                                             el, attr, info->update_definition);
-                if (info->attributes == NULL)
-                {
-                    abort_parser(info);
-                    return;
-                }
-            }
-        }
-        else
-        {
-            if (attr[0] != NULL)
-            {
-                coda_set_error(CODA_ERROR_PRODUCT, "xml attribute '%s' is not allowed", attr[0]);
-                abort_parser(info);
-                return;
-            }
-        }
-    }
-    else
+    if (info->lazy_index >= 0 && definition->format == coda_format_xml && definition->type_class == coda_record_class &&
+        XML_GetCurrentByteIndex(info->parser) + info->file_offset_delta ==
+        info->product->index_entry[info->lazy_index].offset)
     {
-        info->attributes = (coda_dynamic_type *)attribute_record_new(definition->attributes, info->product, el, attr,
-                                                                     info->update_definition);
-        if (info->attributes == NULL)
+        /* the content of this element is skipped; it will only be parsed once a cursor moves to this element */
+        info->lazy_element = (coda_dynamic_type *)coda_mem_lazy_new(definition, info->lazy_index);
+        if (info->lazy_element == NULL)
         {
             abort_parser(info);
-            return;
         }
+        return;
     }
 
-    /* xml records are already created here in order to allow adding child xml elements */
-    if (definition->format == coda_format_xml && definition->type_class == coda_record_class)
-    {
-        int i;
-
-        assert(!((coda_type_record *)definition)->is_union);
-        info->record[info->depth] = coda_mem_record_new((coda_type_record *)definition, info->attributes);
-        if (info->record[info->depth] == NULL)
-        {
-            abort_parser(info);
-            return;
-        }
-        /* create empty arrays for array child elements */
-        for (i = 0; i < info->record[info->depth]->num_fields; i++)
-        {
-            if (((coda_type_record *)definition)->field[i]->type->type_class == coda_array_class &&
-                ((coda_type_record *)definition)->field[i]->type->format == coda_format_xml)
-            {
-                coda_type *array_definition = ((coda_type_record *)definition)->field[i]->type;
-
-                info->record[info->depth]->field_type[i] =
-                    (coda_dynamic_type *)coda_mem_array_new((coda_type_array *)array_definition, NULL);
-                if (info->record[info->depth]->field_type[i] == NULL)
-                {
-                    abort_parser(info);
-                    return;
-                }
-            }
-        }
-        info->attributes = NULL;
-    }
+    init_element(info, definition, el, attr);
 }
 
-static void XMLCALL end_element_handler(void *data, const char *el)
+/* create the type for the element at the current depth once all its content has been parsed */
+static coda_mem_type *finish_element(parser_info *info)
 {
-    parser_info *info = (parser_info *)data;
-    coda_mem_record *parent;
     coda_mem_type *type;
-    int index;
-
-    (void)el;
-
-    if (info->abort_parser)
-    {
-        return;
-    }
 
     /* we are dealing with a record if info->record[info->depth] != NULL */
     if (info->record[info->depth] != NULL && info->value_length > 0 && !is_whitespace(info->value, info->value_length))
@@ -594,18 +670,16 @@ static void XMLCALL end_element_handler(void *data, const char *el)
         {
             coda_set_error(CODA_ERROR_PRODUCT, "mixed content for element '%s' is not supported",
                            info->xml_name[info->depth]);
-            abort_parser(info);
-            return;
+            return NULL;
         }
         /* convert definition from record to text */
         info->attributes = info->record[info->depth]->attributes;
         info->record[info->depth]->attributes = NULL;
         if (convert_to_text(info->definition[info->depth]) != 0)
         {
-            abort_parser(info);
-            return;
+            return NULL;
         }
-        /* delete the record we created in start_element_handler() */
+        /* delete the record we created in init_element() */
         coda_dynamic_type_delete((coda_dynamic_type *)info->record[info->depth]);
         info->record[info->depth] = NULL;
     }
@@ -625,16 +699,14 @@ static void XMLCALL end_element_handler(void *data, const char *el)
                                                                (uint8_t *)info->value);
             if (base_type == NULL)
             {
-                abort_parser(info);
-                return;
+                return NULL;
             }
 
             type = (coda_mem_type *)coda_mem_time_new((coda_type_special *)definition, info->attributes, base_type);
             if (type == NULL)
             {
                 coda_dynamic_type_delete(base_type);
-                abort_parser(info);
-                return;
+                return NULL;
             }
         }
         else
@@ -643,8 +715,7 @@ static void XMLCALL end_element_handler(void *data, const char *el)
                                                       info->value_length, (uint8_t *)info->value);
             if (type == NULL)
             {
-                abort_parser(info);
-                return;
+                return NULL;
             }
         }
         info->attributes = NULL;
@@ -657,8 +728,7 @@ static void XMLCALL end_element_handler(void *data, const char *el)
 
             if (coda_mem_record_validate(info->record[info->depth]) != 0)
             {
-                abort_parser(info);
-                return;
+                return NULL;
             }
 
             /* also validate all fields that are arrays of xml elements */
@@ -673,8 +743,7 @@ static void XMLCALL end_element_handler(void *data, const char *el)
                     {
                         if (coda_mem_array_validate((coda_mem_array *)field_type) != 0)
                         {
-                            abort_parser(info);
-                            return;
+                            return NULL;
                         }
                         /* if the array is empty and the field is optional then remove the array */
                         if (((coda_mem_array *)field_type)->num_elements == 0 &&
@@ -691,8 +760,50 @@ static void XMLCALL end_element_handler(void *data, const char *el)
         info->record[info->depth] = NULL;
     }
 
+    return type;
+}
+
+static void XMLCALL end_element_handler(void *data, const char *el)
+{
+    parser_info *info = (parser_info *)data;
+    coda_mem_record *parent;
+    coda_mem_type *type;
+    int index;
+
+    (void)el;
+
+    if (info->abort_parser)
+    {
+        return;
+    }
+
+    if (info->lazy_element != NULL)
+    {
+        /* the content of this element was skipped, so we only add the placeholder */
+        type = (coda_mem_type *)info->lazy_element;
+        info->lazy_element = NULL;
+    }
+    else
+    {
+        type = finish_element(info);
+        if (type == NULL)
+        {
+            abort_parser(info);
+            return;
+        }
+    }
+
     assert(info->attributes == NULL);
 
+    if (info->load_definition != NULL && info->depth == 1)
+    {
+        /* end tag of the element that is being loaded */
+        info->load_result = (coda_dynamic_type *)type;
+        info->depth--;
+        info->value_length = 0;
+        return;
+    }
+
     parent = info->record[info->depth - 1];
     index = info->index[info->depth];
     if (parent->field_type[index] != NULL)
@@ -748,34 +859,307 @@ static void XMLCALL character_data_handler(void *data, const char *s, int len)
     info->value_length += len;
 }
 
-int coda_xml_parse(coda_xml_product *product)
+static void XMLCALL index_start_element_handler(void *data, const char *el, const char **attr)
 {
-    char buff[BUFFSIZE];
-    parser_info info;
-    long num_blocks;
-    long i;
+    parser_info *info = (parser_info *)data;
+    coda_xml_product *product = info->product;
+    coda_xml_index_entry *entry;
+
+    (void)el;
+    (void)attr;
 
-    parser_info_init(&info);
-    info.parser = XML_ParserCreateNS(NULL, ' ');
-    if (info.parser == NULL)
+    if (info->depth >= CODA_CURSOR_MAXDEPTH - 1)
     {
-        coda_set_error(CODA_ERROR_XML, "could not create XML parser");
-        return -1;
+        coda_set_error(CODA_ERROR_PRODUCT, "xml file exceeds maximum supported hierarchical depth (%d)",
+                       CODA_CURSOR_MAXDEPTH);
+        abort_parser(info);
+        return;
     }
-    info.product = product;
-    info.update_definition = (product->product_definition == NULL || product->product_definition->root_type == NULL);
-    /* the root of the product is always a record, which will contain the top-level xml element as a field */
-    if (info.update_definition)
+    info->depth++;
+
+    if (info->current_entry >= 0)
     {
-        coda_type_record *definition;
+        /* mark the parent as having child elements (the actual end index is set when the parent ends) */
+        product->index_entry[info->current_entry].end_index = 0;
+    }
+    if (product->num_index_entries % INDEX_BLOCK_SIZE == 0)
+    {
+        coda_xml_index_entry *new_index_entry;
 
-        definition = coda_type_record_new(coda_format_xml);
-        if (definition == NULL)
+        new_index_entry = realloc(product->index_entry,
+                                  (product->num_index_entries + INDEX_BLOCK_SIZE) * sizeof(coda_xml_index_entry));
+        if (new_index_entry == NULL)
         {
-            XML_ParserFree(info.parser);
-            return -1;
+            coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                           (product->num_index_entries + INDEX_BLOCK_SIZE) * sizeof(coda_xml_index_entry), __FILE__,
+                           __LINE__);
+            abort_parser(info);
+            return;
         }
-        info.record[0] = coda_mem_record_new(definition, NULL);
+        product->index_entry = new_index_entry;
+    }
+    entry = &product->index_entry[product->num_index_entries];
+    entry->offset = XML_GetCurrentByteIndex(info->parser);
+    entry->end_offset = -1;
+    entry->start_tag_length = XML_GetCurrentByteCount(info->parser);
+    entry->end_tag_length = 0;
+    entry->parent = info->current_entry;
+    entry->end_index = -1;
+    info->current_entry = product->num_index_entries;
+    product->num_index_entries++;
+}
+
+static void XMLCALL index_end_element_handler(void *data, const char *el)
+{
+    parser_info *info = (parser_info *)data;
+    coda_xml_index_entry *entry;
+
+    (void)el;
+
+    if (info->abort_parser)
+    {
+        return;
+    }
+
+    entry = &info->product->index_entry[info->current_entry];
+    if (entry->end_index < 0)
+    {
+        /* elements without child elements are always parsed as part of their parent, so we don't keep them */
+        assert(info->product->num_index_entries == info->current_entry + 1);
+        info->product->num_index_entries--;
+    }
+    else
+    {
+        entry->end_tag_length = XML_GetCurrentByteCount(info->parser);
+        entry->end_offset = XML_GetCurrentByteIndex(info->parser) + entry->end_tag_length;
+        entry->end_index = info->product->num_index_entries;
+    }
+    info->current_entry = entry->parent;
+    info->depth--;
+}
+
+static int create_parser(parser_info *info, coda_xml_product *product)
+{
+    parser_info_init(info);
+    info->parser = XML_ParserCreateNS(NULL, ' ');
+    if (info->parser == NULL)
+    {
+        coda_set_error(CODA_ERROR_XML, "could not create XML parser");
+        return -1;
+    }
+    info->product = product;
+    info->update_definition = (product->product_definition == NULL || product->product_definition->root_type == NULL);
+
+    XML_SetUserData(info->parser, info);
+    XML_SetParamEntityParsing(info->parser, XML_PARAM_ENTITY_PARSING_ALWAYS);
+    XML_SetElementHandler(info->parser, start_element_handler, end_element_handler);
+    XML_SetCharacterDataHandler(info->parser, character_data_handler);
+    XML_SetNotStandaloneHandler(info->parser, not_standalone_handler);
+
+    return 0;
+}
+
+static void set_parse_error(parser_info *info)
+{
+    char s[21];
+
+    if (coda_errno == 0)
+    {
+        coda_set_error(CODA_ERROR_XML, "xml parse error: %s", XML_ErrorString(XML_GetErrorCode(info->parser)));
+    }
+    coda_str64(XML_GetCurrentByteIndex(info->parser) + info->file_offset_delta, s);
+    if (info->file_offset_delta == 0)
+    {
+        coda_add_error_message(" (line: %lu, byte offset: %s)", (long)XML_GetCurrentLineNumber(info->parser), s);
+    }
+    else
+    {
+        /* line numbers are not known if parts of the file were skipped */
+        coda_add_error_message(" (byte offset: %s)", s);
+    }
+}
+
+static int parse_buffer(parser_info *info, const char *buffer, int length, int is_final)
+{
+    int result;
+
+    coda_errno = 0;
+    result = XML_Parse(info->parser, buffer, length, is_final);
+    if (result == XML_STATUS_ERROR || coda_errno != 0)
+    {
+        set_parse_error(info);
+        return -1;
+    }
+    info->stream_offset += length;
+
+    return 0;
+}
+
+/* get a pointer to the bytes [offset, offset + length) of the file (buffer is only used if the file is not mmap-ed) */
+static int get_block(coda_bin_product *raw_product, int64_t offset, int length, char *buffer, const char **block)
+{
+    int read_length;
+
+    if (raw_product->use_mmap)
+    {
+        *block = (const char *)&raw_product->mem_ptr[offset];
+        return 0;
+    }
+
+    if (lseek(raw_product->fd, (off_t)offset, SEEK_SET) < 0)
+    {
+        char byte_offset_str[21];
+
+        coda_str64(offset, byte_offset_str);
+        coda_set_error(CODA_ERROR_FILE_READ, "could not move to byte position %s (%s)", byte_offset_str,
+                       strerror(errno));
+        return -1;
+    }
+    read_length = read(raw_product->fd, buffer, length);
+    if (read_length < 0)
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
+        return -1;
+    }
+    if (read_length < length)
+    {
+        coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (unexpected end of file)");
+        return -1;
+    }
+    *block = buffer;
+
+    return 0;
+}
+
+/* pass the bytes [offset, offset + length) of the file to the xml parser */
+static int parse_data(parser_info *info, int64_t offset, int64_t length, int is_final)
+{
+    coda_bin_product *raw_product = (coda_bin_product *)info->product->raw_product;
+    char buff[BUFFSIZE];
+    int64_t end_offset = offset + length;
+
+    info->file_offset_delta = offset - info->stream_offset;
+    if (length == 0)
+    {
+        if (is_final && info->stream_offset > 0)
+        {
+            return parse_buffer(info, "", 0, 1);
+        }
+        return 0;
+    }
+
+    /* we also need to parse in blocks for mmap-ed files since the file size may exceed MAX_INT */
+    while (offset < end_offset)
+    {
+        const char *buff_ptr;
+        int block_length;
+
+        block_length = (end_offset - offset > BUFFSIZE ? BUFFSIZE : (int)(end_offset - offset));
+        if (get_block(raw_product, offset, block_length, buff, &buff_ptr) != 0)
+        {
+            return -1;
+        }
+        if (parse_buffer(info, buff_ptr, block_length, is_final && offset + block_length == end_offset) != 0)
+        {
+            return -1;
+        }
+        offset += block_length;
+    }
+
+    return 0;
+}
+
+/* parse the bytes [offset, end_offset) of the file, but skip the content of the child elements from the index
+ * entries [first_index, end_index) that can be loaded lazily (the index only contains elements with child elements)
+ */
+static int parse_data_lazy(parser_info *info, int64_t offset, int64_t end_offset, long first_index, long end_index,
+                           int is_final)
+{
+    coda_xml_index_entry *index_entry = info->product->index_entry;
+    long i;
+
+    i = first_index;
+    while (i < end_index)
+    {
+        int64_t start_tag_end_offset = index_entry[i].offset + index_entry[i].start_tag_length;
+
+        info->lazy_index = i;
+        if (parse_data(info, offset, start_tag_end_offset - offset, 0) != 0)
+        {
+            return -1;
+        }
+        info->lazy_index = -1;
+        if (info->lazy_element != NULL)
+        {
+            /* continue with the end tag of the element */
+            offset = index_entry[i].end_offset - index_entry[i].end_tag_length;
+        }
+        else
+        {
+            offset = start_tag_end_offset;
+        }
+        i = index_entry[i].end_index;
+    }
+
+    return parse_data(info, offset, end_offset - offset, is_final);
+}
+
+static int create_index(coda_xml_product *product)
+{
+    parser_info info;
+
+    if (create_parser(&info, product) != 0)
+    {
+        return -1;
+    }
+    XML_SetElementHandler(info.parser, index_start_element_handler, index_end_element_handler);
+    XML_SetCharacterDataHandler(info.parser, NULL);
+    info.depth = 0;
+
+    if (parse_data(&info, 0, product->raw_product->file_size, 1) != 0)
+    {
+        info.depth = -1;
+        parser_info_cleanup(&info);
+        free(product->index_entry);
+        product->index_entry = NULL;
+        product->num_index_entries = 0;
+        return -1;
+    }
+
+    info.depth = -1;
+    parser_info_cleanup(&info);
+
+    return 0;
+}
+
+int coda_xml_parse(coda_xml_product *product, int use_lazy_loading)
+{
+    parser_info info;
+
+    if (use_lazy_loading && product->index_entry == NULL)
+    {
+        if (create_index(product) != 0)
+        {
+            return -1;
+        }
+    }
+
+    if (create_parser(&info, product) != 0)
+    {
+        return -1;
+    }
+    /* the root of the product is always a record, which will contain the top-level xml element as a field */
+    if (info.update_definition)
+    {
+        coda_type_record *definition;
+
+        definition = coda_type_record_new(coda_format_xml);
+        if (definition == NULL)
+        {
+            XML_ParserFree(info.parser);
+            return -1;
+        }
+        info.record[0] = coda_mem_record_new(definition, NULL);
         coda_type_release((coda_type *)definition);
     }
     else
@@ -794,91 +1178,579 @@ int coda_xml_parse(coda_xml_product *product)
     info.xml_name[0] = NULL;
     info.depth = 0;
 
-    XML_SetUserData(info.parser, &info);
-    XML_SetParamEntityParsing(info.parser, XML_PARAM_ENTITY_PARSING_ALWAYS);
-    XML_SetElementHandler(info.parser, start_element_handler, end_element_handler);
-    XML_SetCharacterDataHandler(info.parser, character_data_handler);
-    XML_SetNotStandaloneHandler(info.parser, not_standalone_handler);
+    if (product->index_entry != NULL)
+    {
+        if (parse_data_lazy(&info, 0, product->raw_product->file_size, 0, product->num_index_entries, 1) != 0)
+        {
+            parser_info_cleanup(&info);
+            return -1;
+        }
+    }
+    else if (parse_data(&info, 0, product->raw_product->file_size, 1) != 0)
+    {
+        parser_info_cleanup(&info);
+        return -1;
+    }
 
-    /* we also need to parse in blocks for mmap-ed files since the file size may exceed MAX_INT */
-    num_blocks = (long)(product->raw_product->file_size / BUFFSIZE);
-    if (product->raw_product->file_size > num_blocks * BUFFSIZE)
+    XML_ParserFree(info.parser);
+    info.parser = NULL;
+
+    if (info.update_definition)
     {
-        num_blocks++;
+        if (coda_mem_type_update((coda_dynamic_type **)&info.record[0], (coda_type *)info.record[0]->definition) != 0)
+        {
+            parser_info_cleanup(&info);
+            return -1;
+        }
     }
-    for (i = 0; i < num_blocks; i++)
+
+    product->root_type = (coda_dynamic_type *)info.record[0];
+    info.depth = -1;
+
+    parser_info_cleanup(&info);
+
+    return 0;
+}
+
+int coda_xml_load_element(coda_product *product, coda_dynamic_type **type)
+{
+    coda_xml_product *product_file = (coda_xml_product *)product;
+    coda_mem_lazy *lazy_type = (coda_mem_lazy *)*type;
+    coda_xml_index_entry *entry;
+    long ancestor[CODA_CURSOR_MAXDEPTH];
+    int num_ancestors = 0;
+    parser_info info;
+    long i;
+
+    assert(lazy_type->tag == tag_mem_lazy);
+    assert(product_file->index_entry != NULL);
+    entry = &product_file->index_entry[lazy_type->id];
+
+    if (create_parser(&info, product_file) != 0)
     {
-        const char *buff_ptr;
-        int length;
-        int result;
+        return -1;
+    }
+    info.record[0] = NULL;
+    info.definition[0] = NULL;
+    info.index[0] = -1;
+    info.xml_name[0] = NULL;
+    info.depth = 0;
+    if (info.update_definition)
+    {
+        /* the element gets its own definition, since its content may differ from other elements with the same name */
+        info.load_definition = (coda_type *)coda_type_record_new(coda_format_xml);
+        if (info.load_definition == NULL)
+        {
+            parser_info_cleanup(&info);
+            return -1;
+        }
+    }
+    else
+    {
+        info.load_definition = lazy_type->definition;
+        info.load_definition->retain_count++;
+    }
 
-        if (((coda_bin_product *)product->raw_product)->use_mmap)
+    /* the xml declaration and the start tags of all ancestors provide the context (e.g. entities and namespaces) */
+    for (i = entry->parent; i >= 0; i = product_file->index_entry[i].parent)
+    {
+        ancestor[num_ancestors] = i;
+        num_ancestors++;
+    }
+    info.skip_elements = num_ancestors;
+    if (parse_data(&info, 0, product_file->index_entry[0].offset, 0) != 0)
+    {
+        parser_info_cleanup(&info);
+        return -1;
+    }
+    while (num_ancestors > 0)
+    {
+        num_ancestors--;
+        i = ancestor[num_ancestors];
+        if (parse_data(&info, product_file->index_entry[i].offset, product_file->index_entry[i].start_tag_length, 0)
+            != 0)
         {
-            if (i < num_blocks - 1)
+            parser_info_cleanup(&info);
+            return -1;
+        }
+    }
+
+    /* parse the element itself (the content of child elements is again only parsed when it is needed) */
+    if (parse_data_lazy(&info, entry->offset, entry->end_offset, lazy_type->id + 1, entry->end_index, 0) != 0)
+    {
+        parser_info_cleanup(&info);
+        return -1;
+    }
+    assert(info.load_result != NULL);
+
+    if (info.update_definition)
+    {
+        if (coda_mem_type_update(&info.load_result, info.load_result->definition) != 0)
+        {
+            parser_info_cleanup(&info);
+            return -1;
+        }
+    }
+
+    coda_dynamic_type_delete(*type);
+    *type = info.load_result;
+    info.load_result = NULL;
+    info.depth = -1;
+
+    parser_info_cleanup(&info);
+
+    return 0;
+}
+
+struct coda_xml_stream_struct
+{
+    parser_info info;   /* needs to be the first field since the stream is passed as user data to the xml parser */
+    int num_path_elements;
+    char *path; /* copy of the path in which each '/' is replaced by a '\0' */
+    const char *element_name[CODA_CURSOR_MAXDEPTH];     /* element names of the path */
+    const char *xml_name[CODA_CURSOR_MAXDEPTH]; /* xml names of the path elements (only if a definition is used) */
+    coda_type *definition;      /* definition of the streamed elements (only if a definition is used) */
+    int depth;  /* number of currently open elements that are not part of a streamed element */
+    int match_depth;    /* number of currently open elements that match the leading elements of the path */
+    int64_t offset;     /* byte offset in file of the next block that will be passed to the xml parser */
+    int failed; /* set when an error occurred (the stream can not be continued after that) */
+    coda_dynamic_type *element; /* the streamed element that was returned by the last coda_xml_stream_next() */
+    char buffer[BUFFSIZE];
+};
+
+static int stream_element_matches(coda_xml_stream *stream, const char *el)
+{
+    int i = stream->depth;
+
+    if (stream->info.update_definition)
+    {
+        return strcmp(coda_element_name_from_xml_name(el), stream->element_name[i]) == 0;
+    }
+    return strcmp(el, stream->xml_name[i]) == 0 ||
+        strcmp(coda_element_name_from_xml_name(el), stream->xml_name[i]) == 0;
+}
+
+static void XMLCALL stream_start_element_handler(void *data, const char *el, const char **attr)
+{
+    coda_xml_stream *stream = (coda_xml_stream *)data;
+    parser_info *info = &stream->info;
+
+    if (info->depth > 0)
+    {
+        /* element within a streamed element */
+        start_element_handler(data, el, attr);
+        return;
+    }
+
+    if (stream->match_depth == stream->depth && stream_element_matches(stream, el))
+    {
+        if (stream->depth == stream->num_path_elements - 1)
+        {
+            /* start tag of a streamed element */
+            if (info->update_definition)
             {
-                length = BUFFSIZE;
+                info->load_definition = (coda_type *)coda_type_record_new(coda_format_xml);
+                if (info->load_definition == NULL)
+                {
+                    abort_parser(info);
+                    return;
+                }
             }
             else
             {
-                length = (int)(product->raw_product->file_size - (num_blocks - 1) * BUFFSIZE);
+                info->load_definition = stream->definition;
+                info->load_definition->retain_count++;
             }
-            buff_ptr = (const char *)&(product->raw_product->mem_ptr[i * BUFFSIZE]);
+            start_element_handler(data, el, attr);
+            return;
         }
-        else
+        stream->match_depth++;
+    }
+    stream->depth++;
+}
+
+static void XMLCALL stream_end_element_handler(void *data, const char *el)
+{
+    coda_xml_stream *stream = (coda_xml_stream *)data;
+    parser_info *info = &stream->info;
+
+    if (info->abort_parser)
+    {
+        return;
+    }
+
+    if (info->depth > 0)
+    {
+        end_element_handler(data, el);
+        if (info->load_result != NULL)
         {
-            if (lseek(((coda_bin_product *)product->raw_product)->fd, (off_t)i * BUFFSIZE, SEEK_SET) < 0)
-            {
-                char byte_offset_str[21];
+            /* end tag of a streamed element: suspend parsing so the element can be handed out */
+            XML_StopParser(info->parser, XML_TRUE);
+        }
+        return;
+    }
 
-                coda_str64(i * BUFFSIZE, byte_offset_str);
-                coda_set_error(CODA_ERROR_FILE_READ, "could not move to byte position %s (%s)", byte_offset_str,
-                               strerror(errno));
-                parser_info_cleanup(&info);
-                return -1;
-            }
-            length = read(((coda_bin_product *)product->raw_product)->fd, buff, BUFFSIZE);
-            if (length < 0)
+    stream->depth--;
+    if (stream->match_depth > stream->depth)
+    {
+        stream->match_depth = stream->depth;
+    }
+}
+
+static void XMLCALL stream_character_data_handler(void *data, const char *s, int len)
+{
+    /* character data outside of streamed elements is ignored */
+    if (((parser_info *)data)->depth > 0)
+    {
+        character_data_handler(data, s, len);
+    }
+}
+
+/* determine the xml names of the path elements and the definition of the streamed elements */
+static int stream_resolve_definition(coda_xml_stream *stream, coda_type *definition)
+{
+    int i;
+
+    for (i = 0; i < stream->num_path_elements; i++)
+    {
+        long index;
+
+        if (definition->type_class == coda_array_class && definition->format == coda_format_xml)
+        {
+            definition = ((coda_type_array *)definition)->base_type;
+        }
+        if (definition->type_class != coda_record_class || definition->format != coda_format_xml)
+        {
+            coda_set_error(CODA_ERROR_INVALID_NAME, "xml element '%s' can not be part of the path",
+                           stream->element_name[i]);
+            return -1;
+        }
+        if (coda_type_get_record_field_index_from_name(definition, stream->element_name[i], &index) != 0)
+        {
+            return -1;
+        }
+        if (coda_type_get_record_field_real_name(definition, index, &stream->xml_name[i]) != 0)
+        {
+            return -1;
+        }
+        definition = ((coda_type_record *)definition)->field[index]->type;
+    }
+    if (definition->type_class == coda_array_class && definition->format == coda_format_xml)
+    {
+        definition = ((coda_type_array *)definition)->base_type;
+    }
+    stream->definition = definition;
+
+    return 0;
+}
+
+/** \typedef coda_xml_stream
+ * CODA XML stream handle
+ * \ingroup coda_product
+ */
+
+/** \addtogroup coda_product
+ * @{
+ */
+
+/** Close an XML stream.
+ * The element that was returned by the last call to coda_xml_stream_next() will no longer be accessible after this
+ * call. The product itself is not closed.
+ * \param stream An XML stream that was created with coda_xml_stream_open().
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_xml_stream_close(coda_xml_stream *stream)
+{
+    if (stream == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "stream argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    if (stream->element != NULL)
+    {
+        coda_dynamic_type_delete(stream->element);
+    }
+    parser_info_cleanup(&stream->info);
+    if (stream->path != NULL)
+    {
+        free(stream->path);
+    }
+    free(stream);
+
+    return 0;
+}
+
+/** Open a stream over all occurrences of a repeated element in an XML product.
+ * An XML stream parses the XML file incrementally and only keeps the current element of \a path in memory. This
+ * allows processing of all elements of (very) large lists in an XML file with a constant amount of memory (and
+ * without the need to ever have the full XML tree in memory).
+ * The \a path should be a path of element names starting from the root element, such as
+ * "/Earth_Explorer_File/Data_Block/List_of_Records/Record". Indices, attributes, and relative references are not
+ * supported. The elements are matched based on their name only, so the stream will return all elements that
+ * match the path (e.g. Record elements from all List_of_Records elements if there would be several).
+ * If the product was opened with an external definition, the element names should be the field names from this
+ * definition and each element will be interpreted using this definition. Otherwise each element will be interpreted
+ * dynamically and will get its own definition.
+ * Only the content of the streamed elements is validated, the rest of the file is only checked for being well-formed.
+ * The stream parses the file independently from the product. To prevent CODA from building the full XML tree when
+ * opening the product you can enable coda_set_option_use_xml_lazy_loading() before opening the product.
+ * The product should remain open as long as the stream is used. A stream should be closed with coda_xml_stream_close().
+ * \param product Pointer to a product file handle of an XML product.
+ * \param path Path of element names from the root element to the repeated element.
+ * \param stream Pointer to the variable where the XML stream will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_xml_stream_open(coda_product *product, const char *path, coda_xml_stream **stream)
+{
+    coda_xml_stream *new_stream;
+    char *name;
+
+    if (product == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (product->format != coda_format_xml)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "product is not an xml product (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (path == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (path[0] != '/')
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' does not start from the root element (%s:%u)", path,
+                       __FILE__, __LINE__);
+        return -1;
+    }
+    if (stream == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "stream argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+
+    new_stream = malloc(sizeof(coda_xml_stream));
+    if (new_stream == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not allocate %lu bytes) (%s:%u)",
+                       sizeof(coda_xml_stream), __FILE__, __LINE__);
+        return -1;
+    }
+    if (create_parser(&new_stream->info, (coda_xml_product *)product) != 0)
+    {
+        free(new_stream);
+        return -1;
+    }
+    XML_SetElementHandler(new_stream->info.parser, stream_start_element_handler, stream_end_element_handler);
+    XML_SetCharacterDataHandler(new_stream->info.parser, stream_character_data_handler);
+    new_stream->info.record[0] = NULL;
+    new_stream->info.definition[0] = NULL;
+    new_stream->info.index[0] = -1;
+    new_stream->info.xml_name[0] = NULL;
+    new_stream->info.depth = 0;
+    new_stream->num_path_elements = 0;
+    new_stream->definition = NULL;
+    new_stream->depth = 0;
+    new_stream->match_depth = 0;
+    new_stream->offset = 0;
+    new_stream->failed = 0;
+    new_stream->element = NULL;
+
+    new_stream->path = strdup(&path[1]);
+    if (new_stream->path == NULL)
+    {
+        coda_set_error(CODA_ERROR_OUT_OF_MEMORY, "out of memory (could not duplicate string) (%s:%u)", __FILE__,
+                       __LINE__);
+        coda_xml_stream_close(new_stream);
+        return -1;
+    }
+    name = new_stream->path;
+    while (*name != '\0')
+    {
+        char *end = name;
+
+        while (*end != '\0' && *end != '/')
+        {
+            if (*end == '[' || *end == '@')
             {
-                coda_set_error(CODA_ERROR_FILE_READ, "could not read from file (%s)", strerror(errno));
-                parser_info_cleanup(&info);
+                coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' should only contain element names (%s:%u)",
+                               path, __FILE__, __LINE__);
+                coda_xml_stream_close(new_stream);
                 return -1;
             }
-            buff_ptr = buff;
+            end++;
+        }
+        if (end == name || (end == name + 1 && name[0] == '.') ||
+            (end == name + 2 && name[0] == '.' && name[1] == '.'))
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' should only contain element names (%s:%u)", path,
+                           __FILE__, __LINE__);
+            coda_xml_stream_close(new_stream);
+            return -1;
+        }
+        if (new_stream->num_path_elements == CODA_CURSOR_MAXDEPTH - 1)
+        {
+            coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' exceeds maximum supported hierarchical depth (%d)",
+                           path, CODA_CURSOR_MAXDEPTH);
+            coda_xml_stream_close(new_stream);
+            return -1;
+        }
+        new_stream->element_name[new_stream->num_path_elements] = name;
+        new_stream->xml_name[new_stream->num_path_elements] = NULL;
+        new_stream->num_path_elements++;
+        if (*end == '/')
+        {
+            *end = '\0';
+            end++;
+        }
+        name = end;
+    }
+    if (new_stream->num_path_elements == 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "path '%s' should contain at least one element name (%s:%u)",
+                       path, __FILE__, __LINE__);
+        coda_xml_stream_close(new_stream);
+        return -1;
+    }
+    if (!new_stream->info.update_definition)
+    {
+        if (stream_resolve_definition(new_stream, product->product_definition->root_type) != 0)
+        {
+            coda_xml_stream_close(new_stream);
+            return -1;
+        }
+    }
+
+    *stream = new_stream;
+
+    return 0;
+}
+
+/** Move to the next element of an XML stream.
+ * This function continues parsing the XML file until the end tag of the next element that matches the path of the
+ * stream. If such an element is found, \a has_element will be set to 1 and \a cursor will point to the element.
+ * If the end of the file is reached, \a has_element will be set to 0 and \a cursor will not be modified.
+ * The cursor (and any cursors that were derived from it) can only be used until the next call to
+ * coda_xml_stream_next() or coda_xml_stream_close(), since the element will be removed from memory at that point.
+ * Note that the element is the root of the cursor; moving to the parent is not possible.
+ * If an error occurs (e.g. the file is not well-formed or the element does not conform to the definition), then the
+ * stream can not be continued and should be closed.
+ * \param stream An XML stream that was created with coda_xml_stream_open().
+ * \param cursor Pointer to a CODA cursor that will be set to the next element.
+ * \param has_element Pointer to the variable where the availability of a next element will be stored.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_xml_stream_next(coda_xml_stream *stream, coda_cursor *cursor, int *has_element)
+{
+    parser_info *info;
+    int64_t file_size;
+
+    if (stream == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "stream argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (cursor == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "cursor argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (has_element == NULL)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "has_element argument is NULL (%s:%u)", __FILE__, __LINE__);
+        return -1;
+    }
+    if (stream->failed)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "xml stream can not be continued after an error (%s:%u)",
+                       __FILE__, __LINE__);
+        return -1;
+    }
+    info = &stream->info;
+    file_size = info->product->raw_product->file_size;
+
+    /* remove the previous element */
+    if (stream->element != NULL)
+    {
+        coda_dynamic_type_delete(stream->element);
+        stream->element = NULL;
+    }
+
+    while (info->load_result == NULL)
+    {
+        XML_ParsingStatus status;
+        int result;
+
+        XML_GetParsingStatus(info->parser, &status);
+        if (status.parsing == XML_FINISHED)
+        {
+            *has_element = 0;
+            return 0;
         }
 
         coda_errno = 0;
-        result = XML_Parse(info.parser, buff_ptr, length, (i == num_blocks - 1));
-        if (result == XML_STATUS_ERROR || coda_errno != 0)
+        if (status.parsing == XML_SUSPENDED)
         {
-            char s[21];
+            /* continue with the remainder of the current block */
+            result = XML_ResumeParser(info->parser);
+        }
+        else
+        {
+            const char *block;
+            int block_length;
 
-            if (coda_errno == 0)
+            block_length = (file_size - stream->offset > BUFFSIZE ? BUFFSIZE : (int)(file_size - stream->offset));
+            if (get_block((coda_bin_product *)info->product->raw_product, stream->offset, block_length,
+                          stream->buffer, &block) != 0)
             {
-                coda_set_error(CODA_ERROR_XML, "xml parse error: %s", XML_ErrorString(XML_GetErrorCode(info.parser)));
+                stream->failed = 1;
+                return -1;
             }
-            coda_str64(XML_GetCurrentByteIndex(info.parser), s);
-            coda_add_error_message(" (line: %lu, byte offset: %s)", (long)XML_GetCurrentLineNumber(info.parser), s);
-            parser_info_cleanup(&info);
+            stream->offset += block_length;
+            result = XML_Parse(info->parser, block, block_length, stream->offset == file_size);
+        }
+        if (result == XML_STATUS_ERROR || coda_errno != 0)
+        {
+            set_parse_error(info);
+            stream->failed = 1;
             return -1;
         }
     }
 
-    XML_ParserFree(info.parser);
-    info.parser = NULL;
-
-    if (info.update_definition)
+    if (info->update_definition)
     {
-        if (coda_mem_type_update((coda_dynamic_type **)&info.record[0], (coda_type *)info.record[0]->definition) != 0)
+        if (coda_mem_type_update(&info->load_result, info->load_result->definition) != 0)
         {
-            parser_info_cleanup(&info);
+            stream->failed = 1;
             return -1;
         }
     }
-
-    product->root_type = (coda_dynamic_type *)info.record[0];
-    info.depth = -1;
-
-    parser_info_cleanup(&info);
+    stream->element = info->load_result;
+    info->load_result = NULL;
+    coda_type_release(info->load_definition);
+    info->load_definition = NULL;
+    free(info->load_name);
+    info->load_name = NULL;
+
+    cursor->product = (coda_product *)info->product;
+    cursor->n = 1;
+    cursor->stack[0].type = stream->element;
+    cursor->stack[0].index = -1;
+    cursor->stack[0].bit_offset = -1;
+    coda_mem_cursor_update_offset(cursor);
+    *has_element = 1;
 
     return 0;
 }
+
+/** @} */
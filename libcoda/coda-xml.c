@@ -64,6 +64,8 @@ int coda_xml_reopen(coda_product **product)
     product_file->mem_size = 0;
     product_file->mem_ptr = NULL;
     product_file->raw_product = *product;
+    product_file->num_index_entries = 0;
+    product_file->index_entry = NULL;
 
     product_file->filename = strdup((*product)->filename);
     if (product_file->filename == NULL)
@@ -74,7 +76,7 @@ int coda_xml_reopen(coda_product **product)
         return -1;
     }
 
-    if (coda_xml_parse(product_file) != 0)
+    if (coda_xml_parse(product_file, coda_option_use_xml_lazy_loading) != 0)
     {
         coda_close((coda_product *)product_file);
         return -1;
@@ -101,9 +103,45 @@ int coda_xml_reopen_with_definition(coda_product **product, const coda_product_d
         free(product_file->mem_ptr);
         product_file->mem_ptr = NULL;
     }
+    /* an existing element index does not depend on the definition and is reused */
     product_file->product_definition = definition;
 
-    if (coda_xml_parse(product_file) != 0)
+    if (coda_xml_parse(product_file, coda_option_use_xml_lazy_loading) != 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+int coda_xml_reopen_without_definition(coda_product **product)
+{
+    coda_xml_product *product_file = *(coda_xml_product **)product;
+
+    assert(product_file->format == coda_format_xml);
+    assert(product_file->product_definition == NULL);
+
+    if (product_file->index_entry == NULL)
+    {
+        /* the product was already fully parsed */
+        return 0;
+    }
+
+    /* a lazily loaded product without definition is only used for product recognition; the definitions of the
+     * elements that were not loaded would otherwise be missing from the product root type */
+    coda_dynamic_type_delete(product_file->root_type);
+    product_file->root_type = NULL;
+    product_file->mem_size = 0;
+    if (product_file->mem_ptr != NULL)
+    {
+        free(product_file->mem_ptr);
+        product_file->mem_ptr = NULL;
+    }
+    free(product_file->index_entry);
+    product_file->index_entry = NULL;
+    product_file->num_index_entries = 0;
+
+    if (coda_xml_parse(product_file, 0) != 0)
     {
         return -1;
     }
@@ -131,6 +169,10 @@ int coda_xml_close(coda_product *product)
     {
         coda_bin_close((coda_product *)product_file->raw_product);
     }
+    if (product_file->index_entry != NULL)
+    {
+        free(product_file->index_entry);
+    }
 
     free(product_file);
 
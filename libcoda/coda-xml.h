@@ -39,7 +39,9 @@ int coda_xml_type_update(coda_dynamic_type **type, coda_type *definition);
 
 int coda_xml_reopen(coda_product **product);
 int coda_xml_reopen_with_definition(coda_product **product, const coda_product_definition *definition);
+int coda_xml_reopen_without_definition(coda_product **product);
 int coda_xml_close(coda_product *product);
 int coda_xml_cursor_set_product(coda_cursor *cursor, coda_product *product);
+int coda_xml_load_element(coda_product *product, coda_dynamic_type **type);
 
 #endif
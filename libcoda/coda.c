@@ -36,6 +36,7 @@
 #include <string.h>
 
 #include "coda-type.h"
+#include "coda-expr.h"
 #include "coda-mem.h"
 #ifdef HAVE_HDF5
 #include "coda-hdf5.h"
@@ -91,11 +92,22 @@ LIBCODA_API const char *coda_get_libcoda_version(void)
 static THREAD_LOCAL int coda_init_counter = 0;
 
 THREAD_LOCAL int coda_option_bypass_special_types = 0;
+THREAD_LOCAL long coda_option_cdf_cache_size = 0;
+THREAD_LOCAL long coda_option_hdf5_chunk_cache_size = 0;
+THREAD_LOCAL long coda_option_hdf5_chunk_cache_num_slots = 0;
+THREAD_LOCAL double coda_option_hdf5_chunk_cache_preemption = 0.75;
+THREAD_LOCAL long coda_option_hdf5_metadata_cache_size = 0;
+THREAD_LOCAL long coda_option_hdf5_page_buffer_size = 0;
 THREAD_LOCAL int coda_option_perform_boundary_checks = 1;
 THREAD_LOCAL int coda_option_perform_conversions = 1;
+THREAD_LOCAL int coda_option_profile_expressions = 0;
 THREAD_LOCAL int coda_option_read_all_definitions = 0;
 THREAD_LOCAL int coda_option_use_fast_size_expressions = 1;
+THREAD_LOCAL int coda_option_use_grib_index = 0;
+THREAD_LOCAL int coda_option_use_hdf4_lazy_loading = 0;
+THREAD_LOCAL int coda_option_use_hdf5_lazy_loading = 0;
 THREAD_LOCAL int coda_option_use_mmap = 1;
+THREAD_LOCAL int coda_option_use_xml_lazy_loading = 0;
 
 /** Enable/Disable the use of special types.
  * The CODA type system contains a series of special types that were introduced to make it easier for the user to
@@ -141,6 +153,181 @@ LIBCODA_API int coda_get_option_bypass_special_types(void)
     return coda_option_bypass_special_types;
 }
 
+/** Set the maximum amount of memory that is used for decompressed CDF data.
+ * The data of compressed CDF variables is stored in the file as a series of independently compressed blocks.
+ * CODA only decompresses such a block when data from it is read for the first time and keeps the decompressed data
+ * in memory for subsequent reads. With this option you can limit the total amount of memory (per product) that is
+ * used for these decompressed blocks. When the limit is exceeded, the blocks that were least recently used are
+ * released again (and will be decompressed again if they are accessed later on).
+ * If \a size is 0 (the default), there is no limit.
+ * The setting is applied when a product is opened.
+ * \param size Maximum size in bytes of all decompressed data blocks of a CDF product (or 0 for no limit).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_cdf_cache_size(long size)
+{
+    if (size < -1)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "size argument (%ld) is not valid", size);
+        return -1;
+    }
+
+    coda_option_cdf_cache_size = size;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the maximum amount of memory used for decompressed CDF data.
+ * \see coda_set_option_cdf_cache_size()
+ * \return The maximum size in bytes of all decompressed data blocks of a CDF product (0 means no limit).
+ */
+LIBCODA_API long coda_get_option_cdf_cache_size(void)
+{
+    return coda_option_cdf_cache_size;
+}
+
+/** Set the raw data chunk cache parameters for HDF5 products.
+ * The HDF5 library keeps a cache of decompressed chunks for each opened chunked dataset. If this cache is too small
+ * to hold all chunks that are needed when traversing a dataset, chunks will be read and decompressed over and over
+ * again, which can make reading data very slow.
+ *
+ * If \a size is 0 (the default), the default chunk cache size of the HDF5 library is used. If \a size is larger than
+ * 0, the given cache size is used for all datasets. If \a size is -1, CODA will determine the chunk cache size for
+ * each chunked dataset automatically, such that all chunks that cover a single index of the first (slowest varying)
+ * dimension fit in the cache (with an upper limit of 64MB per dataset). Note that in this case the total amount of
+ * memory used for chunk caches grows with the number of chunked datasets in a product that are being read.
+ * If \a num_slots is 0 (the default), CODA determines the number of hash table slots of the cache automatically.
+ * The \a preemption value (the HDF5 'w0' parameter) should be in the range [0,1] and defaults to 0.75.
+ *
+ * The chunk cache settings are applied when a product is opened. Changing the option therefore does not affect
+ * products that are already open, which also allows using different settings for different products.
+ * \param size Size of the chunk cache per dataset in bytes (0 for the HDF5 default, -1 to determine the size
+ * automatically).
+ * \param num_slots Number of chunk slots in the chunk cache hash table (or 0 to determine this automatically).
+ * \param preemption Chunk preemption policy value.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_hdf5_chunk_cache(long size, long num_slots, double preemption)
+{
+    if (size < -1)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "size argument (%ld) is not valid", size);
+        return -1;
+    }
+    if (num_slots < 0)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "num_slots argument (%ld) is not valid", num_slots);
+        return -1;
+    }
+    if (!(preemption >= 0 && preemption <= 1))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "preemption argument (%f) is not valid", preemption);
+        return -1;
+    }
+
+    coda_option_hdf5_chunk_cache_size = size;
+    coda_option_hdf5_chunk_cache_num_slots = num_slots;
+    coda_option_hdf5_chunk_cache_preemption = preemption;
+
+    return 0;
+}
+
+/** Retrieve the current raw data chunk cache parameters for HDF5 products.
+ * \see coda_set_option_hdf5_chunk_cache()
+ * \param size Pointer to the variable where the chunk cache size will be stored (can be NULL).
+ * \param num_slots Pointer to the variable where the number of chunk slots will be stored (can be NULL).
+ * \param preemption Pointer to the variable where the chunk preemption policy value will be stored (can be NULL).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_get_option_hdf5_chunk_cache(long *size, long *num_slots, double *preemption)
+{
+    if (size != NULL)
+    {
+        *size = coda_option_hdf5_chunk_cache_size;
+    }
+    if (num_slots != NULL)
+    {
+        *num_slots = coda_option_hdf5_chunk_cache_num_slots;
+    }
+    if (preemption != NULL)
+    {
+        *preemption = coda_option_hdf5_chunk_cache_preemption;
+    }
+
+    return 0;
+}
+
+/** Set the initial size of the HDF5 metadata cache.
+ * The metadata cache of the HDF5 library holds object headers, B-tree nodes, etc. The HDF5 library automatically
+ * resizes this cache, but for files with many objects starting with a larger cache can speed up opening a product.
+ * If \a size is 0 (the default), the HDF5 default settings are used.
+ * The setting is applied when a product is opened.
+ * \param size Initial size of the metadata cache in bytes (or 0 to use the HDF5 default).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_hdf5_metadata_cache_size(long size)
+{
+    if (size < -1)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "size argument (%ld) is not valid", size);
+        return -1;
+    }
+
+    coda_option_hdf5_metadata_cache_size = size;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the initial size of the HDF5 metadata cache.
+ * \see coda_set_option_hdf5_metadata_cache_size()
+ * \return The initial size of the metadata cache in bytes (0 means that the HDF5 default is used).
+ */
+LIBCODA_API long coda_get_option_hdf5_metadata_cache_size(void)
+{
+    return coda_option_hdf5_metadata_cache_size;
+}
+
+/** Set the size of the HDF5 page buffer.
+ * HDF5 files that were created with the 'paged' file space strategy can be accessed via a page buffer, which
+ * caches whole file pages (both metadata and raw data). If \a size is 0 (the default), no page buffer is used.
+ * The page buffer is only used for files that were created with paged aggregation, and it requires HDF5 1.10.1
+ * or later. For other files this setting is ignored.
+ * The setting is applied when a product is opened.
+ * \param size Size of the page buffer in bytes (or 0 to disable the page buffer).
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_hdf5_page_buffer_size(long size)
+{
+    if (size < -1)
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "size argument (%ld) is not valid", size);
+        return -1;
+    }
+
+    coda_option_hdf5_page_buffer_size = size;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the size of the HDF5 page buffer.
+ * \see coda_set_option_hdf5_page_buffer_size()
+ * \return The size of the page buffer in bytes (0 means that no page buffer is used).
+ */
+LIBCODA_API long coda_get_option_hdf5_page_buffer_size(void)
+{
+    return coda_option_hdf5_page_buffer_size;
+}
+
 /** Enable/Disable boundary checking.
  * By default all functions in libcoda perform boundary checks. However some boundary checks are quite compute
  * intensive. In order to increase performance you can turn off those compute intensive boundary checks with this
@@ -221,6 +408,49 @@ LIBCODA_API int coda_get_option_perform_conversions(void)
     return coda_option_perform_conversions;
 }
 
+/** Enable/Disable profiling of codadef expressions.
+ * Many products are interpreted using expressions from the codadef files (e.g. for the size of an array, the
+ * availability of a field, or the value of a time field). If profiling is enabled, CODA keeps track of the number of
+ * times each of these expressions gets evaluated and of the time spent in their evaluation. Each profiled expression is
+ * associated with its origin in the codadef (definition file, type/product definition, field/attribute, and
+ * definition element). A report of the most expensive expressions can be printed with coda_expression_profile_print().
+ *
+ * By default expression profiling is disabled.
+ * \note The origin of an expression is recorded when a definition is read from a codadef file. Since CODA only reads
+ * product definitions from the codadef files when they are needed, profiling should be enabled before the first
+ * product is opened (and preferably before calling coda_init()). Expressions that were read while profiling was
+ * disabled will not be included in the report.
+ * \param enable
+ *   \arg 0: Disable expression profiling.
+ *   \arg 1: Enable expression profiling.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_profile_expressions(int enable)
+{
+    if (!(enable == 0 || enable == 1))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "enable argument (%d) is not valid", enable);
+        return -1;
+    }
+
+    coda_option_profile_expressions = enable;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the expression profiling option.
+ * \see coda_set_option_profile_expressions()
+ * \return
+ *   \arg \c 0, Expression profiling is disabled.
+ *   \arg \c 1, Expression profiling is enabled.
+ */
+LIBCODA_API int coda_get_option_profile_expressions(void)
+{
+    return coda_option_profile_expressions;
+}
+
 /** Enable/Disable the use of fast size expressions.
  * Sometimes product files contain information that can be used to directly retrieve the size (or offset) of a data
  * element. If this information is redundant (i.e. the size and/or offset can also be determined in another way) then
@@ -273,6 +503,140 @@ LIBCODA_API int coda_get_option_use_fast_size_expressions(void)
     return coda_option_use_fast_size_expressions;
 }
 
+/** Enable/Disable the use of index files for GRIB products.
+ * When opening a GRIB product, CODA needs to scan the file to find the start of each message. For files that contain
+ * many messages this scan can take a noticeable amount of time. If this option is enabled, CODA will store the
+ * locations of the messages in an index file next to the product file (using the product filename with an additional
+ * '.codaidx' extension) and will use this index file when the product is opened again.
+ * An index file is only used if the size, modification time, and a checksum of the first and last 4096 bytes of the
+ * product file still match the values that were stored in the index, and if the first and last stored message
+ * location still point to the start of a GRIB message. If the index file can not be written (e.g. because the directory is read-only), CODA will just
+ * silently continue without it.
+ *
+ * By default the use of GRIB index files is disabled.
+ *
+ * \param enable
+ *   \arg 0: Disable the use of GRIB index files.
+ *   \arg 1: Enable the use of GRIB index files.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_use_grib_index(int enable)
+{
+    if (!(enable == 0 || enable == 1))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "enable argument (%d) is not valid", enable);
+        return -1;
+    }
+
+    coda_option_use_grib_index = enable;
+
+    return 0;
+}
+
+/** Retrieve the current setting for the use of index files for GRIB products.
+ * \see coda_set_option_use_grib_index()
+ * \return
+ *   \arg \c 0, GRIB index files are not used.
+ *   \arg \c 1, GRIB index files are used.
+ */
+LIBCODA_API int coda_get_option_use_grib_index(void)
+{
+    return coda_option_use_grib_index;
+}
+
+/** Enable/Disable lazy loading of the structure of HDF4 products.
+ * When opening an HDF4 product, CODA normally opens all SDS, GR images, Vdata, and Vgroups in the file and reads all
+ * their attributes (and the fields and field attributes of each Vdata) in order to construct the complete type tree of
+ * the product. For files that contain many objects this can take a considerable amount of time.
+ * If this option is enabled, CODA will only read the fields of a Vdata once a cursor moves into that Vdata and will
+ * only read the attributes of an SDS, GR image, Vdata, or Vgroup once a cursor moves to those attributes (attributes
+ * that are needed to determine a unit/value conversion for an SDS or GR image are still read when the object is
+ * initialized).
+ * Note that with this option enabled, the CODA type of a Vdata (as retrieved via coda_get_product_root_type() or
+ * coda_cursor_get_type()) will only contain fields once a cursor has moved into that Vdata, and the attribute record
+ * of a type will only contain fields once a cursor has moved to these attributes.
+ *
+ * By default lazy loading of HDF4 products is disabled.
+ *
+ * \param enable
+ *   \arg 0: Disable lazy loading of HDF4 products.
+ *   \arg 1: Enable lazy loading of HDF4 products.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_use_hdf4_lazy_loading(int enable)
+{
+    if (!(enable == 0 || enable == 1))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "enable argument (%d) is not valid", enable);
+        return -1;
+    }
+
+    coda_option_use_hdf4_lazy_loading = enable;
+
+    return 0;
+}
+
+/** Retrieve the current setting for lazy loading of HDF4 products.
+ * \see coda_set_option_use_hdf4_lazy_loading()
+ * \return
+ *   \arg \c 0, Lazy loading of HDF4 products is disabled.
+ *   \arg \c 1, Lazy loading of HDF4 products is enabled.
+ */
+LIBCODA_API int coda_get_option_use_hdf4_lazy_loading(void)
+{
+    return coda_option_use_hdf4_lazy_loading;
+}
+
+/** Enable/Disable lazy loading of the structure of HDF5 products.
+ * When opening an HDF5 product, CODA normally traverses all groups of the file, opens all datasets, and reads all
+ * attributes in order to construct the complete type tree of the product. For files that contain many objects this
+ * can take a considerable amount of time.
+ * If this option is enabled, CODA will only initialize the members of a group once a cursor moves to that group and
+ * will only read the attributes of a group or dataset once a cursor moves to those attributes (attributes that are
+ * needed to determine a unit/value conversion for a dataset are still read when the dataset is initialized).
+ * Note that with this option enabled, the CODA type of a group (as retrieved via coda_get_product_root_type() or
+ * coda_cursor_get_type()) will only contain fields for groups that have already been visited with a cursor, and the
+ * attribute record of a type will only contain fields once a cursor has moved to these attributes. If an object is
+ * reachable via multiple paths (i.e. there are multiple hard links to it) it will be included at the location that
+ * was visited first.
+ *
+ * By default lazy loading of HDF5 products is disabled.
+ *
+ * \param enable
+ *   \arg 0: Disable lazy loading of HDF5 products.
+ *   \arg 1: Enable lazy loading of HDF5 products.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_use_hdf5_lazy_loading(int enable)
+{
+    if (!(enable == 0 || enable == 1))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "enable argument (%d) is not valid", enable);
+        return -1;
+    }
+
+    coda_option_use_hdf5_lazy_loading = enable;
+
+    return 0;
+}
+
+/** Retrieve the current setting for lazy loading of HDF5 products.
+ * \see coda_set_option_use_hdf5_lazy_loading()
+ * \return
+ *   \arg \c 0, Lazy loading of HDF5 products is disabled.
+ *   \arg \c 1, Lazy loading of HDF5 products is enabled.
+ */
+LIBCODA_API int coda_get_option_use_hdf5_lazy_loading(void)
+{
+    return coda_option_use_hdf5_lazy_loading;
+}
+
 /** Enable/Disable the use of memory mapping of files.
  * By default CODA uses a technique called 'memory mapping' to open and access data from product files.
  * The memory mapping approach is a very fast approach that uses the mmap() function to (as the term suggests) map
@@ -329,6 +693,52 @@ LIBCODA_API int coda_get_option_use_mmap(void)
     return coda_option_use_mmap;
 }
 
+/** Enable/Disable lazy loading of XML products.
+ * When opening an XML product, CODA normally parses the complete file and constructs the full (in-memory) tree of all
+ * elements and attributes. For large files this takes a considerable amount of time and memory.
+ * If this option is enabled, CODA will, when opening the product, only create an index that contains the location in
+ * the file of each element. The content of an element that contains child elements will only be parsed (from that
+ * part of the file) once a cursor moves to that element. Elements deeper down the hierarchy are again only parsed
+ * once a cursor moves to them.
+ * Note that with this option enabled, errors in the content of an element (with regard to the product format
+ * definition) will only be reported once a cursor moves to that element.
+ * The automatic recognition of the product type (at product open) also uses lazy loading. If no product format
+ * definition is found for the product, CODA needs to parse the complete file in order to derive the definition, so
+ * the product will then still be fully loaded when it is opened.
+ *
+ * By default lazy loading of XML products is disabled.
+ *
+ * \param enable
+ *   \arg 0: Disable lazy loading of XML products.
+ *   \arg 1: Enable lazy loading of XML products.
+ * \return
+ *   \arg \c 0, Success.
+ *   \arg \c -1, Error occurred (check #coda_errno).
+ */
+LIBCODA_API int coda_set_option_use_xml_lazy_loading(int enable)
+{
+    if (!(enable == 0 || enable == 1))
+    {
+        coda_set_error(CODA_ERROR_INVALID_ARGUMENT, "enable argument (%d) is not valid", enable);
+        return -1;
+    }
+
+    coda_option_use_xml_lazy_loading = enable;
+
+    return 0;
+}
+
+/** Retrieve the current setting for lazy loading of XML products.
+ * \see coda_set_option_use_xml_lazy_loading()
+ * \return
+ *   \arg \c 0, Lazy loading of XML products is disabled.
+ *   \arg \c 1, Lazy loading of XML products is enabled.
+ */
+LIBCODA_API int coda_get_option_use_xml_lazy_loading(void)
+{
+    return coda_option_use_xml_lazy_loading;
+}
+
 
 static THREAD_LOCAL char *coda_definition_path = NULL;
 
@@ -563,6 +973,7 @@ LIBCODA_API void coda_done(void)
             coda_rinex_done();
             coda_grib_done();
             coda_data_dictionary_done();
+            coda_expression_profile_done();
             if (coda_definition_path != NULL)
             {
                 free(coda_definition_path);
@@ -571,6 +982,7 @@ LIBCODA_API void coda_done(void)
             coda_mem_done();
             coda_type_done();
             coda_leap_second_table_done();
+            coda_time_format_cache_done();
         }
     }
 }
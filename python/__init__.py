@@ -1330,6 +1330,61 @@ def get_product_variable_value(product, variable, index):
     return long(x[0])
 
 
+def xml_stream_open(product, path):
+    x = _ffi.new('coda_xml_stream **')
+    _check(_lib.coda_xml_stream_open(product._x, _encode_string(path), x), 'coda_xml_stream_open')
+    return x[0]
+
+
+def xml_stream_next(stream, cursor):
+    x = _ffi.new('int *')
+    _check(_lib.coda_xml_stream_next(stream, cursor._x, x), 'coda_xml_stream_next')
+    return x[0]
+
+
+def xml_stream_close(stream):
+    _check(_lib.coda_xml_stream_close(stream), 'coda_xml_stream_close')
+
+
+def sp3_read_satellite_series(product, vehicle_id, path):
+    cursor = Cursor()
+    cursor_set_product(cursor, product)
+    cursor_goto(cursor, '/record')
+    d = _ffi.new('double[%d]' % cursor_get_num_elements(cursor))
+    _check(_lib.coda_sp3_read_satellite_series(product._x, _encode_string(vehicle_id), _encode_string(path), d),
+           'coda_sp3_read_satellite_series')
+    return numpy.ndarray(shape=(len(d),), buffer=_ffi.buffer(d), dtype='double')
+
+
+def netcdf_read_record_variables(product, names):
+    cursor = Cursor()
+    arrays = []
+    for name in names:
+        cursor_set_product(cursor, product)
+        cursor_goto(cursor, '/' + name)
+        read_type = type_get_read_type(type_get_array_base_type(cursor_get_type(cursor)))
+        if read_type == coda_native_type_char:
+            dtype = numpy.int8
+        else:
+            dtype = _numpyNativeTypeDictionary[read_type][1]
+        arrays.append(numpy.empty(cursor_get_array_dim(cursor), dtype=dtype))
+    strings = [_ffi.new('char []', _encode_string(x)) for x in names]
+    dst = [_ffi.from_buffer(x) for x in arrays]
+    _check(_lib.coda_netcdf_read_record_variables(product._x, len(names), _ffi.new('char *[]', strings),
+                                                  _ffi.new('void *[]', dst)), 'coda_netcdf_read_record_variables')
+    return arrays
+
+
+def rinex_read_satellite_series(product, satellite, path):
+    cursor = Cursor()
+    cursor_set_product(cursor, product)
+    cursor_goto(cursor, '/record')
+    d = _ffi.new('double[%d]' % cursor_get_num_elements(cursor))
+    _check(_lib.coda_rinex_read_satellite_series(product._x, _encode_string(satellite), _encode_string(path), d),
+           'coda_rinex_read_satellite_series')
+    return numpy.ndarray(shape=(len(d),), buffer=_ffi.buffer(d), dtype='double')
+
+
 def cursor_set_product(cursor, product):
     _check(_lib.coda_cursor_set_product(cursor._x, product._x), 'coda_cursor_set_product')
 
@@ -1339,6 +1394,21 @@ def cursor_goto(cursor, path):
         raise CodacError('coda_cursor_goto')
 
 
+def cursor_goto_path(cursor, path):
+    if _lib.coda_cursor_goto_path(cursor._x, path) != 0:
+        raise CodacError('coda_cursor_goto_path')
+
+
+def path_compile(path):
+    x = _ffi.new('coda_path **')
+    _check(_lib.coda_path_compile(_encode_string(path), x), 'coda_path_compile')
+    return x[0]
+
+
+def path_delete(path):
+    _lib.coda_path_delete(path)
+
+
 def cursor_goto_parent(cursor):
     if _lib.coda_cursor_goto_parent(cursor._x) != 0:
         raise CodacError('coda_cursor_goto_parent')
@@ -2028,6 +2098,10 @@ def expression_delete(expr):
     _lib.coda_expression_delete(expr._x)
 
 
+def expression_profile_reset():
+    _lib.coda_expression_profile_reset()
+
+
 def _to_parts(dt, from_, fmt=None):
     y = _ffi.new('int *')
     mo = _ffi.new('int *')
@@ -2043,6 +2117,9 @@ def _to_parts(dt, from_, fmt=None):
         _check(_lib.coda_time_double_to_parts_utc(dt, y, mo, d, h, mi, s, mus), 'coda_time_double_to_parts_utc')
     elif from_ == 'string':
         _check(_lib.coda_time_string_to_parts(fmt, dt, y, mo, d, h, mi, s, mus), 'coda_time_string_to_parts')
+    elif from_ == 'time_format_string':
+        _check(_lib.coda_time_format_string_to_parts(fmt, dt, y, mo, d, h, mi, s, mus),
+               'coda_time_format_string_to_parts')
 
     return [y[0], mo[0], d[0], h[0], mi[0], s[0], mus[0]]
 
@@ -2107,6 +2184,125 @@ def time_string_to_parts(fmt, s):
     return _to_parts(_encode_string(s), 'string', _encode_string(fmt))
 
 
+def time_format_compile(fmt):
+    x = _ffi.new('coda_time_format **')
+    _check(_lib.coda_time_format_compile(_encode_string(fmt), x), 'coda_time_format_compile')
+    return x[0]
+
+
+def time_format_delete(time_format):
+    _lib.coda_time_format_delete(time_format)
+
+
+def time_format_get_string_length(time_format):
+    x = _ffi.new('long *')
+    _check(_lib.coda_time_format_get_string_length(time_format, x), 'coda_time_format_get_string_length')
+    return x[0]
+
+
+def time_format_parts_to_string(time_format, y, mo, d, h, mi, s, mus):
+    dt = _ffi.new('char [%d]' % (time_format_get_string_length(time_format)+1))
+    _check(_lib.coda_time_format_parts_to_string(time_format, y, mo, d, h, mi, s, mus, dt),
+           'coda_time_format_parts_to_string')
+    return _string(dt)
+
+
+def time_format_string_to_parts(time_format, s):
+    return _to_parts(_encode_string(s), 'time_format_string', time_format)
+
+
+def time_format_double_to_string(time_format, d):
+    s = _ffi.new('char [%d]' % (time_format_get_string_length(time_format)+1))
+    _check(_lib.coda_time_format_double_to_string(time_format, d, s), 'coda_time_format_double_to_string')
+    return _string(s)
+
+
+def time_format_double_to_string_utc(time_format, d):
+    s = _ffi.new('char [%d]' % (time_format_get_string_length(time_format)+1))
+    _check(_lib.coda_time_format_double_to_string_utc(time_format, d, s), 'coda_time_format_double_to_string_utc')
+    return _string(s)
+
+
+def time_format_string_to_double(time_format, s):
+    d = _ffi.new('double *')
+    _check(_lib.coda_time_format_string_to_double(time_format, _encode_string(s), d),
+           'coda_time_format_string_to_double')
+    return d[0]
+
+
+def time_format_string_to_double_utc(time_format, s):
+    d = _ffi.new('double *')
+    _check(_lib.coda_time_format_string_to_double_utc(time_format, _encode_string(s), d),
+           'coda_time_format_string_to_double_utc')
+    return d[0]
+
+
+def _time_format_double_to_string_array(time_format, d, func):
+    num_elements = len(d)
+    length = time_format_get_string_length(time_format) + 1
+    dt = _ffi.new('double [%d]' % num_elements, list(d))
+    s = _ffi.new('char [%d]' % (num_elements * length))
+    _check(getattr(_lib, func)(time_format, num_elements, dt, s), func)
+    buf = _ffi.buffer(s)
+    return [_decode_string(buf[i * length:(i + 1) * length - 1]) for i in range(num_elements)]
+
+
+def _time_format_string_to_double_array(time_format, s, func):
+    num_elements = len(s)
+    strings = [_ffi.new('char []', _encode_string(x)) for x in s]
+    d = _ffi.new('double [%d]' % num_elements)
+    _check(getattr(_lib, func)(time_format, num_elements, _ffi.new('char *[]', strings), d), func)
+    return numpy.frombuffer(_ffi.buffer(d))
+
+
+def time_format_double_to_string_array(time_format, d):
+    return _time_format_double_to_string_array(time_format, d, 'coda_time_format_double_to_string_array')
+
+
+def time_format_double_to_string_utc_array(time_format, d):
+    return _time_format_double_to_string_array(time_format, d, 'coda_time_format_double_to_string_utc_array')
+
+
+def time_format_string_to_double_array(time_format, s):
+    return _time_format_string_to_double_array(time_format, s, 'coda_time_format_string_to_double_array')
+
+
+def time_format_string_to_double_utc_array(time_format, s):
+    return _time_format_string_to_double_array(time_format, s, 'coda_time_format_string_to_double_utc_array')
+
+
+def _to_parts_array(dt, func):
+    num_elements = len(dt)
+    dt = _ffi.new('double [%d]' % num_elements, list(dt))
+    parts = [_ffi.new('int [%d]' % num_elements) for i in range(7)]
+    _check(getattr(_lib, func)(num_elements, dt, *parts), func)
+    return [numpy.frombuffer(_ffi.buffer(p), dtype='int32') for p in parts]
+
+
+def time_double_to_parts_array(d):
+    return _to_parts_array(d, 'coda_time_double_to_parts_array')
+
+
+def time_double_to_parts_utc_array(d):
+    return _to_parts_array(d, 'coda_time_double_to_parts_utc_array')
+
+
+def _time_convert_array(d, func):
+    num_elements = len(d)
+    src = _ffi.new('double [%d]' % num_elements, list(d))
+    dst = _ffi.new('double [%d]' % num_elements)
+    _check(getattr(_lib, func)(num_elements, src, dst), func)
+    return numpy.frombuffer(_ffi.buffer(dst))
+
+
+def time_tai_to_utc_array(d):
+    return _time_convert_array(d, 'coda_time_tai_to_utc_array')
+
+
+def time_utc_to_tai_array(d):
+    return _time_convert_array(d, 'coda_time_utc_to_tai_array')
+
+
 def set_definition_path_conditional(p1, p2, p3):
     def conv(p):
         if p is None:
@@ -2128,6 +2324,42 @@ def get_option_bypass_special_types():
     return _lib.coda_get_option_bypass_special_types()
 
 
+def set_option_cdf_cache_size(size):
+    _check(_lib.coda_set_option_cdf_cache_size(size), 'coda_set_option_cdf_cache_size')
+
+
+def get_option_cdf_cache_size():
+    return _lib.coda_get_option_cdf_cache_size()
+
+
+def set_option_hdf5_chunk_cache(size, num_slots, preemption):
+    _check(_lib.coda_set_option_hdf5_chunk_cache(size, num_slots, preemption), 'coda_set_option_hdf5_chunk_cache')
+
+
+def get_option_hdf5_chunk_cache():
+    size = _ffi.new('long *')
+    num_slots = _ffi.new('long *')
+    preemption = _ffi.new('double *')
+    _check(_lib.coda_get_option_hdf5_chunk_cache(size, num_slots, preemption), 'coda_get_option_hdf5_chunk_cache')
+    return size[0], num_slots[0], preemption[0]
+
+
+def set_option_hdf5_metadata_cache_size(size):
+    _check(_lib.coda_set_option_hdf5_metadata_cache_size(size), 'coda_set_option_hdf5_metadata_cache_size')
+
+
+def get_option_hdf5_metadata_cache_size():
+    return _lib.coda_get_option_hdf5_metadata_cache_size()
+
+
+def set_option_hdf5_page_buffer_size(size):
+    _check(_lib.coda_set_option_hdf5_page_buffer_size(size), 'coda_set_option_hdf5_page_buffer_size')
+
+
+def get_option_hdf5_page_buffer_size():
+    return _lib.coda_get_option_hdf5_page_buffer_size()
+
+
 def set_option_perform_boundary_checks(enable):
     _check(_lib.coda_set_option_perform_boundary_checks(enable), 'coda_set_option_perform_boundary_checks')
 
@@ -2144,6 +2376,14 @@ def get_option_perform_conversions():
     return _lib.coda_get_option_perform_conversions()
 
 
+def set_option_profile_expressions(enable):
+    _check(_lib.coda_set_option_profile_expressions(enable), 'coda_set_option_profile_expressions')
+
+
+def get_option_profile_expressions():
+    return _lib.coda_get_option_profile_expressions()
+
+
 def set_option_use_fast_size_expressions(enable):
     _check(_lib.coda_set_option_use_fast_size_expressions(enable), 'coda_set_option_use_fast_size_expressions')
 
@@ -2152,6 +2392,30 @@ def get_option_use_fast_size_expressions():
     return _lib.coda_get_option_use_fast_size_expressions()
 
 
+def set_option_use_grib_index(enable):
+    _check(_lib.coda_set_option_use_grib_index(enable), 'coda_set_option_use_grib_index')
+
+
+def get_option_use_grib_index():
+    return _lib.coda_get_option_use_grib_index()
+
+
+def set_option_use_hdf4_lazy_loading(enable):
+    _check(_lib.coda_set_option_use_hdf4_lazy_loading(enable), 'coda_set_option_use_hdf4_lazy_loading')
+
+
+def get_option_use_hdf4_lazy_loading():
+    return _lib.coda_get_option_use_hdf4_lazy_loading()
+
+
+def set_option_use_hdf5_lazy_loading(enable):
+    _check(_lib.coda_set_option_use_hdf5_lazy_loading(enable), 'coda_set_option_use_hdf5_lazy_loading')
+
+
+def get_option_use_hdf5_lazy_loading():
+    return _lib.coda_get_option_use_hdf5_lazy_loading()
+
+
 def set_option_use_mmap(enable):
     _check(_lib.coda_set_option_use_mmap(enable), 'coda_set_option_use_mmap')
 
@@ -2160,6 +2424,14 @@ def get_option_use_mmap():
     return _lib.coda_get_option_use_mmap()
 
 
+def set_option_use_xml_lazy_loading(enable):
+    _check(_lib.coda_set_option_use_xml_lazy_loading(enable), 'coda_set_option_use_xml_lazy_loading')
+
+
+def get_option_use_xml_lazy_loading():
+    return _lib.coda_get_option_use_xml_lazy_loading()
+
+
 def init():
     _check(_lib.coda_init(), 'coda_init')
 
@@ -3,9 +3,9 @@ import _cffi_backend
 
 ffi = _cffi_backend.FFI('_codac',
     _version = 0x2601,
-    _types = b'\x00\x00\x19\x0D\x00\x00\x01\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x03\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x04\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x05\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x06\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x07\x01\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x00\x0F\x00\x01\xE5\x0D\x00\x00\x00\x0F\x00\x00\x32\x0D\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x2D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x01\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x07\x01\x00\x00\x64\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x01\xE5\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x10\x03\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x02\x1A\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x28\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x02\x0B\x00\x00\x19\x11\x00\x02\x3D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x07\x01\x00\x00\x19\x03\x00\x00\x46\x03\x00\x00\x4A\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x01\x5A\x03\x00\x00\x04\x03\x00\x00\x4F\x11\x00\x00\x4F\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x2E\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x5C\x11\x00\x00\x19\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x5C\x11\x00\x02\x30\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x5C\x11\x00\x00\x07\x01\x00\x00\x6D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x5C\x11\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x2E\x03\x00\x02\x2D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x71\x11\x00\x00\x00\x0B\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x71\x11\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x19\x11\x00\x00\x6D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x28\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x02\x31\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x2D\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x2D\x11\x00\x00\x2D\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x2D\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x56\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x07\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x0A\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x0D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x02\x33\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\xB0\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x32\x11\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x1B\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x02\x34\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\xC6\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x02\x35\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\xCF\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x55\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x55\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x02\x36\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\xE1\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xB0\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xC6\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xCF\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x55\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xE1\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\x3A\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\x3B\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\x25\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\x3C\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x1F\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x1F\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x25\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x25\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x2B\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x2B\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x31\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x31\x11\x00\x00\x76\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x01\x31\x11\x00\x00\x17\x01\x00\x00\x17\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x2F\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\x5C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\x70\x11\x00\x00\x71\x03\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\x70\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\x70\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\x70\x11\x00\x00\x55\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x01\x5E\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\x01\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x5E\x11\x00\x00\xC2\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x00\x19\x11\x00\x00\x09\x01\x00\x00\x55\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x30\x03\x00\x00\x4F\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x8F\x11\x00\x00\x88\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x8F\x11\x00\x00\x56\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x8F\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x8F\x11\x00\x00\x55\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x32\x03\x00\x00\x4F\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x4F\x11\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x19\x11\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x88\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x56\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\xA4\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\xA8\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\xAC\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x32\x11\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x55\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x80\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x09\x01\x00\x00\x4F\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x09\x01\x00\x00\x88\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xA3\x11\x00\x00\x09\x01\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x19\x11\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x19\x11\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x00\x0F\x00\x00\x6D\x0D\x00\x00\x07\x01\x00\x00\x69\x11\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x02\x3D\x0D\x00\x02\x2F\x03\x00\x00\x00\x0F\x00\x02\x3D\x0D\x00\x00\x0E\x01\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x02\x3D\x0D\x00\x00\x17\x01\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x02\x3D\x0D\x00\x00\x18\x01\x00\x00\x71\x11\x00\x00\x00\x0F\x00\x02\x3D\x0D\x00\x00\x4A\x11\x00\x00\x00\x0F\x00\x02\x3D\x0D\x00\x00\x00\x0F\x00\x00\x02\x01\x00\x00\x01\x09\x00\x00\x04\x09\x00\x00\x02\x09\x00\x02\x32\x03\x00\x00\x03\x09\x00\x00\x0D\x01\x00\x00\x13\x01\x00\x00\x15\x01\x00\x00\x11\x01\x00\x00\x00\x09\x00\x02\x37\x05\x00\x00\x00\x20\x00\x00\x14\x01\x00\x00\x16\x01\x00\x00\x12\x01\x00\x00\x00\x01',
-    _globals = (b'\xFF\xFF\xFF\x1FCODA_CURSOR_MAXDEPTH',32,b'\xFF\xFF\xFF\x1FCODA_ERROR_ARRAY_NUM_DIMS_MISMATCH',-106,b'\xFF\xFF\xFF\x1FCODA_ERROR_ARRAY_OUT_OF_BOUNDS',-107,b'\xFF\xFF\xFF\x1FCODA_ERROR_DATA_DEFINITION',-400,b'\xFF\xFF\xFF\x1FCODA_ERROR_EXPRESSION',-401,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_NOT_FOUND',-20,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_OPEN',-21,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_READ',-22,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_WRITE',-23,b'\xFF\xFF\xFF\x1FCODA_ERROR_HDF4',-10,b'\xFF\xFF\xFF\x1FCODA_ERROR_HDF5',-12,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_ARGUMENT',-100,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_DATETIME',-104,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_FORMAT',-103,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_INDEX',-101,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_NAME',-102,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_TYPE',-105,b'\xFF\xFF\xFF\x1FCODA_ERROR_NO_HDF4_SUPPORT',-11,b'\xFF\xFF\xFF\x1FCODA_ERROR_NO_HDF5_SUPPORT',-13,b'\xFF\xFF\xFF\x1FCODA_ERROR_NO_PARENT',-108,b'\xFF\xFF\xFF\x1FCODA_ERROR_OUT_OF_BOUNDS_READ',-301,b'\xFF\xFF\xFF\x1FCODA_ERROR_OUT_OF_MEMORY',-1,b'\xFF\xFF\xFF\x1FCODA_ERROR_PRODUCT',-300,b'\xFF\xFF\xFF\x1FCODA_ERROR_UNSUPPORTED_PRODUCT',-200,b'\xFF\xFF\xFF\x1FCODA_ERROR_XML',-14,b'\xFF\xFF\xFF\x1FCODA_MAX_NUM_DIMS',8,b'\xFF\xFF\xFF\x1FCODA_SUCCESS',0,b'\xFF\xFF\xFF\x1FMAX_NUM_DIMS',8,b'\x00\x00\x14\x23coda_MinInf',0,b'\x00\x00\x14\x23coda_NaN',0,b'\x00\x00\x14\x23coda_PlusInf',0,b'\xFF\xFF\xFF\x0Bcoda_array_class',1,b'\xFF\xFF\xFF\x0Bcoda_array_ordering_c',0,b'\xFF\xFF\xFF\x0Bcoda_array_ordering_fortran',1,b'\x00\x02\x14\x23coda_c_index_to_fortran_index',0,b'\x00\x01\x85\x23coda_close',0,b'\x00\x00\xBB\x23coda_cursor_get_array_dim',0,b'\x00\x00\xE8\x23coda_cursor_get_available_union_field_index',0,b'\x00\x00\xD6\x23coda_cursor_get_bit_size',0,b'\x00\x00\xD6\x23coda_cursor_get_byte_size',0,b'\x00\x00\xB7\x23coda_cursor_get_depth',0,b'\x00\x00\xD6\x23coda_cursor_get_file_bit_offset',0,b'\x00\x00\xD6\x23coda_cursor_get_file_byte_offset',0,b'\x00\x00\x9E\x23coda_cursor_get_format',0,b'\x00\x00\xE8\x23coda_cursor_get_index',0,b'\x00\x00\xE8\x23coda_cursor_get_num_elements',0,b'\x00\x00\x82\x23coda_cursor_get_product_file',0,b'\x00\x00\xA2\x23coda_cursor_get_read_type',0,b'\x00\x00\xEC\x23coda_cursor_get_record_field_available_status',0,b'\x00\x00\x7D\x23coda_cursor_get_record_field_index_from_name',0,b'\x00\x00\xA6\x23coda_cursor_get_special_type',0,b'\x00\x00\xE8\x23coda_cursor_get_string_length',0,b'\x00\x00\x86\x23coda_cursor_get_type',0,b'\x00\x00\xAA\x23coda_cursor_get_type_class',0,b'\x00\x00\x5E\x23coda_cursor_goto',0,b'\x00\x00\x66\x23coda_cursor_goto_array_element',0,b'\x00\x00\x6B\x23coda_cursor_goto_array_element_by_index',0,b'\x00\x00\x5B\x23coda_cursor_goto_attributes',0,b'\x00\x00\x5B\x23coda_cursor_goto_available_union_field',0,b'\x00\x00\x5B\x23coda_cursor_goto_first_array_element',0,b'\x00\x00\x5B\x23coda_cursor_goto_first_record_field',0,b'\x00\x00\x5B\x23coda_cursor_goto_next_array_element',0,b'\x00\x00\x5B\x23coda_cursor_goto_next_record_field',0,b'\x00\x00\x5B\x23coda_cursor_goto_parent',0,b'\x00\x00\x6B\x23coda_cursor_goto_record_field_by_index',0,b'\x00\x00\x5E\x23coda_cursor_goto_record_field_by_name',0,b'\x00\x00\x5B\x23coda_cursor_goto_root',0,b'\x00\x00\xB7\x23coda_cursor_has_ascii_content',0,b'\x00\x00\xB7\x23coda_cursor_has_attributes',0,b'\x00\x00\xC0\x23coda_cursor_print_path',0,b'\x00\x01\x57\x23coda_cursor_read_bits',0,b'\x00\x01\x57\x23coda_cursor_read_bytes',0,b'\x00\x00\x6F\x23coda_cursor_read_char',0,b'\x00\x00\x73\x23coda_cursor_read_char_array',0,b'\x00\x00\xF1\x23coda_cursor_read_char_partial_array',0,b'\x00\x00\x8A\x23coda_cursor_read_complex_double_pair',0,b'\x00\x00\x99\x23coda_cursor_read_complex_double_pairs_array',0,b'\x00\x00\x8E\x23coda_cursor_read_complex_double_split',0,b'\x00\x00\x93\x23coda_cursor_read_complex_double_split_array',0,b'\x00\x00\x8A\x23coda_cursor_read_double',0,b'\x00\x00\x99\x23coda_cursor_read_double_array',0,b'\x00\x00\xF7\x23coda_cursor_read_double_partial_array',0,b'\x00\x00\xAE\x23coda_cursor_read_float',0,b'\x00\x00\xB2\x23coda_cursor_read_float_array',0,b'\x00\x00\xFD\x23coda_cursor_read_float_partial_array',0,b'\x00\x00\xC4\x23coda_cursor_read_int16',0,b'\x00\x00\xC8\x23coda_cursor_read_int16_array',0,b'\x00\x01\x03\x23coda_cursor_read_int16_partial_array',0,b'\x00\x00\xCD\x23coda_cursor_read_int32',0,b'\x00\x00\xD1\x23coda_cursor_read_int32_array',0,b'\x00\x01\x09\x23coda_cursor_read_int32_partial_array',0,b'\x00\x00\xD6\x23coda_cursor_read_int64',0,b'\x00\x00\xDA\x23coda_cursor_read_int64_array',0,b'\x00\x01\x0F\x23coda_cursor_read_int64_partial_array',0,b'\x00\x00\xDF\x23coda_cursor_read_int8',0,b'\x00\x00\xE3\x23coda_cursor_read_int8_array',0,b'\x00\x01\x15\x23coda_cursor_read_int8_partial_array',0,b'\x00\x00\x78\x23coda_cursor_read_string',0,b'\x00\x01\x33\x23coda_cursor_read_uint16',0,b'\x00\x01\x37\x23coda_cursor_read_uint16_array',0,b'\x00\x01\x1B\x23coda_cursor_read_uint16_partial_array',0,b'\x00\x01\x3C\x23coda_cursor_read_uint32',0,b'\x00\x01\x40\x23coda_cursor_read_uint32_array',0,b'\x00\x01\x21\x23coda_cursor_read_uint32_partial_array',0,b'\x00\x01\x45\x23coda_cursor_read_uint64',0,b'\x00\x01\x49\x23coda_cursor_read_uint64_array',0,b'\x00\x01\x27\x23coda_cursor_read_uint64_partial_array',0,b'\x00\x01\x4E\x23coda_cursor_read_uint8',0,b'\x00\x01\x52\x23coda_cursor_read_uint8_array',0,b'\x00\x01\x2D\x23coda_cursor_read_uint8_partial_array',0,b'\x00\x00\x62\x23coda_cursor_set_product',0,b'\x00\x00\x5B\x23coda_cursor_use_base_type_of_special_type',0,b'\x00\x02\x08\x23coda_datetime_to_double',0,b'\x00\x02\x2B\x23coda_done',0,b'\x00\x01\xF0\x23coda_double_to_datetime',0,b'\x00\x01\xF0\x23coda_double_to_utcdatetime',0,b'\x00\x00\x0F\x23coda_errno_to_string',0,b'\xFF\xFF\xFF\x0Bcoda_expression_boolean',0,b'\x00\x02\x19\x23coda_expression_delete',0,b'\x00\x01\x6F\x23coda_expression_eval_bool',0,b'\x00\x01\x6A\x23coda_expression_eval_float',0,b'\x00\x01\x74\x23coda_expression_eval_integer',0,b'\x00\x01\x60\x23coda_expression_eval_node',0,b'\x00\x01\x64\x23coda_expression_eval_string',0,b'\xFF\xFF\xFF\x0Bcoda_expression_float',2,b'\x00\x00\x3A\x23coda_expression_from_string',0,b'\x00\x01\x7D\x23coda_expression_get_type',0,b'\x00\x00\x00\x23coda_expression_get_type_name',0,b'\xFF\xFF\xFF\x0Bcoda_expression_integer',1,b'\x00\x01\x5D\x23coda_expression_is_constant',0,b'\x00\x01\x79\x23coda_expression_is_equal',0,b'\xFF\xFF\xFF\x0Bcoda_expression_node',4,b'\x00\x01\x81\x23coda_expression_print',0,b'\xFF\xFF\xFF\x0Bcoda_expression_string',3,b'\xFF\xFF\xFF\x0Bcoda_expression_void',5,b'\xFF\xFF\xFF\x0Bcoda_ffs_could_not_access_directory',2,b'\xFF\xFF\xFF\x0Bcoda_ffs_could_not_open_file',1,b'\xFF\xFF\xFF\x0Bcoda_ffs_error',0,b'\xFF\xFF\xFF\x0Bcoda_ffs_match',4,b'\xFF\xFF\xFF\x0Bcoda_ffs_no_match',5,b'\xFF\xFF\xFF\x0Bcoda_ffs_unsupported_file',3,b'\xFF\xFF\xFF\x0Bcoda_format_ascii',0,b'\xFF\xFF\xFF\x0Bcoda_format_binary',1,b'\xFF\xFF\xFF\x0Bcoda_format_cdf',5,b'\xFF\xFF\xFF\x0Bcoda_format_grib',7,b'\xFF\xFF\xFF\x0Bcoda_format_hdf4',3,b'\xFF\xFF\xFF\x0Bcoda_format_hdf5',4,b'\xFF\xFF\xFF\x0Bcoda_format_netcdf',6,b'\xFF\xFF\xFF\x0Bcoda_format_rinex',8,b'\xFF\xFF\xFF\x0Bcoda_format_sp3',9,b'\xFF\xFF\xFF\x0Bcoda_format_xml',2,b'\x00\x02\x28\x23coda_free',0,b'\x00\x00\x16\x23coda_get_errno',0,b'\x00\x00\x12\x23coda_get_libcoda_version',0,b'\x00\x02\x12\x23coda_get_option_bypass_special_types',0,b'\x00\x02\x12\x23coda_get_option_perform_boundary_checks',0,b'\x00\x02\x12\x23coda_get_option_perform_conversions',0,b'\x00\x02\x12\x23coda_get_option_use_fast_size_expressions',0,b'\x00\x02\x12\x23coda_get_option_use_mmap',0,b'\x00\x01\x8E\x23coda_get_product_class',0,b'\x00\x01\x8E\x23coda_get_product_definition_file',0,b'\x00\x01\x9E\x23coda_get_product_file_size',0,b'\x00\x01\x8E\x23coda_get_product_filename',0,b'\x00\x01\x96\x23coda_get_product_format',0,b'\x00\x01\x92\x23coda_get_product_root_type',0,b'\x00\x01\x8E\x23coda_get_product_type',0,b'\x00\x01\x88\x23coda_get_product_variable_value',0,b'\x00\x01\x9A\x23coda_get_product_version',0,b'\x00\x02\x12\x23coda_init',0,b'\xFF\xFF\xFF\x0Bcoda_integer_class',2,b'\x00\x01\xE4\x23coda_isInf',0,b'\x00\x01\xE4\x23coda_isMinInf',0,b'\x00\x01\xE4\x23coda_isNaN',0,b'\x00\x01\xE4\x23coda_isPlusInf',0,b'\x00\x00\x4C\x23coda_match_filefilter',0,b'\xFF\xFF\xFF\x0Bcoda_native_type_bytes',12,b'\xFF\xFF\xFF\x0Bcoda_native_type_char',10,b'\xFF\xFF\xFF\x0Bcoda_native_type_double',9,b'\xFF\xFF\xFF\x0Bcoda_native_type_float',8,b'\xFF\xFF\xFF\x0Bcoda_native_type_int16',2,b'\xFF\xFF\xFF\x0Bcoda_native_type_int32',4,b'\xFF\xFF\xFF\x0Bcoda_native_type_int64',6,b'\xFF\xFF\xFF\x0Bcoda_native_type_int8',0,b'\xFF\xFF\xFF\x0Bcoda_native_type_not_available',-1,b'\xFF\xFF\xFF\x0Bcoda_native_type_string',11,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint16',3,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint32',5,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint64',7,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint8',1,b'\x00\x00\x3E\x23coda_open',0,b'\x00\x00\x23\x23coda_open_as',0,b'\xFF\xFF\xFF\x0Bcoda_raw_class',5,b'\xFF\xFF\xFF\x0Bcoda_real_class',3,b'\x00\x00\x53\x23coda_recognize_file',0,b'\xFF\xFF\xFF\x0Bcoda_record_class',0,b'\x00\x00\x18\x23coda_set_definition_path',0,b'\x00\x00\x1E\x23coda_set_definition_path_conditional',0,b'\x00\x01\xFA\x23coda_set_option_bypass_special_types',0,b'\x00\x01\xFA\x23coda_set_option_perform_boundary_checks',0,b'\x00\x01\xFA\x23coda_set_option_perform_conversions',0,b'\x00\x01\xFA\x23coda_set_option_use_fast_size_expressions',0,b'\x00\x01\xFA\x23coda_set_option_use_mmap',0,b'\xFF\xFF\xFF\x0Bcoda_special_class',6,b'\xFF\xFF\xFF\x0Bcoda_special_complex',3,b'\xFF\xFF\xFF\x0Bcoda_special_no_data',0,b'\xFF\xFF\xFF\x0Bcoda_special_time',2,b'\xFF\xFF\xFF\x0Bcoda_special_vsf_integer',1,b'\x00\x02\x20\x23coda_str64',0,b'\x00\x02\x24\x23coda_str64u',0,b'\x00\x02\x1C\x23coda_strfl',0,b'\x00\x00\x42\x23coda_string_to_time',0,b'\xFF\xFF\xFF\x0Bcoda_text_class',4,b'\x00\x01\xF0\x23coda_time_double_to_parts',0,b'\x00\x01\xF0\x23coda_time_double_to_parts_utc',0,b'\x00\x01\xEB\x23coda_time_double_to_string',0,b'\x00\x01\xEB\x23coda_time_double_to_string_utc',0,b'\x00\x02\x08\x23coda_time_parts_to_double',0,b'\x00\x02\x08\x23coda_time_parts_to_double_utc',0,b'\x00\x01\xFD\x23coda_time_parts_to_string',0,b'\x00\x00\x2A\x23coda_time_string_to_double',0,b'\x00\x00\x2A\x23coda_time_string_to_double_utc',0,b'\x00\x00\x2F\x23coda_time_string_to_parts',0,b'\x00\x01\xE7\x23coda_time_to_string',0,b'\x00\x01\xE7\x23coda_time_to_utcstring',0,b'\x00\x01\xB0\x23coda_type_get_array_base_type',0,b'\x00\x01\xC8\x23coda_type_get_array_dim',0,b'\x00\x01\xC4\x23coda_type_get_array_num_dims',0,b'\x00\x01\xB0\x23coda_type_get_attributes',0,b'\x00\x01\xCD\x23coda_type_get_bit_size',0,b'\x00\x01\xC0\x23coda_type_get_class',0,b'\x00\x00\x0C\x23coda_type_get_class_name',0,b'\x00\x01\xA2\x23coda_type_get_description',0,b'\x00\x01\xA6\x23coda_type_get_fixed_value',0,b'\x00\x01\xB4\x23coda_type_get_format',0,b'\x00\x00\x03\x23coda_type_get_format_name',0,b'\x00\x01\xA2\x23coda_type_get_name',0,b'\x00\x00\x06\x23coda_type_get_native_type_name',0,b'\x00\x01\xD1\x23coda_type_get_num_record_fields',0,b'\x00\x01\xB8\x23coda_type_get_read_type',0,b'\x00\x01\xDF\x23coda_type_get_record_field_available_status',0,b'\x00\x01\xDF\x23coda_type_get_record_field_hidden_status',0,b'\x00\x01\xAB\x23coda_type_get_record_field_index_from_name',0,b'\x00\x01\xAB\x23coda_type_get_record_field_index_from_real_name',0,b'\x00\x01\xD5\x23coda_type_get_record_field_name',0,b'\x00\x01\xD5\x23coda_type_get_record_field_real_name',0,b'\x00\x01\xDA\x23coda_type_get_record_field_type',0,b'\x00\x01\xC4\x23coda_type_get_record_union_status',0,b'\x00\x01\xB0\x23coda_type_get_special_base_type',0,b'\x00\x01\xBC\x23coda_type_get_special_type',0,b'\x00\x00\x09\x23coda_type_get_special_type_name',0,b'\x00\x01\xD1\x23coda_type_get_string_length',0,b'\x00\x01\xA2\x23coda_type_get_unit',0,b'\x00\x01\xC4\x23coda_type_has_attributes',0,b'\x00\x02\x08\x23coda_utcdatetime_to_double',0,b'\x00\x00\x42\x23coda_utcstring_to_time',0),
-    _struct_unions = ((b'\x00\x00\x02\x37\x00\x00\x00\x02$1',b'\x00\x00\x4A\x11type',b'\x00\x00\x6D\x11index',b'\x00\x01\x5A\x11bit_offset'),(b'\x00\x00\x02\x2E\x00\x00\x00\x02$coda_cursor',b'\x00\x00\x64\x11product',b'\x00\x00\x10\x11n',b'\x00\x02\x38\x11stack'),(b'\x00\x00\x02\x30\x00\x00\x00\x10$coda_product',),(b'\x00\x00\x02\x32\x00\x00\x00\x10$coda_type',),(b'\x00\x00\x02\x2F\x00\x00\x00\x10coda_expression_struct',)),
-    _enums = (b'\x00\x00\x00\x76\x00\x00\x00\x16coda_array_ordering_enum\x00coda_array_ordering_c,coda_array_ordering_fortran',b'\x00\x00\x00\x01\x00\x00\x00\x16coda_expression_type_enum\x00coda_expression_boolean,coda_expression_integer,coda_expression_float,coda_expression_string,coda_expression_node,coda_expression_void',b'\x00\x00\x00\x48\x00\x00\x00\x16coda_filefilter_status_enum\x00coda_ffs_error,coda_ffs_could_not_open_file,coda_ffs_could_not_access_directory,coda_ffs_unsupported_file,coda_ffs_match,coda_ffs_no_match',b'\x00\x00\x00\x04\x00\x00\x00\x16coda_format_enum\x00coda_format_ascii,coda_format_binary,coda_format_xml,coda_format_hdf4,coda_format_hdf5,coda_format_cdf,coda_format_netcdf,coda_format_grib,coda_format_rinex,coda_format_sp3',b'\x00\x00\x00\x07\x00\x00\x00\x15coda_native_type_enum\x00coda_native_type_not_available,coda_native_type_int8,coda_native_type_uint8,coda_native_type_int16,coda_native_type_uint16,coda_native_type_int32,coda_native_type_uint32,coda_native_type_int64,coda_native_type_uint64,coda_native_type_float,coda_native_type_double,coda_native_type_char,coda_native_type_string,coda_native_type_bytes',b'\x00\x00\x00\x0A\x00\x00\x00\x16coda_special_type_enum\x00coda_special_no_data,coda_special_vsf_integer,coda_special_time,coda_special_complex',b'\x00\x00\x00\x0D\x00\x00\x00\x16coda_type_class_enum\x00coda_record_class,coda_array_class,coda_integer_class,coda_real_class,coda_text_class,coda_raw_class,coda_special_class'),
-    _typenames = (b'\x00\x00\x00\x76coda_array_ordering',b'\x00\x00\x02\x2Ecoda_cursor',b'\x00\x00\x02\x2Fcoda_expression',b'\x00\x00\x00\x01coda_expression_type',b'\x00\x00\x00\x48coda_filefilter_status',b'\x00\x00\x00\x04coda_format',b'\x00\x00\x00\x07coda_native_type',b'\x00\x00\x02\x30coda_product',b'\x00\x00\x00\x0Acoda_special_type',b'\x00\x00\x02\x32coda_type',b'\x00\x00\x00\x0Dcoda_type_class'),
+    _types = b'\x00\x00\x19\x0D\x00\x00\x01\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x03\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x04\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x05\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x06\x0B\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x07\x01\x00\x00\x00\x0F\x00\x00\x19\x0D\x00\x00\x00\x0F\x00\x01\xD1\x0D\x00\x00\x00\x0F\x00\x00\x32\x0D\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xAB\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x01\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x07\x01\x00\x00\x70\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x01\xD1\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x10\x03\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x02\x92\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x6C\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x28\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x02\x98\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x02\x0B\x00\x00\x19\x11\x00\x02\xBE\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x00\x07\x01\x00\x00\x19\x03\x00\x00\x4E\x03\x00\x00\x52\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x19\x11\x00\x01\x66\x03\x00\x00\x04\x03\x00\x00\x57\x11\x00\x00\x57\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xAC\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x00\x19\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x02\xAE\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x02\xAF\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x00\x07\x01\x00\x00\x79\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x64\x11\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xAC\x03\x00\x02\xAB\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x7D\x11\x00\x00\x00\x0B\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x7D\x11\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x19\x11\x00\x00\x79\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x28\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x02\xB1\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x2D\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x2D\x11\x00\x00\x2D\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x2D\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x5E\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x07\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x0A\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x0D\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x02\xB4\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\xBC\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x32\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x1B\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x02\xB5\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\xD2\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x02\xB6\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\xDB\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x5D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x5D\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x02\xB7\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\xED\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xBC\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xD2\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xDB\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x5D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\xED\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\xBB\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\xBC\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\xA3\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x00\x09\x01\x00\x00\x09\x01\x00\x02\xBD\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x2B\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x2B\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x31\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x31\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x37\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x37\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x3D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x3D\x11\x00\x00\x82\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x7C\x11\x00\x01\x3D\x11\x00\x00\x17\x01\x00\x00\x17\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xAD\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\x64\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\x7C\x11\x00\x00\x7D\x03\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\x7C\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\x7C\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\x7C\x11\x00\x00\x5D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x01\x6A\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\x01\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\x6A\x11\x00\x00\xCE\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x19\x11\x00\x00\x19\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x19\x11\x00\x02\x32\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x19\x11\x00\x00\x09\x01\x00\x00\x5D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x70\x11\x00\x00\x07\x01\x00\x00\x57\x11\x00\x00\x52\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xAF\x03\x00\x00\x57\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xAC\x11\x00\x00\x94\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xAC\x11\x00\x00\x5E\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xAC\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xAC\x11\x00\x00\x5D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xB0\x03\x00\x00\x19\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xC0\x11\x00\x00\x19\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xC0\x11\x00\x00\x0E\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xC0\x11\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xC0\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xC0\x11\x00\x00\x09\x01\x00\x00\x57\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xC0\x11\x00\x00\x09\x01\x00\x01\xD1\x03\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xB2\x03\x00\x00\x57\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x57\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x19\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x94\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x5E\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\xB0\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\xB4\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\xB8\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x32\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x5D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x8C\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x09\x01\x00\x00\x57\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x09\x01\x00\x00\x94\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x01\xF0\x11\x00\x00\x09\x01\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\xB3\x03\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x02\x32\x11\x00\x00\x64\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x19\x11\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x0E\x01\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\xCE\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x19\x11\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x07\x01\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x8C\x11\x00\x00\x8C\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x09\x01\x00\x01\xEC\x11\x00\x00\x2D\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x09\x01\x00\x01\xEC\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x32\x11\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x09\x01\x00\x00\x09\x01\x00\x00\x0E\x01\x00\x00\x00\x0F\x00\x00\x10\x0D\x00\x00\x00\x0F\x00\x00\x79\x0D\x00\x00\x07\x01\x00\x00\x75\x11\x00\x00\x09\x01\x00\x00\x00\x0F\x00\x00\x79\x0D\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x02\xAD\x03\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x00\x6C\x11\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x02\xB0\x03\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x00\x0E\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x00\x17\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x00\x18\x01\x00\x00\x7D\x11\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x00\x52\x11\x00\x00\x00\x0F\x00\x02\xBE\x0D\x00\x00\x00\x0F\x00\x00\x02\x01\x00\x00\x01\x09\x00\x00\x04\x09\x00\x00\x05\x09\x00\x00\x02\x09\x00\x00\x06\x09\x00\x02\xB2\x03\x00\x00\x03\x09\x00\x00\x07\x09\x00\x00\x0D\x01\x00\x00\x13\x01\x00\x00\x15\x01\x00\x00\x11\x01\x00\x00\x00\x09\x00\x02\xB8\x05\x00\x00\x00\x20\x00\x00\x14\x01\x00\x00\x16\x01\x00\x00\x12\x01\x00\x00\x00\x01',
+    _globals = (b'\xFF\xFF\xFF\x1FCODA_CURSOR_MAXDEPTH',32,b'\xFF\xFF\xFF\x1FCODA_ERROR_ARRAY_NUM_DIMS_MISMATCH',-106,b'\xFF\xFF\xFF\x1FCODA_ERROR_ARRAY_OUT_OF_BOUNDS',-107,b'\xFF\xFF\xFF\x1FCODA_ERROR_DATA_DEFINITION',-400,b'\xFF\xFF\xFF\x1FCODA_ERROR_EXPRESSION',-401,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_NOT_FOUND',-20,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_OPEN',-21,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_READ',-22,b'\xFF\xFF\xFF\x1FCODA_ERROR_FILE_WRITE',-23,b'\xFF\xFF\xFF\x1FCODA_ERROR_HDF4',-10,b'\xFF\xFF\xFF\x1FCODA_ERROR_HDF5',-12,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_ARGUMENT',-100,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_DATETIME',-104,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_FORMAT',-103,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_INDEX',-101,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_NAME',-102,b'\xFF\xFF\xFF\x1FCODA_ERROR_INVALID_TYPE',-105,b'\xFF\xFF\xFF\x1FCODA_ERROR_NO_HDF4_SUPPORT',-11,b'\xFF\xFF\xFF\x1FCODA_ERROR_NO_HDF5_SUPPORT',-13,b'\xFF\xFF\xFF\x1FCODA_ERROR_NO_PARENT',-108,b'\xFF\xFF\xFF\x1FCODA_ERROR_OUT_OF_BOUNDS_READ',-301,b'\xFF\xFF\xFF\x1FCODA_ERROR_OUT_OF_MEMORY',-1,b'\xFF\xFF\xFF\x1FCODA_ERROR_PRODUCT',-300,b'\xFF\xFF\xFF\x1FCODA_ERROR_UNSUPPORTED_PRODUCT',-200,b'\xFF\xFF\xFF\x1FCODA_ERROR_XML',-14,b'\xFF\xFF\xFF\x1FCODA_MAX_NUM_DIMS',8,b'\xFF\xFF\xFF\x1FCODA_SUCCESS',0,b'\xFF\xFF\xFF\x1FMAX_NUM_DIMS',8,b'\x00\x00\x14\x23coda_MinInf',0,b'\x00\x00\x14\x23coda_NaN',0,b'\x00\x00\x14\x23coda_PlusInf',0,b'\xFF\xFF\xFF\x0Bcoda_array_class',1,b'\xFF\xFF\xFF\x0Bcoda_array_ordering_c',0,b'\xFF\xFF\xFF\x0Bcoda_array_ordering_fortran',1,b'\x00\x02\x8A\x23coda_c_index_to_fortran_index',0,b'\x00\x01\x91\x23coda_close',0,b'\x00\x00\xC7\x23coda_cursor_get_array_dim',0,b'\x00\x00\xF4\x23coda_cursor_get_available_union_field_index',0,b'\x00\x00\xE2\x23coda_cursor_get_bit_size',0,b'\x00\x00\xE2\x23coda_cursor_get_byte_size',0,b'\x00\x00\xC3\x23coda_cursor_get_depth',0,b'\x00\x00\xE2\x23coda_cursor_get_file_bit_offset',0,b'\x00\x00\xE2\x23coda_cursor_get_file_byte_offset',0,b'\x00\x00\xAA\x23coda_cursor_get_format',0,b'\x00\x00\xF4\x23coda_cursor_get_index',0,b'\x00\x00\xF4\x23coda_cursor_get_num_elements',0,b'\x00\x00\x8E\x23coda_cursor_get_product_file',0,b'\x00\x00\xAE\x23coda_cursor_get_read_type',0,b'\x00\x00\xF8\x23coda_cursor_get_record_field_available_status',0,b'\x00\x00\x89\x23coda_cursor_get_record_field_index_from_name',0,b'\x00\x00\xB2\x23coda_cursor_get_special_type',0,b'\x00\x00\xF4\x23coda_cursor_get_string_length',0,b'\x00\x00\x92\x23coda_cursor_get_type',0,b'\x00\x00\xB6\x23coda_cursor_get_type_class',0,b'\x00\x00\x66\x23coda_cursor_goto',0,b'\x00\x00\x72\x23coda_cursor_goto_array_element',0,b'\x00\x00\x77\x23coda_cursor_goto_array_element_by_index',0,b'\x00\x00\x63\x23coda_cursor_goto_attributes',0,b'\x00\x00\x63\x23coda_cursor_goto_available_union_field',0,b'\x00\x00\x63\x23coda_cursor_goto_first_array_element',0,b'\x00\x00\x63\x23coda_cursor_goto_first_record_field',0,b'\x00\x00\x63\x23coda_cursor_goto_next_array_element',0,b'\x00\x00\x63\x23coda_cursor_goto_next_record_field',0,b'\x00\x00\x63\x23coda_cursor_goto_parent',0,b'\x00\x00\x6A\x23coda_cursor_goto_path',0,b'\x00\x00\x77\x23coda_cursor_goto_record_field_by_index',0,b'\x00\x00\x66\x23coda_cursor_goto_record_field_by_name',0,b'\x00\x00\x63\x23coda_cursor_goto_root',0,b'\x00\x00\xC3\x23coda_cursor_has_ascii_content',0,b'\x00\x00\xC3\x23coda_cursor_has_attributes',0,b'\x00\x00\xCC\x23coda_cursor_print_path',0,b'\x00\x01\x63\x23coda_cursor_read_bits',0,b'\x00\x01\x63\x23coda_cursor_read_bytes',0,b'\x00\x00\x7B\x23coda_cursor_read_char',0,b'\x00\x00\x7F\x23coda_cursor_read_char_array',0,b'\x00\x00\xFD\x23coda_cursor_read_char_partial_array',0,b'\x00\x00\x96\x23coda_cursor_read_complex_double_pair',0,b'\x00\x00\xA5\x23coda_cursor_read_complex_double_pairs_array',0,b'\x00\x00\x9A\x23coda_cursor_read_complex_double_split',0,b'\x00\x00\x9F\x23coda_cursor_read_complex_double_split_array',0,b'\x00\x00\x96\x23coda_cursor_read_double',0,b'\x00\x00\xA5\x23coda_cursor_read_double_array',0,b'\x00\x01\x03\x23coda_cursor_read_double_partial_array',0,b'\x00\x00\xBA\x23coda_cursor_read_float',0,b'\x00\x00\xBE\x23coda_cursor_read_float_array',0,b'\x00\x01\x09\x23coda_cursor_read_float_partial_array',0,b'\x00\x00\xD0\x23coda_cursor_read_int16',0,b'\x00\x00\xD4\x23coda_cursor_read_int16_array',0,b'\x00\x01\x0F\x23coda_cursor_read_int16_partial_array',0,b'\x00\x00\xD9\x23coda_cursor_read_int32',0,b'\x00\x00\xDD\x23coda_cursor_read_int32_array',0,b'\x00\x01\x15\x23coda_cursor_read_int32_partial_array',0,b'\x00\x00\xE2\x23coda_cursor_read_int64',0,b'\x00\x00\xE6\x23coda_cursor_read_int64_array',0,b'\x00\x01\x1B\x23coda_cursor_read_int64_partial_array',0,b'\x00\x00\xEB\x23coda_cursor_read_int8',0,b'\x00\x00\xEF\x23coda_cursor_read_int8_array',0,b'\x00\x01\x21\x23coda_cursor_read_int8_partial_array',0,b'\x00\x00\x84\x23coda_cursor_read_string',0,b'\x00\x01\x3F\x23coda_cursor_read_uint16',0,b'\x00\x01\x43\x23coda_cursor_read_uint16_array',0,b'\x00\x01\x27\x23coda_cursor_read_uint16_partial_array',0,b'\x00\x01\x48\x23coda_cursor_read_uint32',0,b'\x00\x01\x4C\x23coda_cursor_read_uint32_array',0,b'\x00\x01\x2D\x23coda_cursor_read_uint32_partial_array',0,b'\x00\x01\x51\x23coda_cursor_read_uint64',0,b'\x00\x01\x55\x23coda_cursor_read_uint64_array',0,b'\x00\x01\x33\x23coda_cursor_read_uint64_partial_array',0,b'\x00\x01\x5A\x23coda_cursor_read_uint8',0,b'\x00\x01\x5E\x23coda_cursor_read_uint8_array',0,b'\x00\x01\x39\x23coda_cursor_read_uint8_partial_array',0,b'\x00\x00\x6E\x23coda_cursor_set_product',0,b'\x00\x00\x63\x23coda_cursor_use_base_type_of_special_type',0,b'\x00\x02\x61\x23coda_datetime_to_double',0,b'\x00\x02\xA9\x23coda_done',0,b'\x00\x02\x45\x23coda_double_to_datetime',0,b'\x00\x02\x45\x23coda_double_to_utcdatetime',0,b'\x00\x00\x0F\x23coda_errno_to_string',0,b'\xFF\xFF\xFF\x0Bcoda_expression_boolean',0,b'\x00\x02\x91\x23coda_expression_delete',0,b'\x00\x01\x7B\x23coda_expression_eval_bool',0,b'\x00\x01\x76\x23coda_expression_eval_float',0,b'\x00\x01\x80\x23coda_expression_eval_integer',0,b'\x00\x01\x6C\x23coda_expression_eval_node',0,b'\x00\x01\x70\x23coda_expression_eval_string',0,b'\xFF\xFF\xFF\x0Bcoda_expression_float',2,b'\x00\x00\x3A\x23coda_expression_from_string',0,b'\x00\x01\x89\x23coda_expression_get_type',0,b'\x00\x00\x00\x23coda_expression_get_type_name',0,b'\xFF\xFF\xFF\x0Bcoda_expression_integer',1,b'\x00\x01\x69\x23coda_expression_is_constant',0,b'\x00\x01\x85\x23coda_expression_is_equal',0,b'\xFF\xFF\xFF\x0Bcoda_expression_node',4,b'\x00\x01\x8D\x23coda_expression_print',0,b'\x00\x02\x52\x23coda_expression_profile_print',0,b'\x00\x02\xA9\x23coda_expression_profile_reset',0,b'\xFF\xFF\xFF\x0Bcoda_expression_string',3,b'\xFF\xFF\xFF\x0Bcoda_expression_void',5,b'\xFF\xFF\xFF\x0Bcoda_ffs_could_not_access_directory',2,b'\xFF\xFF\xFF\x0Bcoda_ffs_could_not_open_file',1,b'\xFF\xFF\xFF\x0Bcoda_ffs_error',0,b'\xFF\xFF\xFF\x0Bcoda_ffs_match',4,b'\xFF\xFF\xFF\x0Bcoda_ffs_no_match',5,b'\xFF\xFF\xFF\x0Bcoda_ffs_unsupported_file',3,b'\xFF\xFF\xFF\x0Bcoda_format_ascii',0,b'\xFF\xFF\xFF\x0Bcoda_format_binary',1,b'\xFF\xFF\xFF\x0Bcoda_format_cdf',5,b'\xFF\xFF\xFF\x0Bcoda_format_grib',7,b'\xFF\xFF\xFF\x0Bcoda_format_hdf4',3,b'\xFF\xFF\xFF\x0Bcoda_format_hdf5',4,b'\xFF\xFF\xFF\x0Bcoda_format_netcdf',6,b'\xFF\xFF\xFF\x0Bcoda_format_rinex',8,b'\xFF\xFF\xFF\x0Bcoda_format_sp3',9,b'\xFF\xFF\xFF\x0Bcoda_format_xml',2,b'\x00\x02\xA6\x23coda_free',0,b'\x00\x00\x16\x23coda_get_errno',0,b'\x00\x00\x12\x23coda_get_libcoda_version',0,b'\x00\x02\x88\x23coda_get_option_bypass_special_types',0,b'\x00\x02\x8F\x23coda_get_option_cdf_cache_size',0,b'\x00\x02\x6B\x23coda_get_option_hdf5_chunk_cache',0,b'\x00\x02\x8F\x23coda_get_option_hdf5_metadata_cache_size',0,b'\x00\x02\x8F\x23coda_get_option_hdf5_page_buffer_size',0,b'\x00\x02\x88\x23coda_get_option_perform_boundary_checks',0,b'\x00\x02\x88\x23coda_get_option_perform_conversions',0,b'\x00\x02\x88\x23coda_get_option_profile_expressions',0,b'\x00\x02\x88\x23coda_get_option_use_fast_size_expressions',0,b'\x00\x02\x88\x23coda_get_option_use_grib_index',0,b'\x00\x02\x88\x23coda_get_option_use_hdf4_lazy_loading',0,b'\x00\x02\x88\x23coda_get_option_use_hdf5_lazy_loading',0,b'\x00\x02\x88\x23coda_get_option_use_mmap',0,b'\x00\x02\x88\x23coda_get_option_use_xml_lazy_loading',0,b'\x00\x01\xAB\x23coda_get_product_class',0,b'\x00\x01\xAB\x23coda_get_product_definition_file',0,b'\x00\x01\xBB\x23coda_get_product_file_size',0,b'\x00\x01\xAB\x23coda_get_product_filename',0,b'\x00\x01\xB3\x23coda_get_product_format',0,b'\x00\x01\xAF\x23coda_get_product_root_type',0,b'\x00\x01\xAB\x23coda_get_product_type',0,b'\x00\x01\x9F\x23coda_get_product_variable_value',0,b'\x00\x01\xB7\x23coda_get_product_version',0,b'\x00\x02\x88\x23coda_init',0,b'\xFF\xFF\xFF\x0Bcoda_integer_class',2,b'\x00\x02\x39\x23coda_isInf',0,b'\x00\x02\x39\x23coda_isMinInf',0,b'\x00\x02\x39\x23coda_isNaN',0,b'\x00\x02\x39\x23coda_isPlusInf',0,b'\x00\x00\x54\x23coda_match_filefilter',0,b'\xFF\xFF\xFF\x0Bcoda_native_type_bytes',12,b'\xFF\xFF\xFF\x0Bcoda_native_type_char',10,b'\xFF\xFF\xFF\x0Bcoda_native_type_double',9,b'\xFF\xFF\xFF\x0Bcoda_native_type_float',8,b'\xFF\xFF\xFF\x0Bcoda_native_type_int16',2,b'\xFF\xFF\xFF\x0Bcoda_native_type_int32',4,b'\xFF\xFF\xFF\x0Bcoda_native_type_int64',6,b'\xFF\xFF\xFF\x0Bcoda_native_type_int8',0,b'\xFF\xFF\xFF\x0Bcoda_native_type_not_available',-1,b'\xFF\xFF\xFF\x0Bcoda_native_type_string',11,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint16',3,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint32',5,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint64',7,b'\xFF\xFF\xFF\x0Bcoda_native_type_uint8',1,b'\x00\x01\xA5\x23coda_netcdf_read_record_variables',0,b'\x00\x00\x42\x23coda_open',0,b'\x00\x00\x23\x23coda_open_as',0,b'\x00\x00\x3E\x23coda_path_compile',0,b'\x00\x02\x94\x23coda_path_delete',0,b'\xFF\xFF\xFF\x0Bcoda_raw_class',5,b'\xFF\xFF\xFF\x0Bcoda_real_class',3,b'\x00\x00\x5B\x23coda_recognize_file',0,b'\xFF\xFF\xFF\x0Bcoda_record_class',0,b'\x00\x01\x94\x23coda_rinex_read_satellite_series',0,b'\x00\x00\x18\x23coda_set_definition_path',0,b'\x00\x00\x1E\x23coda_set_definition_path_conditional',0,b'\x00\x02\x4F\x23coda_set_option_bypass_special_types',0,b'\x00\x02\x70\x23coda_set_option_cdf_cache_size',0,b'\x00\x02\x83\x23coda_set_option_hdf5_chunk_cache',0,b'\x00\x02\x70\x23coda_set_option_hdf5_metadata_cache_size',0,b'\x00\x02\x70\x23coda_set_option_hdf5_page_buffer_size',0,b'\x00\x02\x4F\x23coda_set_option_perform_boundary_checks',0,b'\x00\x02\x4F\x23coda_set_option_perform_conversions',0,b'\x00\x02\x4F\x23coda_set_option_profile_expressions',0,b'\x00\x02\x4F\x23coda_set_option_use_fast_size_expressions',0,b'\x00\x02\x4F\x23coda_set_option_use_grib_index',0,b'\x00\x02\x4F\x23coda_set_option_use_hdf4_lazy_loading',0,b'\x00\x02\x4F\x23coda_set_option_use_hdf5_lazy_loading',0,b'\x00\x02\x4F\x23coda_set_option_use_mmap',0,b'\x00\x02\x4F\x23coda_set_option_use_xml_lazy_loading',0,b'\x00\x01\x94\x23coda_sp3_read_satellite_series',0,b'\xFF\xFF\xFF\x0Bcoda_special_class',6,b'\xFF\xFF\xFF\x0Bcoda_special_complex',3,b'\xFF\xFF\xFF\x0Bcoda_special_no_data',0,b'\xFF\xFF\xFF\x0Bcoda_special_time',2,b'\xFF\xFF\xFF\x0Bcoda_special_vsf_integer',1,b'\x00\x02\x9E\x23coda_str64',0,b'\x00\x02\xA2\x23coda_str64u',0,b'\x00\x02\x9A\x23coda_strfl',0,b'\x00\x00\x4A\x23coda_string_to_time',0,b'\xFF\xFF\xFF\x0Bcoda_text_class',4,b'\x00\x02\x45\x23coda_time_double_to_parts',0,b'\x00\x02\x78\x23coda_time_double_to_parts_array',0,b'\x00\x02\x45\x23coda_time_double_to_parts_utc',0,b'\x00\x02\x78\x23coda_time_double_to_parts_utc_array',0,b'\x00\x02\x40\x23coda_time_double_to_string',0,b'\x00\x02\x40\x23coda_time_double_to_string_utc',0,b'\x00\x00\x46\x23coda_time_format_compile',0,b'\x00\x02\x97\x23coda_time_format_delete',0,b'\x00\x01\xCF\x23coda_time_format_double_to_string',0,b'\x00\x01\xE9\x23coda_time_format_double_to_string_array',0,b'\x00\x01\xCF\x23coda_time_format_double_to_string_utc',0,b'\x00\x01\xE9\x23coda_time_format_double_to_string_utc_array',0,b'\x00\x01\xDF\x23coda_time_format_get_string_length',0,b'\x00\x01\xD4\x23coda_time_format_parts_to_string',0,b'\x00\x01\xBF\x23coda_time_format_string_to_double',0,b'\x00\x01\xE3\x23coda_time_format_string_to_double_array',0,b'\x00\x01\xBF\x23coda_time_format_string_to_double_utc',0,b'\x00\x01\xE3\x23coda_time_format_string_to_double_utc_array',0,b'\x00\x01\xC4\x23coda_time_format_string_to_parts',0,b'\x00\x02\x61\x23coda_time_parts_to_double',0,b'\x00\x02\x61\x23coda_time_parts_to_double_utc',0,b'\x00\x02\x56\x23coda_time_parts_to_string',0,b'\x00\x00\x2A\x23coda_time_string_to_double',0,b'\x00\x00\x2A\x23coda_time_string_to_double_utc',0,b'\x00\x00\x2F\x23coda_time_string_to_parts',0,b'\x00\x02\x73\x23coda_time_tai_to_utc_array',0,b'\x00\x02\x3C\x23coda_time_to_string',0,b'\x00\x02\x3C\x23coda_time_to_utcstring',0,b'\x00\x02\x73\x23coda_time_utc_to_tai_array',0,b'\x00\x01\xFD\x23coda_type_get_array_base_type',0,b'\x00\x02\x15\x23coda_type_get_array_dim',0,b'\x00\x02\x11\x23coda_type_get_array_num_dims',0,b'\x00\x01\xFD\x23coda_type_get_attributes',0,b'\x00\x02\x1A\x23coda_type_get_bit_size',0,b'\x00\x02\x0D\x23coda_type_get_class',0,b'\x00\x00\x0C\x23coda_type_get_class_name',0,b'\x00\x01\xEF\x23coda_type_get_description',0,b'\x00\x01\xF3\x23coda_type_get_fixed_value',0,b'\x00\x02\x01\x23coda_type_get_format',0,b'\x00\x00\x03\x23coda_type_get_format_name',0,b'\x00\x01\xEF\x23coda_type_get_name',0,b'\x00\x00\x06\x23coda_type_get_native_type_name',0,b'\x00\x02\x1E\x23coda_type_get_num_record_fields',0,b'\x00\x02\x05\x23coda_type_get_read_type',0,b'\x00\x02\x2C\x23coda_type_get_record_field_available_status',0,b'\x00\x02\x2C\x23coda_type_get_record_field_hidden_status',0,b'\x00\x01\xF8\x23coda_type_get_record_field_index_from_name',0,b'\x00\x01\xF8\x23coda_type_get_record_field_index_from_real_name',0,b'\x00\x02\x22\x23coda_type_get_record_field_name',0,b'\x00\x02\x22\x23coda_type_get_record_field_real_name',0,b'\x00\x02\x27\x23coda_type_get_record_field_type',0,b'\x00\x02\x11\x23coda_type_get_record_union_status',0,b'\x00\x01\xFD\x23coda_type_get_special_base_type',0,b'\x00\x02\x09\x23coda_type_get_special_type',0,b'\x00\x00\x09\x23coda_type_get_special_type_name',0,b'\x00\x02\x1E\x23coda_type_get_string_length',0,b'\x00\x01\xEF\x23coda_type_get_unit',0,b'\x00\x02\x11\x23coda_type_has_attributes',0,b'\x00\x02\x61\x23coda_utcdatetime_to_double',0,b'\x00\x00\x4A\x23coda_utcstring_to_time',0,b'\x00\x02\x31\x23coda_xml_stream_close',0,b'\x00\x02\x34\x23coda_xml_stream_next',0,b'\x00\x01\x9A\x23coda_xml_stream_open',0),
+    _struct_unions = ((b'\x00\x00\x02\xB8\x00\x00\x00\x02$1',b'\x00\x00\x52\x11type',b'\x00\x00\x79\x11index',b'\x00\x01\x66\x11bit_offset'),(b'\x00\x00\x02\xAC\x00\x00\x00\x02$coda_cursor',b'\x00\x00\x70\x11product',b'\x00\x00\x10\x11n',b'\x00\x02\xB9\x11stack'),(b'\x00\x00\x02\xAF\x00\x00\x00\x10$coda_product',),(b'\x00\x00\x02\xB2\x00\x00\x00\x10$coda_type',),(b'\x00\x00\x02\xAD\x00\x00\x00\x10coda_expression_struct',),(b'\x00\x00\x02\xAE\x00\x00\x00\x10coda_path_struct',),(b'\x00\x00\x02\xB0\x00\x00\x00\x10coda_time_format_struct',),(b'\x00\x00\x02\xB3\x00\x00\x00\x10coda_xml_stream_struct',)),
+    _enums = (b'\x00\x00\x00\x82\x00\x00\x00\x16coda_array_ordering_enum\x00coda_array_ordering_c,coda_array_ordering_fortran',b'\x00\x00\x00\x01\x00\x00\x00\x16coda_expression_type_enum\x00coda_expression_boolean,coda_expression_integer,coda_expression_float,coda_expression_string,coda_expression_node,coda_expression_void',b'\x00\x00\x00\x50\x00\x00\x00\x16coda_filefilter_status_enum\x00coda_ffs_error,coda_ffs_could_not_open_file,coda_ffs_could_not_access_directory,coda_ffs_unsupported_file,coda_ffs_match,coda_ffs_no_match',b'\x00\x00\x00\x04\x00\x00\x00\x16coda_format_enum\x00coda_format_ascii,coda_format_binary,coda_format_xml,coda_format_hdf4,coda_format_hdf5,coda_format_cdf,coda_format_netcdf,coda_format_grib,coda_format_rinex,coda_format_sp3',b'\x00\x00\x00\x07\x00\x00\x00\x15coda_native_type_enum\x00coda_native_type_not_available,coda_native_type_int8,coda_native_type_uint8,coda_native_type_int16,coda_native_type_uint16,coda_native_type_int32,coda_native_type_uint32,coda_native_type_int64,coda_native_type_uint64,coda_native_type_float,coda_native_type_double,coda_native_type_char,coda_native_type_string,coda_native_type_bytes',b'\x00\x00\x00\x0A\x00\x00\x00\x16coda_special_type_enum\x00coda_special_no_data,coda_special_vsf_integer,coda_special_time,coda_special_complex',b'\x00\x00\x00\x0D\x00\x00\x00\x16coda_type_class_enum\x00coda_record_class,coda_array_class,coda_integer_class,coda_real_class,coda_text_class,coda_raw_class,coda_special_class'),
+    _typenames = (b'\x00\x00\x00\x82coda_array_ordering',b'\x00\x00\x02\xACcoda_cursor',b'\x00\x00\x02\xADcoda_expression',b'\x00\x00\x00\x01coda_expression_type',b'\x00\x00\x00\x50coda_filefilter_status',b'\x00\x00\x00\x04coda_format',b'\x00\x00\x00\x07coda_native_type',b'\x00\x00\x02\xAEcoda_path',b'\x00\x00\x02\xAFcoda_product',b'\x00\x00\x00\x0Acoda_special_type',b'\x00\x00\x02\xB0coda_time_format',b'\x00\x00\x02\xB2coda_type',b'\x00\x00\x00\x0Dcoda_type_class',b'\x00\x00\x02\xB3coda_xml_stream'),
 )
@@ -49,6 +49,8 @@ int coda_product_check(coda_product *product, int full_read_check,
 int option_verbose;
 int option_quick;
 int option_require_definition;
+int option_profile;
+int option_profile_entries;
 int found_errors;
 
 static void print_version(void)
@@ -75,6 +77,13 @@ static void print_help(void)
     printf("                    show more information while performing the check\n");
     printf("            --no-mmap\n");
     printf("                    disable the use of mmap when opening files\n");
+    printf("            -p, --profile\n");
+    printf("                    profile the evaluation of codadef expressions and, after\n");
+    printf("                    all files have been checked, report the expressions on\n");
+    printf("                    which most time was spent\n");
+    printf("            --profile-entries <n>\n");
+    printf("                    number of expressions to include in the profile report\n");
+    printf("                    (default: 20, implies --profile)\n");
     printf("\n");
     printf("        If you pass a '-' for the <files> section then the list of files will\n");
     printf("        be read from stdin.\n");
@@ -192,6 +201,8 @@ int main(int argc, char *argv[])
     option_quick = 0;
     option_use_mmap = 1;
     option_require_definition = 0;
+    option_profile = 0;
+    option_profile_entries = 20;
 
     if (argc == 1 || strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)
     {
@@ -240,6 +251,16 @@ int main(int argc, char *argv[])
         {
             option_use_mmap = 0;
         }
+        else if (strcmp(argv[i], "-p") == 0 || strcmp(argv[i], "--profile") == 0)
+        {
+            option_profile = 1;
+        }
+        else if (strcmp(argv[i], "--profile-entries") == 0 && i + 1 < argc && argv[i + 1][0] != '-')
+        {
+            option_profile = 1;
+            option_profile_entries = atoi(argv[i + 1]);
+            i++;
+        }
         else if (strcmp(argv[i], "-") == 0 && i == argc - 1)
         {
             option_stdin = 1;
@@ -259,6 +280,9 @@ int main(int argc, char *argv[])
         i++;
     }
 
+    /* expression origins are recorded while reading the codadef files, so profiling needs to be enabled first */
+    coda_set_option_profile_expressions(option_profile);
+
     if (coda_init() != 0)
     {
         fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
@@ -329,6 +353,15 @@ int main(int argc, char *argv[])
         }
     }
 
+    if (option_profile)
+    {
+        if (coda_expression_profile_print(option_profile_entries, printf) != 0)
+        {
+            fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+            found_errors = 1;
+        }
+    }
+
     coda_done();
 
     if (found_errors)
@@ -328,7 +328,7 @@ static void write_basic_data(FILE *f, int depth)
                                 }
                                 else
                                 {
-                                    if (coda_time_double_to_string(data, "yyyy-MM-dd HH:mm:ss.SSSSSS", str) != 0)
+                                    if (coda_time_format_double_to_string(time_format, data, str) != 0)
                                     {
                                         handle_coda_error();
                                     }
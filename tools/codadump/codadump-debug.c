@@ -603,7 +603,7 @@ static void print_data(coda_cursor *cursor, int depth)
                             }
                             else
                             {
-                                if (coda_time_double_to_string(data, "yyyy-MM-dd HH:mm:ss.SSSSSS", str) != 0)
+                                if (coda_time_format_double_to_string(time_format, data, str) != 0)
                                 {
                                     ff_printf(" {--invalid time value--}\n");
                                 }
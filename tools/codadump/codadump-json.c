@@ -469,7 +469,7 @@ static void print_data(coda_cursor *cursor)
                             }
                             else
                             {
-                                if (coda_time_double_to_string(data, "yyyy-MM-dd'T'HH:mm:ss.SSSSSS", str) != 0)
+                                if (coda_time_format_double_to_string(time_format, data, str) != 0)
                                 {
                                     ff_printf("\"{--invalid time value--}\"");
                                 }
@@ -53,6 +53,7 @@ int show_time_as_string;
 int show_type;
 int show_unit;
 int show_description;
+coda_time_format *time_format = NULL;
 
 static void print_version(void)
 {
@@ -208,6 +209,24 @@ void handle_coda_error(void)
     exit(1);
 }
 
+static void time_format_init(const char *format)
+{
+    if (coda_time_format_compile(format, &time_format) != 0)
+    {
+        fprintf(stderr, "ERROR: %s\n", coda_errno_to_string(coda_errno));
+        exit(1);
+    }
+}
+
+static void time_format_done(void)
+{
+    if (time_format != NULL)
+    {
+        coda_time_format_delete(time_format);
+        time_format = NULL;
+    }
+}
+
 static void handle_list_run_mode(int argc, char *argv[])
 {
     int use_special_types;
@@ -402,6 +421,7 @@ static void handle_ascii_run_mode(int argc, char *argv[])
     coda_set_option_bypass_special_types(!use_special_types);
     coda_set_option_perform_boundary_checks(0);
     coda_set_option_perform_conversions(perform_conversions);
+    time_format_init("yyyy-MM-dd HH:mm:ss.SSSSSS");
     traverse_info_init();
     dim_info_init();
     if (output_file_name != NULL)
@@ -422,6 +442,7 @@ static void handle_ascii_run_mode(int argc, char *argv[])
     }
     dim_info_done();
     traverse_info_done();
+    time_format_done();
     coda_done();
 }
 
@@ -605,6 +626,7 @@ static void handle_json_run_mode(int argc, char *argv[])
     }
     coda_set_option_bypass_special_types(!use_special_types);
     coda_set_option_perform_conversions(perform_conversions);
+    time_format_init("yyyy-MM-dd'T'HH:mm:ss.SSSSSS");
     if (output_file_name != NULL)
     {
         ascii_output = fopen(output_file_name, "w");
@@ -621,6 +643,7 @@ static void handle_json_run_mode(int argc, char *argv[])
     {
         fclose(ascii_output);
     }
+    time_format_done();
     coda_done();
 }
 
@@ -691,6 +714,7 @@ static void handle_yaml_run_mode(int argc, char *argv[])
     }
     coda_set_option_bypass_special_types(!use_special_types);
     coda_set_option_perform_conversions(perform_conversions);
+    time_format_init("yyyy-MM-dd'T'HH:mm:ss.SSSSSS");
     if (output_file_name != NULL)
     {
         ascii_output = fopen(output_file_name, "w");
@@ -707,6 +731,7 @@ static void handle_yaml_run_mode(int argc, char *argv[])
     {
         fclose(ascii_output);
     }
+    time_format_done();
     coda_done();
 }
 
@@ -780,6 +805,7 @@ static void handle_debug_run_mode(int argc, char *argv[])
         exit(1);
     }
     coda_set_option_perform_conversions(0);
+    time_format_init("yyyy-MM-dd HH:mm:ss.SSSSSS");
     coda_set_option_use_fast_size_expressions(use_fast_size_expressions);
     if (output_file_name != NULL)
     {
@@ -797,6 +823,7 @@ static void handle_debug_run_mode(int argc, char *argv[])
     {
         fclose(ascii_output);
     }
+    time_format_done();
     coda_done();
 }
 
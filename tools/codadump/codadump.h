@@ -79,6 +79,7 @@ extern int show_time_as_string;
 extern int show_type;
 extern int show_unit;
 extern int show_description;
+extern coda_time_format *time_format;
 
 /* this structure contains the dimension information for a single product variable
  *(i.e. the combined information of all arrays that are a parent to the variable)